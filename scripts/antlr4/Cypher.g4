@@ -38,6 +38,8 @@ BEGIN : ( 'B' | 'b' ) ( 'E' | 'e' ) ( 'G' | 'g' ) ( 'I' | 'i' ) ( 'N' | 'n' ) ;
 
 BY : ( 'B' | 'b' ) ( 'Y' | 'y' ) ;
 
+CACHE : ( 'C' | 'c' ) ( 'A' | 'a' ) ( 'C' | 'c' ) ( 'H' | 'h' ) ( 'E' | 'e' ) ;
+
 CALL : ( 'C' | 'c' ) ( 'A' | 'a' ) ( 'L' | 'l' ) ( 'L' | 'l' ) ;
 
 CASE : ( 'C' | 'c' ) ( 'A' | 'a' ) ( 'S' | 's' ) ( 'E' | 'e' ) ;
@@ -383,7 +385,8 @@ kU_SequenceOptions
         | kU_MinValue
         | kU_MaxValue
         | kU_StartWith
-        | kU_Cycle;
+        | kU_Cycle
+        | kU_Cache;
 
 kU_WithPasswd
     : SP WITH SP PASSWORD SP StringLiteral ;
@@ -404,6 +407,8 @@ kU_StartWith : START SP ( WITH SP )? MINUS? oC_IntegerLiteral ;
 
 kU_Cycle : (NO SP)? CYCLE ;
 
+kU_Cache : CACHE SP oC_IntegerLiteral ;
+
 kU_IfExists
     : IF SP EXISTS ;
 
@@ -990,6 +995,7 @@ kU_NonReservedKeywords
         | ATTACH
         | BEGIN
         | BY
+        | CACHE
         | CALL
         | CHECKPOINT
         | COMMENT
@@ -132,7 +132,8 @@ kU_SequenceOptions
         | kU_MinValue
         | kU_MaxValue
         | kU_StartWith
-        | kU_Cycle;
+        | kU_Cycle
+        | kU_Cache;
 
 kU_WithPasswd
     : SP WITH SP PASSWORD SP StringLiteral ;
@@ -153,6 +154,8 @@ kU_StartWith : START SP ( WITH SP )? MINUS? oC_IntegerLiteral ;
 
 kU_Cycle : (NO SP)? CYCLE ;
 
+kU_Cache : CACHE SP oC_IntegerLiteral ;
+
 kU_IfExists
     : IF SP EXISTS ;
 
@@ -739,6 +742,7 @@ kU_NonReservedKeywords
         | ATTACH
         | BEGIN
         | BY
+        | CACHE
         | CALL
         | CHECKPOINT
         | COMMENT
@@ -424,6 +424,7 @@ std::unique_ptr<BoundStatement> Binder::bindCreateSequence(const Statement& stat
     int64_t increment = 0;
     int64_t minValue = 0;
     int64_t maxValue = 0;
+    int64_t cacheSize = 0;
     auto transaction = transaction::Transaction::Get(*clientContext);
     switch (info.onConflict) {
     case ConflictAction::ON_CONFLICT_THROW: {
@@ -473,9 +474,17 @@ std::unique_ptr<BoundStatement> Binder::bindCreateSequence(const Statement& stat
     if (startWith < minValue || startWith > maxValue) {
         throw BinderException("SEQUENCE START value should be between MINVALUE and MAXVALUE.");
     }
+    literal = ku_string_t{info.cache.c_str(), info.cache.length()};
+    if (!function::CastString::tryCast(literal, cacheSize)) {
+        throw BinderException("Out of bounds: SEQUENCE accepts integers within INT64.");
+    }
+    if (cacheSize <= 0) {
+        throw BinderException("CACHE must be positive.");
+    }
 
     auto boundInfo = BoundCreateSequenceInfo(sequenceName, startWith, increment, minValue, maxValue,
         info.cycle, info.onConflict, false /* isInternal */);
+    boundInfo.cacheSize = cacheSize;
     return std::make_unique<BoundCreateSequence>(std::move(boundInfo));
 }
 
@@ -160,12 +160,8 @@ static std::shared_ptr<PropertyExpression> createPropertyExpression(const std::s
 static void checkRelDirectionTypeAgainstStorageDirection(const RelExpression* rel) {
     switch (rel->getDirectionType()) {
     case RelDirectionType::SINGLE:
-        // Directed pattern is in the fwd direction
-        if (!containsValue(rel->getExtendDirections(), ExtendDirection::FWD)) {
-            throw BinderException(std::format("Querying table matched in rel pattern '{}' with "
-                                              "bwd-only storage direction isn't supported.",
-                rel->toString()));
-        }
+        // Directed patterns can be planned from either end. The planner only extends rels in
+        // their stored direction and falls back to hash joins otherwise.
         break;
     case RelDirectionType::BOTH:
         if (rel->getExtendDirections().size() < NUM_REL_DIRECTIONS) {
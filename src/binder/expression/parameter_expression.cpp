@@ -1,5 +1,6 @@
 #include "binder/expression/parameter_expression.h"
 
+#include "common/assert.h"
 #include "common/exception/binder.h"
 #include <format>
 
@@ -20,5 +21,10 @@ void ParameterExpression::cast(const LogicalType& type) {
     value.setDataType(type);
 }
 
+void ParameterExpression::setValue(Value newValue) {
+    KU_ASSERT(newValue.getDataType() == dataType);
+    value = std::move(newValue);
+}
+
 } // namespace binder
 } // namespace lbug
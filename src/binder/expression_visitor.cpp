@@ -1,5 +1,7 @@
 #include "binder/expression_visitor.h"
 
+#include <algorithm>
+
 #include "binder/expression/case_expression.h"
 #include "binder/expression/lambda_expression.h"
 #include "binder/expression/node_expression.h"
@@ -9,7 +11,10 @@
 #include "binder/expression/subquery_expression.h"
 #include "common/exception/not_implemented.h"
 #include "function/arithmetic/vector_arithmetic_functions.h"
+#include "function/date/vector_date_functions.h"
+#include "function/list/vector_list_functions.h"
 #include "function/sequence/sequence_functions.h"
+#include "function/struct/vector_struct_functions.h"
 #include "function/uuid/vector_uuid_functions.h"
 
 using namespace lbug::common;
@@ -251,6 +256,75 @@ void PropertyExprCollector::visitNodeRelExpr(std::shared_ptr<Expression> expr) {
     }
 }
 
+static bool isScalarFunction(const Expression& expr, const char* name) {
+    return expr.expressionType == ExpressionType::FUNCTION &&
+           expr.constCast<ScalarFunctionExpression>().getFunction().name == name;
+}
+
+static struct_field_idx_t getStructFieldIdx(const Expression& structExtract) {
+    auto bindData = structExtract.constCast<ScalarFunctionExpression>().getBindData();
+    return bindData->cast<function::StructExtractBindData>().childIdx;
+}
+
+void StructFieldPathCollector::visitChildren(const Expression& expr) {
+    if (!isScalarFunction(expr, function::StructExtractFunctions::name)) {
+        ExpressionVisitor::visitChildren(expr);
+        return;
+    }
+    // Walk down a chain of field and list element accesses, e.g. a.addresses[1].city.
+    struct_field_path_t path;
+    auto current = expr.getChild(0);
+    path.push_back(getStructFieldIdx(expr));
+    while (true) {
+        if (isScalarFunction(*current, function::StructExtractFunctions::name)) {
+            path.push_back(getStructFieldIdx(*current));
+            current = current->getChild(0);
+        } else if (isScalarFunction(*current, function::ListExtractFunction::name) &&
+                   current->getChild(0)->getDataType().getPhysicalType() ==
+                       PhysicalTypeID::LIST) {
+            visit(current->getChild(1));
+            current = current->getChild(0);
+        } else {
+            break;
+        }
+    }
+    if (current->expressionType == ExpressionType::PROPERTY) {
+        std::reverse(path.begin(), path.end());
+        addFieldPath(*current, std::move(path));
+    } else {
+        visit(current);
+    }
+}
+
+void StructFieldPathCollector::visitSubqueryExpr(std::shared_ptr<Expression> expr) {
+    auto& subqueryExpr = expr->constCast<SubqueryExpression>();
+    if (subqueryExpr.hasWhereExpression()) {
+        visit(subqueryExpr.getWhereExpression());
+    }
+}
+
+void StructFieldPathCollector::visitPropertyExpr(std::shared_ptr<Expression> expr) {
+    addFieldPath(*expr, {});
+}
+
+void StructFieldPathCollector::visitNodeRelExpr(std::shared_ptr<Expression> expr) {
+    for (auto& property : expr->constCast<NodeOrRelExpression>().getPropertyExpressions()) {
+        addFieldPath(*property, {});
+    }
+}
+
+void StructFieldPathCollector::addFieldPath(const Expression& property, struct_field_path_t path) {
+    switch (property.getDataType().getLogicalTypeID()) {
+    case LogicalTypeID::STRUCT:
+    case LogicalTypeID::LIST:
+    case LogicalTypeID::ARRAY:
+        break;
+    default:
+        path.clear();
+    }
+    fieldPaths[property.getUniqueName()].push_back(std::move(path));
+}
+
 bool ConstantExpressionVisitor::needFold(const Expression& expr) {
     if (expr.expressionType == common::ExpressionType::LITERAL) {
         return false; // No need to fold a literal.
@@ -307,6 +381,17 @@ bool ConstantExpressionVisitor::visitFunction(const Expression& expr) {
     if (funcExpr.getFunction().name == function::RandFunction::name) {
         return false;
     }
+    // These read the transaction or sequence state at execution time. Folding them would bake the
+    // value of the binding transaction into cached and prepared plans.
+    if (funcExpr.getFunction().name == function::CurrValFunction::name) {
+        return false;
+    }
+    if (funcExpr.getFunction().name == function::CurrentDateFunction::name) {
+        return false;
+    }
+    if (funcExpr.getFunction().name == function::CurrentTimestampFunction::name) {
+        return false;
+    }
     return visitChildren(expr);
 }
 
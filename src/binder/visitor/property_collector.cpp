@@ -165,6 +165,12 @@ void PropertyCollector::collectProperties(const std::shared_ptr<Expression>& exp
     for (auto& expr : collector.getPropertyExprs()) {
         properties.insert(expr);
     }
+    auto fieldPathCollector = StructFieldPathCollector();
+    fieldPathCollector.visit(expression);
+    for (auto& [propertyName, paths] : fieldPathCollector.getFieldPaths()) {
+        auto& allPaths = structFieldPaths[propertyName];
+        allPaths.insert(allPaths.end(), paths.begin(), paths.end());
+    }
 }
 
 void PropertyCollector::collectPropertiesSkipNodeRel(
@@ -71,7 +71,17 @@ lbug_state lbug_query_result_get_query_summary(lbug_query_result* query_result,
 }
 
 bool lbug_query_result_has_next(lbug_query_result* query_result) {
-    return static_cast<QueryResult*>(query_result->_query_result)->hasNext();
+    auto result = static_cast<QueryResult*>(query_result->_query_result);
+    if (result->getType() != QueryResultType::STREAMING) {
+        return result->hasNext();
+    }
+    try {
+        return result->hasNext();
+    } catch (Exception& e) {
+        // A streaming result reports errors of the running query when it is read. The error is
+        // recorded on the result, see lbug_query_result_is_success.
+        return false;
+    }
 }
 
 bool lbug_query_result_has_next_query_result(lbug_query_result* query_result) {
@@ -20,7 +20,34 @@ SequenceData SequenceCatalogEntry::getSequenceData() {
     return sequenceData;
 }
 
-int64_t SequenceCatalogEntry::currVal() {
+// Values reserved by a transaction from a sequence with a CACHE size above 1. They are handed out
+// without going through the sequence, so only each reservation is recorded in the undo buffer and
+// the WAL.
+class SequenceValueCache final : public transaction::LocalCacheObject {
+public:
+    explicit SequenceValueCache(sequence_id_t sequenceID) : LocalCacheObject{getKey(sequenceID)} {}
+
+    static std::string getKey(sequence_id_t sequenceID) {
+        return std::format("sequence-{}", sequenceID);
+    }
+
+    std::mutex mtx;
+    std::vector<int64_t> values;
+    uint64_t nextIdx = 0;
+};
+
+int64_t SequenceCatalogEntry::currVal(transaction::Transaction* transaction) {
+    if (sequenceData.cacheSize > 1) {
+        auto& cacheManager = transaction->getLocalCacheManager();
+        const auto key = SequenceValueCache::getKey(getOID());
+        if (cacheManager.contains(key)) {
+            auto& cache = *cacheManager.at(key).cast<SequenceValueCache>();
+            std::lock_guard cacheLck(cache.mtx);
+            if (cache.nextIdx > 0) {
+                return cache.values[cache.nextIdx - 1];
+            }
+        }
+    }
     std::lock_guard lck(mtx);
     if (sequenceData.usageCount == 0) {
         throw CatalogException(
@@ -84,6 +111,10 @@ void SequenceCatalogEntry::nextKVal(transaction::Transaction* transaction, const
 void SequenceCatalogEntry::nextKVal(transaction::Transaction* transaction, const uint64_t& count,
     ValueVector& resultVector) {
     KU_ASSERT(count > 0);
+    if (sequenceData.cacheSize > 1) {
+        nextKValFromCache(transaction, count, resultVector);
+        return;
+    }
     SequenceRollbackData rollbackData{};
     {
         std::lock_guard lck(mtx);
@@ -96,6 +127,48 @@ void SequenceCatalogEntry::nextKVal(transaction::Transaction* transaction, const
     transaction->pushSequenceChange(this, count, rollbackData);
 }
 
+void SequenceCatalogEntry::nextKValFromCache(transaction::Transaction* transaction,
+    const uint64_t& count, ValueVector& resultVector) {
+    auto& cacheManager = transaction->getLocalCacheManager();
+    const auto key = SequenceValueCache::getKey(getOID());
+    if (!cacheManager.contains(key)) {
+        cacheManager.put(std::make_unique<SequenceValueCache>(getOID()));
+    }
+    auto& cache = *cacheManager.at(key).cast<SequenceValueCache>();
+    std::lock_guard cacheLck(cache.mtx);
+    for (auto i = 0ul; i < count; i++) {
+        if (cache.nextIdx == cache.values.size()) {
+            reserveValues(transaction, cache);
+        }
+        resultVector.setValue(i, cache.values[cache.nextIdx++]);
+    }
+}
+
+void SequenceCatalogEntry::reserveValues(transaction::Transaction* transaction,
+    SequenceValueCache& cache) {
+    cache.values.clear();
+    cache.nextIdx = 0;
+    SequenceRollbackData rollbackData{};
+    {
+        std::lock_guard lck(mtx);
+        rollbackData = SequenceRollbackData{sequenceData.usageCount, sequenceData.currVal};
+        for (auto i = 0ul; i < sequenceData.cacheSize; i++) {
+            try {
+                nextValNoLock();
+            } catch (const CatalogException&) {
+                // Reserve the values left before the sequence is exhausted. The next reservation
+                // reports the error.
+                if (cache.values.empty()) {
+                    throw;
+                }
+                break;
+            }
+            cache.values.push_back(sequenceData.currVal);
+        }
+    }
+    transaction->pushSequenceChange(this, cache.values.size(), rollbackData);
+}
+
 void SequenceCatalogEntry::rollbackVal(const uint64_t& usageCount, const int64_t& currVal) {
     std::lock_guard lck(mtx);
     sequenceData.usageCount = usageCount;
@@ -118,6 +191,8 @@ void SequenceCatalogEntry::serialize(Serializer& serializer) const {
     serializer.write(sequenceData.maxValue);
     serializer.writeDebuggingInfo("cycle");
     serializer.write(sequenceData.cycle);
+    serializer.writeDebuggingInfo("cacheSize");
+    serializer.write(sequenceData.cacheSize);
 }
 
 std::unique_ptr<SequenceCatalogEntry> SequenceCatalogEntry::deserialize(
@@ -130,6 +205,7 @@ std::unique_ptr<SequenceCatalogEntry> SequenceCatalogEntry::deserialize(
     int64_t minValue = 0;
     int64_t maxValue = 0;
     bool cycle = false;
+    uint64_t cacheSize = 1;
     deserializer.validateDebuggingInfo(debuggingInfo, "usageCount");
     deserializer.deserializeValue(usageCount);
     deserializer.validateDebuggingInfo(debuggingInfo, "currVal");
@@ -144,6 +220,8 @@ std::unique_ptr<SequenceCatalogEntry> SequenceCatalogEntry::deserialize(
     deserializer.deserializeValue(maxValue);
     deserializer.validateDebuggingInfo(debuggingInfo, "cycle");
     deserializer.deserializeValue(cycle);
+    deserializer.validateDebuggingInfo(debuggingInfo, "cacheSize");
+    deserializer.deserializeValue(cacheSize);
     auto result = std::make_unique<SequenceCatalogEntry>();
     result->sequenceData.usageCount = usageCount;
     result->sequenceData.currVal = currVal;
@@ -152,22 +230,27 @@ std::unique_ptr<SequenceCatalogEntry> SequenceCatalogEntry::deserialize(
     result->sequenceData.minValue = minValue;
     result->sequenceData.maxValue = maxValue;
     result->sequenceData.cycle = cycle;
+    result->sequenceData.cacheSize = cacheSize;
     return result;
 }
 
 std::string SequenceCatalogEntry::toCypher(const ToCypherInfo& /* info */) const {
+    const auto cacheOption =
+        sequenceData.cacheSize > 1 ? std::format(" CACHE {}", sequenceData.cacheSize) : "";
     return std::format("DROP SEQUENCE IF EXISTS `{}`;\n"
                        "CREATE SEQUENCE IF NOT EXISTS `{}` START {} INCREMENT {} MINVALUE {} "
-                       "MAXVALUE {} {} CYCLE;\n"
+                       "MAXVALUE {} {} CYCLE{};\n"
                        "RETURN nextval('{}');",
         getName(), getName(), sequenceData.currVal, sequenceData.increment, sequenceData.minValue,
-        sequenceData.maxValue, sequenceData.cycle ? "" : "NO", getName());
+        sequenceData.maxValue, sequenceData.cycle ? "" : "NO", cacheOption, getName());
 }
 
 BoundCreateSequenceInfo SequenceCatalogEntry::getBoundCreateSequenceInfo(bool isInternal) const {
-    return BoundCreateSequenceInfo(name, sequenceData.startValue, sequenceData.increment,
+    auto info = BoundCreateSequenceInfo(name, sequenceData.startValue, sequenceData.increment,
         sequenceData.minValue, sequenceData.maxValue, sequenceData.cycle,
         ConflictAction::ON_CONFLICT_THROW, isInternal);
+    info.cacheSize = sequenceData.cacheSize;
+    return info;
 }
 
 } // namespace catalog
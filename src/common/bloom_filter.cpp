@@ -0,0 +1,18 @@
+#include "common/bloom_filter.h"
+
+#include <algorithm>
+
+#include "common/utils.h"
+
+namespace lbug {
+namespace common {
+
+void BloomFilter::init(uint64_t numKeys) {
+    auto numWords = std::max<uint64_t>(numKeys * NUM_BITS_PER_KEY / 64, 1);
+    numWords = std::min(nextPowerOfTwo(numWords), MAX_NUM_WORDS);
+    words.assign(numWords, 0);
+    wordIdxMask = numWords - 1;
+}
+
+} // namespace common
+} // namespace lbug
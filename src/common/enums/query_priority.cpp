@@ -0,0 +1,40 @@
+#include "common/enums/query_priority.h"
+
+#include "common/assert.h"
+#include "common/exception/binder.h"
+#include "common/string_utils.h"
+#include <format>
+
+namespace lbug {
+namespace common {
+
+QueryPriority QueryPriorityUtils::fromString(const std::string& str) {
+    auto normalizedStr = StringUtils::getUpper(str);
+    if (normalizedStr == "LOW") {
+        return QueryPriority::LOW;
+    }
+    if (normalizedStr == "NORMAL") {
+        return QueryPriority::NORMAL;
+    }
+    if (normalizedStr == "HIGH") {
+        return QueryPriority::HIGH;
+    }
+    throw BinderException(std::format(
+        "Cannot parse {} as a query priority. Supported inputs are [LOW, NORMAL, HIGH]", str));
+}
+
+std::string QueryPriorityUtils::toString(QueryPriority priority) {
+    switch (priority) {
+    case QueryPriority::LOW:
+        return "LOW";
+    case QueryPriority::NORMAL:
+        return "NORMAL";
+    case QueryPriority::HIGH:
+        return "HIGH";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace common
+} // namespace lbug
@@ -3,18 +3,50 @@
 namespace lbug {
 namespace common {
 
+bool ThreadLimit::tryAcquire() {
+    auto value = numThreads.load();
+    while (value < maxNumThreads) {
+        if (numThreads.compare_exchange_weak(value, value + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool Task::registerThread() {
     lock_t lck{taskMtx};
-    if (!hasExceptionNoLock() && canRegisterNoLock()) {
+    if (!hasExceptionNoLock() && canRegisterNoLock() &&
+        (threadLimit == nullptr || threadLimit->tryAcquire())) {
         numThreadsRegistered++;
         return true;
     }
     return false;
 }
 
-void Task::deRegisterThreadAndFinalizeTask() {
+bool Task::tryYieldThread() {
     lock_t lck{taskMtx};
-    ++numThreadsFinished;
+    // Threads that finished without yielding have drained the task's work, so the remaining work
+    // is also taken care of by the threads that have not yielded.
+    if (numThreadsRegistered - numThreadsYielded > 1) {
+        numThreadsYielded++;
+        return true;
+    }
+    return false;
+}
+
+bool Task::deRegisterThreadAndFinalizeTask(bool yielded) {
+    lock_t lck{taskMtx};
+    if (threadLimit != nullptr) {
+        threadLimit->release();
+    }
+    if (yielded) {
+        // The thread stopped before the work of the task was drained, so it does not count as
+        // finished. At least one other registered thread has not yielded (see tryYieldThread()).
+        numThreadsRegistered--;
+        numThreadsYielded--;
+    } else {
+        ++numThreadsFinished;
+    }
     if (!hasExceptionNoLock() && isCompletedNoLock()) {
         try {
             finalize();
@@ -25,7 +57,9 @@ void Task::deRegisterThreadAndFinalizeTask() {
     if (isCompletedNoLock()) {
         lck.unlock();
         cv.notify_all();
+        return true;
     }
+    return false;
 }
 
 } // namespace common
@@ -1,5 +1,8 @@
 #include "common/task_system/task_scheduler.h"
 
+#include <algorithm>
+
+#include "common/exception/interrupt.h"
 #include "main/client_context.h"
 #include "main/database.h"
 #include "processor/processor.h"
@@ -13,6 +16,11 @@
 namespace lbug {
 namespace common {
 
+// Task the current thread is working on.
+static thread_local Task* currentTask = nullptr;
+// Whether the current thread gave its current task up (see TaskScheduler::shouldYield()).
+static thread_local bool yieldedCurrentTask = false;
+
 #ifndef __SINGLE_THREADED__
 
 #if defined(__APPLE__)
@@ -20,20 +28,24 @@ TaskScheduler::TaskScheduler(uint64_t numWorkerThreads, uint32_t threadQos)
 #else
 TaskScheduler::TaskScheduler(uint64_t numWorkerThreads)
 #endif
-    : stopWorkerThreads{false}, nextScheduledTaskID{0} {
+    : nextQueueIdx{0}, nextScheduledTaskID{0}, pushEpoch{0}, numParkedWorkers{0},
+      numStarvingTasks{}, numPendingYields{}, stopWorkerThreads{false} {
 #if defined(__APPLE__)
     this->threadQos = threadQos;
 #endif
+    for (auto n = 0u; n < std::max<uint64_t>(numWorkerThreads, 1); ++n) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
     for (auto n = 0u; n < numWorkerThreads; ++n) {
-        workerThreads.emplace_back([&] { runWorkerThread(); });
+        workerThreads.emplace_back([this, n] { runWorkerThread(n); });
     }
 }
 
 TaskScheduler::~TaskScheduler() {
-    lock_t lck{taskSchedulerMtx};
+    lock_t lck{parkMtx};
     stopWorkerThreads = true;
     lck.unlock();
-    cv.notify_all();
+    parkCV.notify_all();
     for (auto& thread : workerThreads) {
         thread.join();
     }
@@ -41,64 +53,230 @@ TaskScheduler::~TaskScheduler() {
 
 void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
     processor::ExecutionContext* context, bool launchNewWorkerThread) {
-    for (auto& dependency : task->children) {
-        scheduleTaskAndWaitOrError(dependency, context);
-        if (dependency->terminate()) {
-            return;
-        }
+    KU_ASSERT(context != nullptr || task->children.empty());
+    if (!scheduleDependenciesAndWaitOrError(*task, context)) {
+        return;
     }
     std::thread newWorkerThread;
+    // Note that newWorkerThread is not executing yet. However, we still call
+    // task->registerThread() function because the call in the next line will guarantee
+    // that the thread starts working on it. registerThread() function only increases the
+    // numThreadsRegistered field of the task, tt does not keep track of the thread ids or
+    // anything specific to the thread. It fails if the thread limit of the task is reached.
+    launchNewWorkerThread = launchNewWorkerThread && task->registerThread();
     if (launchNewWorkerThread) {
-        // Note that newWorkerThread is not executing yet. However, we still call
-        // task->registerThread() function because the call in the next line will guarantee
-        // that the thread starts working on it. registerThread() function only increases the
-        // numThreadsRegistered field of the task, tt does not keep track of the thread ids or
-        // anything specific to the thread.
-        task->registerThread();
         newWorkerThread = std::thread(runTask, task.get());
     }
     auto scheduledTask = pushTaskIntoQueue(task);
-    cv.notify_all();
-    std::unique_lock<std::mutex> taskLck{task->taskMtx, std::defer_lock};
+    waitForTask(*task, context);
+    if (launchNewWorkerThread) {
+        newWorkerThread.join();
+    }
+    if (task->hasException()) {
+        removeErroringTask(scheduledTask->ID);
+        std::rethrow_exception(task->getExceptionPtr());
+    }
+}
+
+void TaskScheduler::scheduleTaskOnNewThreadsAndWaitOrError(const std::shared_ptr<Task>& task,
+    processor::ExecutionContext* context) {
+    KU_ASSERT(context != nullptr);
+    if (!scheduleDependenciesAndWaitOrError(*task, context)) {
+        return;
+    }
+    // The task is never pushed into the queues, so all threads working on it are the ones launched
+    // here. Like in scheduleTaskAndWaitOrError(), they are registered before they start.
+    std::vector<std::thread> threads;
+    while (task->registerThread()) {
+        threads.emplace_back(runTask, task.get());
+    }
+    waitForTask(*task, context);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (task->hasException()) {
+        std::rethrow_exception(task->getExceptionPtr());
+    }
+}
+
+bool TaskScheduler::scheduleDependenciesAndWaitOrError(Task& task,
+    processor::ExecutionContext* context) {
+    if (task.hasIndependentChildren()) {
+        scheduleTasksConcurrentlyAndWaitOrError(task.children, context);
+    }
+    for (auto& dependency : task.children) {
+        if (!task.hasIndependentChildren()) {
+            scheduleTaskAndWaitOrError(dependency, context);
+        }
+        if (dependency->terminate()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TaskScheduler::waitForTask(Task& task, processor::ExecutionContext* context) {
+    std::unique_lock<std::mutex> taskLck{task.taskMtx, std::defer_lock};
     while (true) {
         taskLck.lock();
         bool timedWait = false;
         auto timeout = 0u;
-        if (task->isCompletedNoLock()) {
+        if (task.isCompletedNoLock()) {
             // Note: we do not remove completed tasks from the queue in this function. They will be
             // removed by the worker threads when they traverse down the queue for a task to work on
             // (see getTaskAndRegister()).
             taskLck.unlock();
             break;
         }
-        if (context->clientContext->hasTimeout()) {
+        if (context == nullptr) {
+            // Not interruptible: wait for all threads to finish the task.
+        } else if (context->clientContext->hasTimeout()) {
             timeout = context->clientContext->getTimeoutRemainingInMS();
             if (timeout == 0) {
                 context->clientContext->interrupt();
             } else {
                 timedWait = true;
             }
-        } else if (task->hasExceptionNoLock()) {
+        } else if (task.hasExceptionNoLock()) {
             // Interrupt tasks that errored, so other threads can stop working on them early.
             context->clientContext->interrupt();
         }
         if (timedWait) {
-            task->cv.wait_for(taskLck, std::chrono::milliseconds(timeout));
+            task.cv.wait_for(taskLck, std::chrono::milliseconds(timeout));
         } else {
-            task->cv.wait(taskLck);
+            task.cv.wait(taskLck);
         }
         taskLck.unlock();
     }
-    if (launchNewWorkerThread) {
-        newWorkerThread.join();
+}
+
+void TaskScheduler::scheduleTasksConcurrentlyAndWaitOrError(
+    const std::vector<std::shared_ptr<Task>>& tasks, processor::ExecutionContext* context) {
+    // The tasks and their dependencies are pushed by the worker threads as soon as they can run
+    // (see onTaskCompleted()), so that all of them share the workers without any extra threads.
+    auto group = TaskGroup(tasks[0]->parent, context);
+    lock_t lck{group.mtx};
+    for (auto& task : tasks) {
+        startTask(group, task);
+    }
+    while (group.numActiveTasks > 0) {
+        if (!context->clientContext->hasTimeout()) {
+            group.cv.wait(lck);
+            continue;
+        }
+        auto timeout = context->clientContext->getTimeoutRemainingInMS();
+        if (timeout == 0) {
+            context->clientContext->interrupt();
+            group.cv.wait(lck);
+        } else {
+            group.cv.wait_for(lck, std::chrono::milliseconds(timeout));
+        }
+    }
+    if (group.exceptionPtr != nullptr) {
+        std::rethrow_exception(group.exceptionPtr);
+    }
+}
+
+void TaskScheduler::startTask(TaskGroup& group, const std::shared_ptr<Task>& task) {
+    if (task->children.empty()) {
+        pushTask(group, task);
+    } else if (task->hasIndependentChildren()) {
+        for (auto& child : task->children) {
+            startTask(group, child);
+        }
+    } else {
+        startTask(group, task->children[0]);
+    }
+}
+
+void TaskScheduler::pushTask(TaskGroup& group, const std::shared_ptr<Task>& task) {
+    task->group = &group;
+    group.numActiveTasks++;
+    group.scheduledTaskIDs[task.get()] = pushTaskIntoQueue(task)->ID;
+}
+
+static std::shared_ptr<Task> getSharedTask(Task* task) {
+    for (auto& child : task->parent->children) {
+        if (child.get() == task) {
+            return child;
+        }
     }
+    KU_UNREACHABLE;
+}
+
+void TaskScheduler::completeTask(TaskGroup& group, Task* task) {
+    auto parent = task->parent;
+    if (group.exceptionPtr != nullptr || parent == group.parent) {
+        return;
+    }
+    auto numCompletedChildren = ++group.numCompletedChildren[parent];
+    if (parent->hasIndependentChildren()) {
+        if (numCompletedChildren < parent->children.size()) {
+            return;
+        }
+        // Like scheduleTaskAndWaitOrError, skip the parent if a dependency asks to terminate.
+        for (auto& child : parent->children) {
+            if (child->terminate()) {
+                completeTask(group, parent);
+                return;
+            }
+        }
+    } else {
+        if (task->terminate()) {
+            completeTask(group, parent);
+            return;
+        }
+        if (numCompletedChildren < parent->children.size()) {
+            startTask(group, parent->children[numCompletedChildren]);
+            return;
+        }
+    }
+    pushTask(group, getSharedTask(parent));
+}
+
+static bool isInterrupt(const std::exception_ptr& exceptionPtr) {
+    try {
+        std::rethrow_exception(exceptionPtr);
+    } catch (InterruptException&) {
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+void TaskScheduler::onTaskCompleted(Task* task) {
+    auto& group = *task->group;
+    lock_t lck{group.mtx};
+    group.numActiveTasks--;
     if (task->hasException()) {
-        removeErroringTask(scheduledTask->ID);
-        std::rethrow_exception(task->getExceptionPtr());
+        removeErroringTask(group.scheduledTaskIDs.at(task));
+        // The other tasks of the group are interrupted, so prefer the error that caused it.
+        auto exceptionPtr = task->getExceptionPtr();
+        if (group.exceptionPtr == nullptr ||
+            (isInterrupt(group.exceptionPtr) && !isInterrupt(exceptionPtr))) {
+            group.exceptionPtr = exceptionPtr;
+        }
+        group.context->clientContext->interrupt();
+    } else {
+        completeTask(group, task);
+    }
+    if (group.numActiveTasks == 0) {
+        // Notify under the lock, because the group is destroyed once its waiting thread returns.
+        group.cv.notify_all();
     }
 }
 
-void TaskScheduler::runWorkerThread() {
+// Index of the queue owned by the current thread, if it is a worker thread.
+static thread_local uint64_t currentWorkerIdx = UINT64_MAX;
+// Priority of the starving tasks the current thread yielded its task for, until it registers to a
+// new task.
+static thread_local uint64_t pendingYieldPriorityIdx = UINT64_MAX;
+// Random engine of the current thread, if it is a worker thread.
+static thread_local std::minstd_rand* currentRandomEngine = nullptr;
+// Whether the current thread runs a starving task on top of its own (see runStarvingTask()).
+static thread_local bool runningStarvingTask = false;
+
+void TaskScheduler::runWorkerThread(uint64_t workerIdx) {
 #if defined(__APPLE__)
     qos_class_t qosClass = (qos_class_t)threadQos;
     if (qosClass != QOS_CLASS_DEFAULT && qosClass != QOS_CLASS_UNSPECIFIED) {
@@ -106,40 +284,237 @@ void TaskScheduler::runWorkerThread() {
         KU_UNUSED(pthreadQosStatus);
     }
 #endif
-    std::unique_lock<std::mutex> lck{taskSchedulerMtx, std::defer_lock};
-    std::exception_ptr exceptionPtr = nullptr;
-    std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
+    currentWorkerIdx = workerIdx;
+    std::minstd_rand randomEngine(workerIdx + 1);
+    currentRandomEngine = &randomEngine;
     while (true) {
-        // Warning: Threads acquire a global lock (using taskSchedulerMutex) right before
-        // deregistering themselves from a task (and they immediately register themselves for
-        // another task without releasing the lock). This acquire-right-before-deregistering ensures
-        // that all writes that were done by threads in Task_j happen before a Task_{j+1} which
-        // depends on Task_j can start. That's because before Task_{j+1} can start, each thread T_i
-        // working on Task_j will need to deregister itself using the global lock. Therefore, by the
-        // time any thread gets to start on Task_{j+1}, all writes made to Task_j by T_i will become
-        // globally visible because T_i grabbed the global lock before deregistering (and without
-        // T_i deregistering Task_{j+1} cannot start).
-        lck.lock();
-        if (scheduledTask != nullptr) {
-            if (exceptionPtr != nullptr) {
-                scheduledTask->task->setException(exceptionPtr);
-                exceptionPtr = nullptr;
+        // Note: there is no global lock around deregistering from a task any more. Writes made by
+        // the threads working on Task_j still become visible to Task_{j+1} which depends on it:
+        // each thread deregisters under the lock of Task_j, the thread scheduling Task_{j+1}
+        // observes the completion of Task_j under the same lock before pushing Task_{j+1}, and
+        // workers take Task_{j+1} from a queue under the lock of that queue.
+        auto epoch = pushEpoch.load();
+        auto scheduledTask = getTaskAndRegister(workerIdx, randomEngine);
+        if (pendingYieldPriorityIdx != UINT64_MAX) {
+            numPendingYields[pendingYieldPriorityIdx]--;
+            pendingYieldPriorityIdx = UINT64_MAX;
+        }
+        if (scheduledTask == nullptr) {
+            lock_t lck{parkMtx};
+            numParkedWorkers++;
+            parkCV.wait(lck, [&] { return stopWorkerThreads || pushEpoch.load() != epoch; });
+            numParkedWorkers--;
+            if (stopWorkerThreads) {
+                return;
             }
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
-            scheduledTask = nullptr;
-        }
-        cv.wait(lck, [&] {
-            scheduledTask = getTaskAndRegister();
-            return scheduledTask != nullptr || stopWorkerThreads;
-        });
-        lck.unlock();
-        if (stopWorkerThreads) {
-            return;
+            continue;
+        }
+        auto task = scheduledTask->task.get();
+        if (canRegisterThread(*task)) {
+            // A push wakes a single worker, which passes the wake-up on while the task accepts
+            // more threads.
+            wakeParkedWorker();
+        }
+        if (runTask(task) && task->group != nullptr) {
+            onTaskCompleted(task);
+        }
+    }
+}
+
+static uint64_t getPriorityIdx(const Task& task) {
+    return static_cast<uint64_t>(task.getPriority());
+}
+
+bool TaskScheduler::shouldYield() {
+    auto task = currentTask;
+    // Only worker threads look for starving tasks after giving up their task. A thread running a
+    // starving task on top of its own finishes its share of it first.
+    if (task == nullptr || currentWorkerIdx >= queues.size() || runningStarvingTask) {
+        return false;
+    }
+    for (auto priorityIdx = getPriorityIdx(*task); priorityIdx < numStarvingTasks.size();
+         ++priorityIdx) {
+        // Each starving task is claimed by at most one yielding thread, which takes it in
+        // getTaskAndRegister().
+        auto& numPending = numPendingYields[priorityIdx];
+        auto value = numPending.load();
+        while (value < numStarvingTasks[priorityIdx].load()) {
+            if (!numPending.compare_exchange_weak(value, value + 1)) {
+                continue;
+            }
+            if (task->tryYieldThread()) {
+                yieldedCurrentTask = true;
+                pendingYieldPriorityIdx = priorityIdx;
+                return true;
+            }
+            // No other thread is left on the task, so leave the starving task to another thread.
+            numPending--;
+            return false;
+        }
+    }
+    return false;
+}
+
+bool TaskScheduler::runStarvingTask() {
+    auto task = currentTask;
+    if (task == nullptr || currentWorkerIdx >= queues.size() || runningStarvingTask) {
+        return false;
+    }
+    for (auto priorityIdx = getPriorityIdx(*task); priorityIdx < numStarvingTasks.size();
+         ++priorityIdx) {
+        // Claim a starving task like shouldYield() does, so that it is not also claimed by a
+        // yielding thread.
+        auto& numPending = numPendingYields[priorityIdx];
+        auto value = numPending.load();
+        while (value < numStarvingTasks[priorityIdx].load()) {
+            if (!numPending.compare_exchange_weak(value, value + 1)) {
+                continue;
+            }
+            auto scheduledTask = findTaskAndRegister(currentWorkerIdx, *currentRandomEngine,
+                static_cast<QueryPriority>(priorityIdx), true /* starvingOnly */);
+            if (scheduledTask != nullptr && scheduledTask->task->starving.exchange(false)) {
+                numStarvingTasks[getPriorityIdx(*scheduledTask->task)]--;
+            }
+            numPending--;
+            if (scheduledTask == nullptr) {
+                return false;
+            }
+            auto yielded = yieldedCurrentTask;
+            runningStarvingTask = true;
+            auto starvingTask = scheduledTask->task.get();
+            if (runTask(starvingTask) && starvingTask->group != nullptr) {
+                onTaskCompleted(starvingTask);
+            }
+            runningStarvingTask = false;
+            currentTask = task;
+            yieldedCurrentTask = yielded;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
+    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
+    lock_t taskLck{task->taskMtx};
+    // A task whose query already uses all the threads it may use does not take threads from other
+    // tasks.
+    if (task->numThreadsRegistered == 0 && !task->isThreadLimitReached()) {
+        task->starving = true;
+        numStarvingTasks[getPriorityIdx(*task)]++;
+    }
+    taskLck.unlock();
+    // Tasks pushed by a worker, e.g. from within a running task, stay in its own queue.
+    auto queueIdx = currentWorkerIdx < queues.size() ? currentWorkerIdx :
+                                                       nextQueueIdx++ % queues.size();
+    auto& queue = *queues[queueIdx];
+    lock_t queueLck{queue.mtx};
+    queue.tasks.push_back(scheduledTask);
+    queueLck.unlock();
+    wakeParkedWorker();
+    return scheduledTask;
+}
+
+void TaskScheduler::wakeParkedWorker() {
+    // A parking worker counts itself as parked before it checks pushEpoch. So after pushEpoch is
+    // bumped, either the worker sees the new epoch or the count includes it. Bumping the epoch
+    // also makes sure that the woken worker does not go back to sleep.
+    pushEpoch++;
+    if (numParkedWorkers.load() == 0) {
+        return;
+    }
+    // Taking the lock makes sure that a worker which is about to wait is already waiting.
+    lock_t lck{parkMtx};
+    lck.unlock();
+    parkCV.notify_one();
+}
+
+bool TaskScheduler::canRegisterThread(Task& task) {
+    lock_t lck{task.taskMtx};
+    return !task.hasExceptionNoLock() && task.canRegisterNoLock();
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(uint64_t workerIdx,
+    std::minstd_rand& randomEngine) {
+    std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
+    for (auto priorityIdx = numStarvingTasks.size(); priorityIdx-- > 0;) {
+        if (numStarvingTasks[priorityIdx].load() > 0) {
+            scheduledTask = findTaskAndRegister(workerIdx, randomEngine,
+                static_cast<QueryPriority>(priorityIdx), true /* starvingOnly */);
+            if (scheduledTask != nullptr) {
+                break;
+            }
+        }
+    }
+    if (scheduledTask == nullptr) {
+        scheduledTask = findTaskAndRegister(workerIdx, randomEngine, QueryPriority::LOW,
+            false /* starvingOnly */);
+    }
+    if (scheduledTask != nullptr && scheduledTask->task->starving.exchange(false)) {
+        numStarvingTasks[getPriorityIdx(*scheduledTask->task)]--;
+    }
+    return scheduledTask;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::findTaskAndRegister(uint64_t workerIdx,
+    std::minstd_rand& randomEngine, QueryPriority minPriority, bool starvingOnly) {
+    if (auto scheduledTask = getTaskAndRegister(*queues[workerIdx], minPriority, starvingOnly)) {
+        return scheduledTask;
+    }
+    auto numQueues = queues.size();
+    auto startIdx = randomEngine() % numQueues;
+    for (auto i = 0u; i < numQueues; ++i) {
+        auto queueIdx = (startIdx + i) % numQueues;
+        if (queueIdx == workerIdx) {
+            continue;
         }
-        try {
-            scheduledTask->task->run();
-        } catch (std::exception& e) {
-            exceptionPtr = std::current_exception();
+        if (auto scheduledTask = getTaskAndRegister(*queues[queueIdx], minPriority, starvingOnly)) {
+            return scheduledTask;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(WorkerQueue& queue,
+    QueryPriority minPriority, bool starvingOnly) {
+    lock_t lck{queue.mtx};
+    auto it = queue.tasks.begin();
+    while (it != queue.tasks.end()) {
+        auto task = (*it)->task;
+        if (task->getPriority() < minPriority || (starvingOnly && !task->starving)) {
+            ++it;
+            continue;
+        }
+        if (!task->registerThread()) {
+            // If we cannot register for a thread it is because of three possibilities:
+            // (i) maximum number of threads have registered for task and the task is completed
+            // without an exception; or (ii) same as (i) but the task has not yet successfully
+            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
+            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
+            // manually removed.
+            if (task->isCompletedSuccessfully()) { // option (i)
+                it = queue.tasks.erase(it);
+            } else { // option (ii) or (iii): keep the task in the queue.
+                ++it;
+            }
+        } else {
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
+    for (auto& queue : queues) {
+        lock_t lck{queue->mtx};
+        for (auto it = queue->tasks.begin(); it != queue->tasks.end(); ++it) {
+            if (scheduledTaskID == (*it)->ID) {
+                if ((*it)->task->starving.exchange(false)) {
+                    numStarvingTasks[getPriorityIdx(*(*it)->task)]--;
+                }
+                queue->tasks.erase(it);
+                return;
+            }
         }
     }
 }
@@ -167,7 +542,6 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
-#endif
 
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
     lock_t lck{taskSchedulerMtx};
@@ -212,13 +586,19 @@ void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
     }
 }
 
-void TaskScheduler::runTask(Task* task) {
+#endif
+
+bool TaskScheduler::runTask(Task* task) {
+    currentTask = task;
+    yieldedCurrentTask = false;
     try {
         task->run();
-        task->deRegisterThreadAndFinalizeTask();
+        currentTask = nullptr;
+        return task->deRegisterThreadAndFinalizeTask(yieldedCurrentTask);
     } catch (std::exception& e) {
+        currentTask = nullptr;
         task->setException(std::current_exception());
-        task->deRegisterThreadAndFinalizeTask();
+        return task->deRegisterThreadAndFinalizeTask();
     }
 }
 
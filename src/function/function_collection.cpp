@@ -232,7 +232,7 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(DiskSizeInfoFunction), TABLE_FUNCTION(ShowLoadedExtensionsFunction),
         TABLE_FUNCTION(ShowOfficialExtensionsFunction), TABLE_FUNCTION(ShowIndexesFunction),
         TABLE_FUNCTION(ShowProjectedGraphsFunction), TABLE_FUNCTION(ProjectedGraphInfoFunction),
-        TABLE_FUNCTION(ShowMacrosFunction),
+        TABLE_FUNCTION(ShowMacrosFunction), TABLE_FUNCTION(QueryCacheInfoFunction),
 
         // Standalone Table functions
         STANDALONE_TABLE_FUNCTION(LocalCacheArrayColumnFunction),
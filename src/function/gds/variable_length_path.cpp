@@ -63,7 +63,10 @@ public:
         chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
             // We should always update the nbrID in variable length joins
             auto nbrNodeID = neighbors[i];
-            auto edgeID = propertyVectors[0]->template getValue<relID_t>(i);
+            // Rel IDs are not scanned if neither path nor trail semantic needs them.
+            auto edgeID = propertyVectors.empty() ?
+                              relID_t{} :
+                              propertyVectors[0]->template getValue<relID_t>(i);
             if (!block->hasSpace()) {
                 block = bfsGraphManager->getCurrentGraph()->addNewBlock();
             }
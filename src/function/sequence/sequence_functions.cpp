@@ -19,7 +19,7 @@ struct CurrVal {
         auto sequenceName = input.getAsString();
         auto sequenceEntry =
             catalog->getSequenceEntry(transaction, sequenceName, ctx->useInternalCatalogEntry());
-        result.setValue(0, sequenceEntry->currVal());
+        result.setValue(0, sequenceEntry->currVal(transaction));
     }
 };
 
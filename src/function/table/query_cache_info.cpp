@@ -0,0 +1,65 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+
+namespace lbug {
+namespace function {
+
+struct QueryCacheInfoBindData final : TableFuncBindData {
+    uint64_t capacity;
+    uint64_t numEntries;
+    uint64_t numHits;
+    uint64_t numMisses;
+
+    QueryCacheInfoBindData(uint64_t capacity, uint64_t numEntries, uint64_t numHits,
+        uint64_t numMisses, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), 1}, capacity{capacity}, numEntries{numEntries},
+          numHits{numHits}, numMisses{numMisses} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<QueryCacheInfoBindData>(capacity, numEntries, numHits, numMisses,
+            columns);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+    const TableFuncInput& input, common::DataChunk& output) {
+    KU_ASSERT(output.getNumValueVectors() == 4);
+    auto bindData = input.bindData->constPtrCast<QueryCacheInfoBindData>();
+    output.getValueVectorMutable(0).setValue<uint64_t>(0, bindData->capacity);
+    output.getValueVectorMutable(1).setValue<uint64_t>(0, bindData->numEntries);
+    output.getValueVectorMutable(2).setValue<uint64_t>(0, bindData->numHits);
+    output.getValueVectorMutable(3).setValue<uint64_t>(0, bindData->numMisses);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto& queryCache = context->getQueryCache();
+    std::vector<common::LogicalType> returnTypes;
+    for (auto i = 0u; i < 4; ++i) {
+        returnTypes.emplace_back(common::LogicalType::UINT64());
+    }
+    auto returnColumnNames =
+        std::vector<std::string>{"capacity", "num_entries", "num_hits", "num_misses"};
+    returnColumnNames =
+        TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
+    return std::make_unique<QueryCacheInfoBindData>(queryCache.getCapacity(),
+        queryCache.getNumEntries(), queryCache.getNumHits(), queryCache.getNumMisses(), columns);
+}
+
+function_set QueryCacheInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace lbug
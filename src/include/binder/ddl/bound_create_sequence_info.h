@@ -15,6 +15,7 @@ struct BoundCreateSequenceInfo {
     int64_t minValue;
     int64_t maxValue;
     bool cycle;
+    uint64_t cacheSize = 1;
     common::ConflictAction onConflict;
     bool hasParent = false;
     bool isInternal;
@@ -31,7 +32,8 @@ private:
     BoundCreateSequenceInfo(const BoundCreateSequenceInfo& other)
         : sequenceName{other.sequenceName}, startWith{other.startWith}, increment{other.increment},
           minValue{other.minValue}, maxValue{other.maxValue}, cycle{other.cycle},
-          onConflict{other.onConflict}, hasParent{other.hasParent}, isInternal{other.isInternal} {}
+          cacheSize{other.cacheSize}, onConflict{other.onConflict}, hasParent{other.hasParent},
+          isInternal{other.isInternal} {}
 };
 
 } // namespace binder
@@ -16,7 +16,19 @@ public:
 
     void cast(const common::LogicalType& type) override;
 
-    common::Value getValue() const { return value; }
+    std::string getParameterName() const { return parameterName; }
+
+    // Reads the value while compiling the statement. A plan that depends on the value this way
+    // (e.g. LIMIT push down) cannot be reused with a different value.
+    common::Value getValue() const {
+        valueUsedInCompilation = true;
+        return value;
+    }
+    bool isValueUsedInCompilation() const { return valueUsedInCompilation; }
+    // Reads the value when evaluating the parameter at runtime.
+    const common::Value& getRuntimeValue() const { return value; }
+    // Substitutes a value of the same type when a cached plan is reused.
+    void setValue(common::Value newValue);
 
 private:
     std::string toStringInternal() const override { return "$" + parameterName; }
@@ -25,6 +37,7 @@ private:
 private:
     std::string parameterName;
     common::Value value;
+    mutable bool valueUsedInCompilation = false;
 };
 
 } // namespace binder
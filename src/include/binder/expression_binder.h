@@ -17,6 +17,7 @@ namespace binder {
 
 class Binder;
 struct CaseAlternative;
+class ParameterExpression;
 
 struct ExpressionBinderConfig {
     // If a property is not in projection list but required in order by after aggregation,
@@ -138,6 +139,9 @@ public:
     getKnownParameters() const {
         return knownParameters;
     }
+    const std::vector<std::shared_ptr<ParameterExpression>>& getParameterExpressions() const {
+        return parameterExpressions;
+    }
 
     std::string getUniqueName(const std::string& name) const;
 
@@ -148,6 +152,8 @@ private:
     main::ClientContext* context;
     std::unordered_set<std::string> unknownParameters;
     std::unordered_map<std::string, std::shared_ptr<common::Value>> knownParameters;
+    // Bound expressions of known parameters.
+    std::vector<std::shared_ptr<ParameterExpression>> parameterExpressions;
     ExpressionBinderConfig config;
 };
 
@@ -86,6 +86,29 @@ private:
     expression_vector expressions;
 };
 
+// Collect the struct fields read from each property, keyed by property unique name. A property
+// referenced other than through STRUCT_EXTRACT (optionally through LIST_EXTRACT) is recorded with an
+// empty path, i.e. all of its fields are read.
+class StructFieldPathCollector final : public ExpressionVisitor {
+public:
+    using field_paths_map_t =
+        std::unordered_map<std::string, std::vector<common::struct_field_path_t>>;
+
+    field_paths_map_t getFieldPaths() const { return fieldPaths; }
+
+protected:
+    void visitChildren(const Expression& expr) override;
+    void visitSubqueryExpr(std::shared_ptr<Expression> expr) override;
+    void visitPropertyExpr(std::shared_ptr<Expression> expr) override;
+    void visitNodeRelExpr(std::shared_ptr<Expression> expr) override;
+
+private:
+    void addFieldPath(const Expression& property, common::struct_field_path_t path);
+
+private:
+    field_paths_map_t fieldPaths;
+};
+
 class ConstantExpressionVisitor {
 public:
     static bool needFold(const Expression& expr);
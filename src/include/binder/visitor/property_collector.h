@@ -1,6 +1,7 @@
 #pragma once
 
 #include "binder/bound_statement_visitor.h"
+#include "binder/expression_visitor.h"
 
 namespace lbug {
 namespace binder {
@@ -9,6 +10,10 @@ namespace binder {
 class LBUG_API PropertyCollector final : public BoundStatementVisitor {
 public:
     expression_vector getProperties() const;
+    // Struct fields read from each collected property. See StructFieldPathCollector.
+    StructFieldPathCollector::field_paths_map_t getStructFieldPaths() const {
+        return structFieldPaths;
+    }
 
     // Skip collecting node/rel properties if they are in WITH projection list.
     // See with_clause_projection_rewriter for more details.
@@ -36,6 +41,7 @@ private:
 
 private:
     expression_set properties;
+    StructFieldPathCollector::field_paths_map_t structFieldPaths;
 };
 
 } // namespace binder
@@ -391,6 +391,16 @@ LBUG_C_API lbug_state lbug_connection_get_max_num_thread_for_exec(lbug_connectio
  */
 LBUG_C_API lbug_state lbug_connection_query(lbug_connection* connection, const char* query,
     lbug_query_result* out_query_result);
+/**
+ * @brief Executes the given query and returns a result whose tuples are produced while they are
+ * read. The result can be read only once and is closed by the next query on the connection.
+ * @param connection The connection instance to execute the query.
+ * @param query The query to execute.
+ * @param[out] out_query_result The output parameter that will hold the result of the query.
+ * @return The state indicating the success or failure of the operation.
+ */
+LBUG_C_API lbug_state lbug_connection_query_as_stream(lbug_connection* connection,
+    const char* query, lbug_query_result* out_query_result);
 /**
  * @brief Prepares the given query and returns the prepared statement.
  * @param connection The connection instance to prepare the query.
@@ -681,6 +691,9 @@ LBUG_C_API lbug_state lbug_query_result_get_query_summary(lbug_query_result* que
     lbug_query_summary* out_query_summary);
 /**
  * @brief Returns true if we have not consumed all tuples in the query result, false otherwise.
+ * For a result returned by lbug_connection_query_as_stream(), errors of the running query are
+ * raised while the result is read. In that case this function returns false, and
+ * lbug_query_result_is_success() and lbug_query_result_get_error_message() report the error.
  * @param query_result The query result instance to check.
  */
 LBUG_C_API bool lbug_query_result_has_next(lbug_query_result* query_result);
@@ -220,8 +220,12 @@ public:
     // Drop graph entry with name.
     void dropGraph(transaction::Transaction* transaction, const std::string& name);
 
-    void incrementVersion() { version++; }
+    void incrementVersion() {
+        version++;
+        changeCount++;
+    }
     uint64_t getVersion() const { return version; }
+    uint64_t getChangeCount() const { return changeCount; }
     bool changedSinceLastCheckpoint() const { return version != 0; }
     void resetVersion() { version = 0; }
 
@@ -276,6 +280,9 @@ private:
     // incremented whenever a change is made to the catalog
     // reset to 0 at the end of each checkpoint
     uint64_t version;
+    // incremented together with version but never reset. Used to detect catalog changes across
+    // checkpoints, e.g. by cached plans of prepared statements.
+    uint64_t changeCount = 0;
     std::string catalogName;
     std::unique_ptr<storage::StorageManager> storageManager;
 };
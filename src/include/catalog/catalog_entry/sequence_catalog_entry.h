@@ -32,7 +32,7 @@ struct SequenceData {
     explicit SequenceData(const binder::BoundCreateSequenceInfo& info)
         : usageCount{0}, currVal{info.startWith}, increment{info.increment},
           startValue{info.startWith}, minValue{info.minValue}, maxValue{info.maxValue},
-          cycle{info.cycle} {}
+          cycle{info.cycle}, cacheSize{info.cacheSize} {}
 
     uint64_t usageCount;
     int64_t currVal;
@@ -41,9 +41,13 @@ struct SequenceData {
     int64_t minValue;
     int64_t maxValue;
     bool cycle;
+    // Number of values a transaction reserves at once. Values reserved but not used by the
+    // transaction are skipped.
+    uint64_t cacheSize = 1;
 };
 
 class CatalogSet;
+class SequenceValueCache;
 class LBUG_API SequenceCatalogEntry final : public CatalogEntry {
 public:
     //===--------------------------------------------------------------------===//
@@ -62,7 +66,7 @@ public:
     //===--------------------------------------------------------------------===//
     // sequence functions
     //===--------------------------------------------------------------------===//
-    int64_t currVal();
+    int64_t currVal(transaction::Transaction* transaction);
     void nextKVal(transaction::Transaction* transaction, const uint64_t& count);
     void nextKVal(transaction::Transaction* transaction, const uint64_t& count,
         common::ValueVector& resultVector);
@@ -85,6 +89,9 @@ public:
 
 private:
     void nextValNoLock();
+    void nextKValFromCache(transaction::Transaction* transaction, const uint64_t& count,
+        common::ValueVector& resultVector);
+    void reserveValues(transaction::Transaction* transaction, SequenceValueCache& cache);
 
 private:
     std::mutex mtx;
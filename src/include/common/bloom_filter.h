@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace lbug {
+namespace common {
+
+// A blocked Bloom filter over hash values. All bits of a key are set within a single 64-bit word,
+// so a lookup costs one memory access. The filter is built by a single thread and is read-only
+// afterwards.
+class BloomFilter {
+public:
+    BloomFilter() = default;
+    DELETE_BOTH_COPY(BloomFilter);
+
+    // Allocates the filter for the given number of keys and clears all bits.
+    void init(uint64_t numKeys);
+    bool isInitialized() const { return !words.empty(); }
+
+    void insert(hash_t hash) { words[getWordIdx(hash)] |= getWordMask(hash); }
+    // Returns false only if the hash has never been inserted.
+    bool mayContain(hash_t hash) const {
+        const auto mask = getWordMask(hash);
+        return (words[getWordIdx(hash)] & mask) == mask;
+    }
+
+private:
+    uint64_t getWordIdx(hash_t hash) const { return hash & wordIdxMask; }
+    // The bits within the word are taken from the upper half of the hash, which is not used to
+    // pick the word.
+    static uint64_t getWordMask(hash_t hash) {
+        return (1ull << ((hash >> 32) & 63)) | (1ull << ((hash >> 38) & 63)) |
+               (1ull << ((hash >> 44) & 63));
+    }
+
+public:
+    // With three bits set per key, 16 bits per key give a false positive rate of about 2%.
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+    // Caps the filter at 32MB. Larger builds get a higher false positive rate instead.
+    static constexpr uint64_t MAX_NUM_WORDS = 1ull << 22;
+
+private:
+    std::vector<uint64_t> words;
+    uint64_t wordIdxMask = 0;
+};
+
+} // namespace common
+} // namespace lbug
@@ -19,6 +19,9 @@ constexpr double DEFAULT_HT_LOAD_FACTOR = 1.5;
 constexpr uint64_t THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS = 500;
 
 constexpr uint64_t DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS = 5000000;
+// Number of times an auto checkpoint can be deferred to other active transactions before new
+// transactions are held back until it has run.
+constexpr uint64_t MAX_DEFERRED_AUTO_CHECKPOINTS = 8;
 
 // Note that some places use std::bit_ceil to calculate resizes,
 // which won't work for values other than 2. If this is changed, those will need to be updated
@@ -79,6 +82,10 @@ struct StorageConstants {
     static constexpr double LEAF_HIGH_CSR_DENSITY = 1.0;
 
     static constexpr uint64_t MAX_NUM_ROWS_IN_TABLE = static_cast<uint64_t>(1) << 62;
+
+    // With WAL compression enabled, the records of a committed transaction are compressed together
+    // if they take up at least this many bytes. Smaller transactions barely shrink.
+    static constexpr uint64_t WAL_COMPRESSION_THRESHOLD = 4096;
 };
 
 struct TableOptionConstants {
@@ -163,6 +170,10 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // A query is re-planned only if a misestimated subplan produces or was expected to produce at
+    // least this many tuples, and at most this many times.
+    static constexpr uint64_t MIN_CARDINALITY_TO_REOPTIMIZE = 10000;
+    static constexpr uint64_t MAX_NUM_REOPTIMIZATIONS = 2;
 };
 
 struct OrderByConstants {
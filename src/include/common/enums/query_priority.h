@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace lbug {
+namespace common {
+
+enum class QueryPriority : uint8_t {
+    LOW = 0,
+    NORMAL = 1,
+    HIGH = 2,
+};
+
+struct QueryPriorityUtils {
+    static constexpr uint64_t NUM_PRIORITIES = 3;
+
+    static QueryPriority fromString(const std::string& str);
+    static std::string toString(QueryPriority priority);
+};
+
+} // namespace common
+} // namespace lbug
@@ -1,16 +1,36 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <vector>
 
 #include "common/api.h"
+#include "common/enums/query_priority.h"
 
 namespace lbug {
 namespace common {
 
 using lock_t = std::unique_lock<std::mutex>;
 
+struct TaskGroup;
+
+// Caps the number of threads working on a set of tasks at the same time, on top of the cap of each
+// task. E.g. the concurrent pipelines of a query share one limit.
+class LBUG_API ThreadLimit {
+public:
+    explicit ThreadLimit(uint64_t maxNumThreads) : maxNumThreads{maxNumThreads}, numThreads{0} {}
+
+    bool tryAcquire();
+    void release() { numThreads--; }
+
+    bool isReached() const { return numThreads.load() >= maxNumThreads; }
+
+private:
+    uint64_t maxNumThreads;
+    std::atomic<uint64_t> numThreads;
+};
+
 /**
  * Task represents a task that can be executed by multiple threads in the TaskScheduler. Task is a
  * virtual class. Users of TaskScheduler need to extend the Task class and implement at
@@ -58,9 +78,29 @@ public:
 
     void setSingleThreadedTask() { maxNumThreads = 1; }
 
+    // Threads only register to the task while the limit, which must outlive the task, is not
+    // reached.
+    void setThreadLimit(ThreadLimit* limit) { threadLimit = limit; }
+    bool isThreadLimitReached() const { return threadLimit != nullptr && threadLimit->isReached(); }
+
+    // Children that do not depend on each other can be scheduled at the same time.
+    void setIndependentChildren() { independentChildren = true; }
+    bool hasIndependentChildren() const { return independentChildren; }
+
+    // Workers prefer tasks of higher priority, and threads working on a task yield to starving
+    // tasks of the same or higher priority (see TaskScheduler::shouldYield()).
+    void setPriority(QueryPriority priority_) { priority = priority_; }
+    QueryPriority getPriority() const { return priority; }
+
     bool registerThread();
 
-    void deRegisterThreadAndFinalizeTask();
+    // Returns true if the calling thread is the one that completed the task. A thread that yielded
+    // is deregistered without finishing the task, so threads can register to the task again.
+    bool deRegisterThreadAndFinalizeTask(bool yielded = false);
+
+    // Marks the calling thread as yielding, i.e. it stops grabbing work of this task, if at least
+    // one other registered thread keeps working on the task.
+    bool tryYieldThread();
 
     void setException(const std::exception_ptr& exceptionPtr) {
         lock_t lck{taskMtx};
@@ -101,6 +141,15 @@ protected:
     uint64_t maxNumThreads, numThreadsFinished, numThreadsRegistered;
     std::exception_ptr exceptionsPtr;
     uint64_t ID;
+    bool independentChildren = false;
+    QueryPriority priority = QueryPriority::NORMAL;
+    // Number of registered threads that yielded the task to other tasks.
+    uint64_t numThreadsYielded = 0;
+    // Whether the task is waiting in a queue without any registered worker.
+    std::atomic<bool> starving = false;
+    // Set if the task is scheduled as part of a group of concurrent tasks.
+    TaskGroup* group = nullptr;
+    ThreadLimit* threadLimit = nullptr;
 };
 
 } // namespace common
@@ -2,8 +2,12 @@
 #include <deque>
 
 #ifndef __SINGLE_THREADED__
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <random>
 #include <thread>
+#include <unordered_map>
 #endif
 
 #include "common/task_system/task.h"
@@ -18,13 +22,39 @@ struct ScheduledTask {
     uint64_t ID;
 };
 
+#ifndef __SINGLE_THREADED__
+// Tasks scheduled concurrently, together with their dependencies. A task of the group is pushed
+// into the queues by the worker that completes its last dependency, so the thread that schedules
+// the group only waits for all of them to complete.
+struct TaskGroup {
+    TaskGroup(Task* parent, processor::ExecutionContext* context)
+        : parent{parent}, context{context} {}
+
+    // Task whose children are scheduled concurrently. It is not part of the group.
+    Task* parent;
+    processor::ExecutionContext* context;
+    std::mutex mtx;
+    std::condition_variable cv;
+    // Number of tasks pushed into the queues that have not completed yet.
+    uint64_t numActiveTasks = 0;
+    // Number of completed children of the tasks of the group that have children.
+    std::unordered_map<Task*, uint64_t> numCompletedChildren;
+    std::unordered_map<Task*, uint64_t> scheduledTaskIDs;
+    // The first error of the group, unless a later error is not just an interrupt caused by it.
+    std::exception_ptr exceptionPtr = nullptr;
+};
+#endif
+
 /**
  * TaskScheduler is a library that manages a set of worker threads that can execute tasks that are
- * put into a task queue. Each task accepts a maximum number of threads. Users of TaskScheduler
+ * put into task queues. Each task accepts a maximum number of threads. Users of TaskScheduler
  * schedule tasks to be executed by calling schedule functions, e.g., pushTaskIntoQueue or
- * scheduleTaskAndWaitOrError. New tasks are put at the end of the queue. Workers grab the first
- * task from the beginning of the queue that they can register themselves to work on. Any task that
- * is completed is removed automatically from the queue. If there is a task that raises an
+ * scheduleTaskAndWaitOrError. Every worker owns a queue. New tasks are put at the end of the queue
+ * of the pushing worker, or of the next queue in round-robin order if they are pushed by a
+ * non-worker thread. Workers grab the first task from the beginning of their own queue that they
+ * can register themselves to work on. If there is none, they steal, i.e. register themselves to a
+ * task of another queue, starting from a random one, and park if no queue has such a task. Any
+ * task that is completed is removed automatically from its queue. If there is a task that raises an
  * exception, the worker threads catch it and store it with the tasks. The user thread that is
  * waiting on the completion of the task (or tasks) will throw the exception (the user thread could
  * be waiting on a tasks through a function that waits, e.g., scheduleTaskAndWaitOrError.
@@ -33,11 +63,21 @@ struct ScheduledTask {
  * Schedule one task T and wait for T to finish or error if there was an exception raised by
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
+ * The dependencies of T are scheduled before T. If T has independent children, they are put into
+ * the queue at the same time, so that small tasks can share the worker threads.
+ *
+ * Tasks carry the priority of the query they belong to. A task that waits in a queue without any
+ * registered worker is starving. Workers register themselves to starving tasks of the highest
+ * priority first, and threads working on a task give up their task at morsel boundaries (see
+ * shouldYield()) if a task of the same or higher priority is starving, so that a new query gets
+ * worker threads without waiting for long running queries to finish. Where a thread cannot give up
+ * its task, e.g. in the middle of a morsel, it can run its share of the starving task before going
+ * on with its own (see runStarvingTask()).
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * Within a priority, TaskScheduler guarantees that workers will register themselves to the tasks
+ * of a queue in FIFO order. However this does not guarantee that the tasks will be completed in
+ * FIFO order: a long running task that is not accepting more registration can stay in the queue for
+ * an unlimited time until completion.
  */
 #ifndef __SINGLE_THREADED__
 class LBUG_API TaskScheduler {
@@ -49,34 +89,99 @@ public:
 #endif
     ~TaskScheduler();
 
-    // Schedules the dependencies of the given task and finally the task one after another (so
-    // not concurrently), and throws an exception if any of the tasks errors. Regardless of
-    // whether or not the given task or one of its dependencies errors, when this function
-    // returns, no task related to the given task will be in the task queue. Further no worker
-    // thread will be working on the given task.
+    // Schedules the dependencies of the given task and finally the task, and throws an exception
+    // if any of the tasks errors. Dependencies run one after another, unless the task has
+    // independent children, which run concurrently. Regardless of whether or not the given task
+    // or one of its dependencies errors, when this function returns, no task related to the given
+    // task will be in the task queue. Further no worker thread will be working on the given task.
+    // Without a context, the task, which must not have dependencies, is neither subject to a
+    // client timeout nor interrupted when it errors, so all its threads run to completion.
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
+    // Like scheduleTaskAndWaitOrError, but the given task, unlike its dependencies, runs on as many
+    // new threads as it accepts instead of on the worker threads. Meant for tasks that may block
+    // for a long time, e.g. on a client reading a streamed result, without holding on to workers.
+    void scheduleTaskOnNewThreadsAndWaitOrError(const std::shared_ptr<Task>& task,
+        processor::ExecutionContext* context);
+
+    // Returns true if the calling thread should stop working on its current task, so that it can
+    // work on a starving task of the same or higher priority. Only returns true if another thread
+    // keeps working on the current task. Meant to be called between morsels. The thread may
+    // register to the task again once no task is starving.
+    bool shouldYield();
+    // Runs the calling thread's share of a starving task of the same or higher priority, if there
+    // is one, and returns true once it is done. Unlike shouldYield(), the thread keeps its current
+    // task, so this can be called where the thread holds on to input that it cannot hand over to
+    // the other threads of its task, e.g. between the bound nodes of a rel scan.
+    bool runStarvingTask();
 
     static TaskScheduler* Get(const main::ClientContext& context);
 
 private:
+    struct WorkerQueue {
+        std::mutex mtx;
+        std::deque<std::shared_ptr<ScheduledTask>> tasks;
+    };
+
+    // Returns false if a dependency asks to terminate, in which case the task must not run.
+    bool scheduleDependenciesAndWaitOrError(Task& task, processor::ExecutionContext* context);
+    // Waits until all threads registered to the task finished it. Interrupts the query if it times
+    // out or the task errors.
+    static void waitForTask(Task& task, processor::ExecutionContext* context);
+    void scheduleTasksConcurrentlyAndWaitOrError(const std::vector<std::shared_ptr<Task>>& tasks,
+        processor::ExecutionContext* context);
+    // Pushes the given task of the group, or the first of its dependencies that can run, into the
+    // queues. Requires the lock of the group.
+    void startTask(TaskGroup& group, const std::shared_ptr<Task>& task);
+    void pushTask(TaskGroup& group, const std::shared_ptr<Task>& task);
+    // Schedules the task of the group that can run now that the given task completed. Requires the
+    // lock of the group.
+    void completeTask(TaskGroup& group, Task* task);
+    // Called by the worker that completed a task of a group.
+    void onTaskCompleted(Task* task);
+
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
-    void runWorkerThread();
+    void runWorkerThread(uint64_t workerIdx);
 
     std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    // Wakes up one parked worker to look for a task, if there is any. Does not take parkMtx if no
+    // worker is parked.
+    void wakeParkedWorker();
+    static bool canRegisterThread(Task& task);
 
     void removeErroringTask(uint64_t scheduledTaskID);
 
-    std::shared_ptr<ScheduledTask> getTaskAndRegister();
-    static void runTask(Task* task);
+    // Registers the worker to a starving task of the highest priority that has starving tasks, or
+    // else to any task.
+    std::shared_ptr<ScheduledTask> getTaskAndRegister(uint64_t workerIdx,
+        std::minstd_rand& randomEngine);
+    // Registers the worker to a task, or only to a starving task, of at least the given priority
+    // of its own queue or, if there is none, of another queue.
+    std::shared_ptr<ScheduledTask> findTaskAndRegister(uint64_t workerIdx,
+        std::minstd_rand& randomEngine, QueryPriority minPriority, bool starvingOnly);
+    static std::shared_ptr<ScheduledTask> getTaskAndRegister(WorkerQueue& queue,
+        QueryPriority minPriority, bool starvingOnly);
+    // Returns true if the calling thread completed the task.
+    static bool runTask(Task* task);
 
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
-    bool stopWorkerThreads;
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::atomic<uint64_t> nextQueueIdx;
+    std::atomic<uint64_t> nextScheduledTaskID;
     std::vector<std::thread> workerThreads;
-    std::mutex taskSchedulerMtx;
-    std::condition_variable cv;
-    uint64_t nextScheduledTaskID;
+    // Idle workers park on parkCV until a new task is pushed (which bumps pushEpoch) or the
+    // scheduler stops.
+    std::mutex parkMtx;
+    std::condition_variable parkCV;
+    std::atomic<uint64_t> pushEpoch;
+    // Number of workers that are parked or about to park. Only changed under parkMtx.
+    std::atomic<uint64_t> numParkedWorkers;
+    // Number of starving tasks per priority.
+    std::array<std::atomic<uint64_t>, QueryPriorityUtils::NUM_PRIORITIES> numStarvingTasks;
+    // Number of threads per priority that yielded their task for a starving task and have not
+    // registered to a new task yet. Threads only yield while this is below numStarvingTasks.
+    std::array<std::atomic<uint64_t>, QueryPriorityUtils::NUM_PRIORITIES> numPendingYields;
+    bool stopWorkerThreads;
 #if defined(__APPLE__)
     uint32_t threadQos; // Thread quality of service for worker threads.
 #endif
@@ -90,6 +195,15 @@ public:
 
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
+    // There are no other threads, so the task runs on the calling thread.
+    void scheduleTaskOnNewThreadsAndWaitOrError(const std::shared_ptr<Task>& task,
+        processor::ExecutionContext* context) {
+        scheduleTaskAndWaitOrError(task, context);
+    }
+
+    // There is a single thread, so it never yields.
+    bool shouldYield() { return false; }
+    bool runStarvingTask() { return false; }
 
     static TaskScheduler* Get(const main::ClientContext& context);
 
@@ -99,7 +213,8 @@ private:
     void removeErroringTask(uint64_t scheduledTaskID);
 
     std::shared_ptr<ScheduledTask> getTaskAndRegister();
-    static void runTask(Task* task);
+    // Returns true if the calling thread completed the task.
+    static bool runTask(Task* task);
 
 private:
     std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
@@ -49,6 +49,9 @@ constexpr block_idx_t INVALID_BLOCK_IDX = UINT64_MAX;
 using struct_field_idx_t = uint16_t;
 using union_field_idx_t = struct_field_idx_t;
 constexpr struct_field_idx_t INVALID_STRUCT_FIELD_IDX = UINT16_MAX;
+// Field indices leading from a column to one of its nested struct fields. LIST and ARRAY levels are
+// traversed implicitly.
+using struct_field_path_t = std::vector<struct_field_idx_t>;
 using row_idx_t = uint64_t;
 constexpr row_idx_t INVALID_ROW_IDX = UINT64_MAX;
 constexpr uint32_t UNDEFINED_CAST_COST = UINT32_MAX;
@@ -134,6 +134,12 @@ struct BMInfoFunction final {
     static function_set getFunctionSet();
 };
 
+struct QueryCacheInfoFunction final {
+    static constexpr const char* name = "QUERY_CACHE_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct FileInfoFunction final {
     static constexpr const char* name = "FILE_INFO";
 
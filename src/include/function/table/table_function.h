@@ -133,6 +133,7 @@ using table_func_init_local_t =
 using table_func_init_output_t =
     std::function<std::unique_ptr<TableFuncOutput>(const TableFuncInitOutputInput&)>;
 using table_func_can_parallel_t = std::function<bool()>;
+using table_func_can_yield_t = std::function<bool()>;
 using table_func_supports_push_down_t = std::function<bool()>;
 using table_func_progress_t = std::function<double(TableFuncSharedState* sharedState)>;
 using table_func_finalize_t =
@@ -154,6 +155,10 @@ struct LBUG_API TableFunction final : Function {
     table_func_init_local_t initLocalStateFunc = nullptr;
     table_func_init_output_t initOutputFunc = nullptr;
     table_func_can_parallel_t canParallelFunc = [] { return true; };
+    // Whether each call of tableFunc scans a morsel of its own, without keeping any of it in the
+    // local state. A thread can then give up its task between two calls (see
+    // TaskScheduler::shouldYield()).
+    table_func_can_yield_t canYieldFunc = [] { return false; };
     table_func_supports_push_down_t supportsPushDownFunc = [] { return false; };
     table_func_progress_t progressFunc = [](TableFuncSharedState*) { return 0.0; };
     table_func_finalize_t finalizeFunc = [](auto, auto) {};
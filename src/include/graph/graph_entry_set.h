@@ -24,8 +24,14 @@ public:
     }
     void addGraph(const std::string& name, std::unique_ptr<ParsedGraphEntry> entry) {
         nameToEntry.insert({name, std::move(entry)});
+        version++;
     }
-    void dropGraph(const std::string& name) { nameToEntry.erase(name); }
+    void dropGraph(const std::string& name) {
+        nameToEntry.erase(name);
+        version++;
+    }
+    // Incremented whenever a graph is added or dropped.
+    uint64_t getVersion() const { return version; }
 
     const std::unordered_map<std::string, std::unique_ptr<ParsedGraphEntry>>&
     getNameToEntryMap() const {
@@ -36,6 +42,7 @@ public:
 
 private:
     std::unordered_map<std::string, std::unique_ptr<ParsedGraphEntry>> nameToEntry;
+    uint64_t version = 0;
 };
 
 } // namespace graph
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "common/enums/path_semantic.h"
+#include "common/enums/query_priority.h"
 
 namespace lbug {
 namespace main {
@@ -11,6 +12,8 @@ namespace main {
 struct ClientConfigDefault {
     // 0 means timeout is disabled by default.
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
+    // 0 means the number of threads per query is not limited by default.
+    static constexpr uint64_t MAX_THREADS_PER_QUERY = 0;
     static constexpr uint32_t VAR_LENGTH_MAX_DEPTH = 30;
     static constexpr uint64_t SPARSE_FRONTIER_THRESHOLD = 1000;
     static constexpr bool ENABLE_SEMI_MASK = true;
@@ -23,6 +26,9 @@ struct ClientConfigDefault {
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
     static constexpr bool ENABLE_PLAN_OPTIMIZER = true;
     static constexpr bool ENABLE_INTERNAL_CATALOG = false;
+    static constexpr uint64_t QUERY_CACHE_SIZE = 64;
+    static constexpr common::QueryPriority QUERY_PRIORITY = common::QueryPriority::NORMAL;
+    static constexpr uint64_t REOPTIMIZATION_THRESHOLD = 1000;
 };
 
 struct ClientConfig {
@@ -36,6 +42,9 @@ struct ClientConfig {
     bool enableZoneMap = ClientConfigDefault::ENABLE_ZONE_MAP;
     // Number of threads for execution.
     uint64_t numThreads = 1;
+    // Maximum number of threads working on the pipelines of a query at the same time. 0 means each
+    // pipeline is only limited by numThreads.
+    uint64_t maxNumThreadsPerQuery = ClientConfigDefault::MAX_THREADS_PER_QUERY;
     // Timeout (milliseconds).
     uint64_t timeoutInMS = ClientConfigDefault::TIMEOUT_IN_MS;
     // Variable length maximum depth.
@@ -57,6 +66,13 @@ struct ClientConfig {
     bool enablePlanOptimizer = ClientConfigDefault::ENABLE_PLAN_OPTIMIZER;
     // If use internal catalog during binding
     bool enableInternalCatalog = ClientConfigDefault::ENABLE_INTERNAL_CATALOG;
+    // Priority of the tasks of the queries, can be either LOW, NORMAL, HIGH
+    common::QueryPriority queryPriority = ClientConfigDefault::QUERY_PRIORITY;
+    // Ratio between the actual and the estimated cardinality of a hash join build side above which
+    // a read-only query is re-planned. 0 disables re-planning.
+    uint64_t reoptimizationThreshold = ClientConfigDefault::REOPTIMIZATION_THRESHOLD;
+
+    bool operator==(const ClientConfig&) const = default;
 };
 
 } // namespace main
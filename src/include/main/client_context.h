@@ -11,6 +11,7 @@
 #include "function/table/scan_replacement.h"
 #include "main/client_config.h"
 #include "main/prepared_statement_manager.h"
+#include "main/query_cache.h"
 #include "main/query_result.h"
 #include "prepared_statement.h"
 
@@ -38,6 +39,10 @@ namespace storage {
 class StorageManager;
 }
 
+namespace planner {
+class CardinalityFeedback;
+}
+
 namespace processor {
 class ImportDB;
 class VacuumDBHelper;
@@ -57,10 +62,15 @@ class AttachedLbugDatabase;
 struct SpillToDiskSetting;
 struct ExtensionOption;
 class EmbeddedShell;
+struct StreamingQuery;
+class StreamingQueryResult;
 
 struct ActiveQuery {
     explicit ActiveQuery();
     std::atomic<bool> interrupted;
+    // Set by interrupts from the client. Unlike interrupted, which is also set to stop the threads
+    // of a failing query, it is not cleared when the query is restarted.
+    std::atomic<bool> interruptRequested;
     common::Timer timer;
 
     void reset();
@@ -81,6 +91,7 @@ class LBUG_API ClientContext {
     friend class common::RandomEngine;
     friend class common::ProgressBar;
     friend class graph::GraphEntrySet;
+    friend class StreamingQueryResult;
 
 public:
     explicit ClientContext(Database* database);
@@ -97,6 +108,10 @@ public:
 
     // Timer and timeout
     void interrupt() { activeQuery.interrupted = true; }
+    void requestInterrupt() {
+        activeQuery.interruptRequested = true;
+        interrupt();
+    }
     bool interrupted() const { return activeQuery.interrupted; }
     bool hasTimeout() const { return clientConfig.timeoutInMS != 0; }
     void setQueryTimeOut(uint64_t timeoutInMS);
@@ -129,6 +144,11 @@ public:
     const CachedPreparedStatementManager& getCachedPreparedStatementManager() const {
         return cachedPreparedStatementManager;
     }
+    const QueryCache& getQueryCache() const { return queryCache; }
+    QueryCache& getQueryCacheUnsafe() { return queryCache; }
+    planner::CardinalityFeedback* getCardinalityFeedback() const {
+        return cardinalityFeedback.get();
+    }
 
     bool isInMemory() const;
 
@@ -200,6 +220,17 @@ private:
     PrepareResult prepareNoLock(std::shared_ptr<parser::Statement> parsedStatement,
         bool shouldCommitNewTransaction,
         std::unordered_map<std::string, std::shared_ptr<common::Value>> inputParams = {});
+    // Records the state a prepared plan depends on, so that later executions can reuse it.
+    void setPlanReuseInfo(const PreparedStatement& preparedStatement,
+        CachedPreparedStatement& cachedStatement) const;
+    bool canReusePlan(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement) const;
+    // Plans the statement again in the active transaction, using the cardinalities observed so far.
+    // The plan is bound to the current parameter values.
+    std::unique_ptr<planner::LogicalPlan> replanNoLock(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement);
+    // Whether a hash join build side of the statement may stop it to have it re-planned.
+    bool canReoptimize(const PreparedStatement& preparedStatement) const;
 
     template<typename T, typename... Args>
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
@@ -214,8 +245,31 @@ private:
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
         CachedPreparedStatement* cachedPreparedStatement,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+    // Starts the query on a background thread and returns a result that is read while the query
+    // runs.
+    std::unique_ptr<QueryResult> executeStreamingNoLock(PreparedStatement* preparedStatement,
+        CachedPreparedStatement* cachedPreparedStatement, std::optional<uint64_t> queryID);
+    bool canStreamResult(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedPreparedStatement) const;
+    // Finishes the streaming query if its result is the given one.
+    void finishStreamingQuery(const StreamingQueryResult* result);
+    // Stops the streaming query, if any, and ends its transaction. The query must be finished
+    // before anything else runs on this context.
+    void finishStreamingQueryNoLock();
     std::unique_ptr<QueryResult> queryNoLock(std::string_view query,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+    // Executes the cached plan of the query text, or else of its normalized form, if it is still
+    // valid. Returns nullptr otherwise.
+    std::unique_ptr<QueryResult> queryCachedNoLock(const std::string& query,
+        const NormalizedQuery& normalizedQuery, std::optional<uint64_t> queryID,
+        QueryConfig config);
+    std::unique_ptr<QueryResult> executeCachedNoLock(const std::string& key,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters,
+        std::optional<uint64_t> queryID, QueryConfig config);
+    // Compiles and executes the normalized query, and caches its plan. Returns nullptr if the query
+    // has to be compiled in its literal form instead.
+    std::unique_ptr<QueryResult> queryNormalizedNoLock(const NormalizedQuery& normalizedQuery,
+        std::optional<uint64_t> queryID, QueryConfig config);
 
     bool canExecuteWriteQuery() const;
 
@@ -229,6 +283,10 @@ private:
     ActiveQuery activeQuery;
     // Cache prepare statement.
     CachedPreparedStatementManager cachedPreparedStatementManager;
+    // Cache plans of unprepared queries.
+    QueryCache queryCache{ClientConfigDefault::QUERY_CACHE_SIZE};
+    // Query whose result is being streamed.
+    std::unique_ptr<StreamingQuery> streamingQuery;
     // Transaction context.
     std::unique_ptr<transaction::TransactionContext> transactionContext;
     // Replace external object as pointer Value;
@@ -247,6 +305,8 @@ private:
     std::unique_ptr<processor::WarningContext> warningContext;
     // Graph entries
     std::unique_ptr<graph::GraphEntrySet> graphEntrySet;
+    // Cardinalities observed while executing the current query.
+    std::unique_ptr<planner::CardinalityFeedback> cardinalityFeedback;
     // Whether the query can access internal tables/sequences or not.
     bool useInternalCatalogEntry_ = false;
     // Whether the transaction should be rolled back on destruction. If the parent database is
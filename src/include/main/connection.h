@@ -49,6 +49,16 @@ public:
 
     LBUG_API std::unique_ptr<QueryResult> queryAsArrow(std::string_view query, int64_t chunkSize);
 
+    /**
+     * @brief Executes the given query and returns a result whose tuples are produced while they are
+     * read, instead of materializing the whole result first. The result can be read only once and
+     * does not support getNumTuples() or resetIterator(). Executing another query on this
+     * connection closes the result. Queries that write to the database are materialized.
+     * @param query The query to execute.
+     * @return the result of the query.
+     */
+    LBUG_API std::unique_ptr<QueryResult> queryAsStream(std::string_view query);
+
     /**
      * @brief Prepares the given query and returns the prepared statement.
      * @param query The query to prepare.
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "common/api.h"
+#include "client_config.h"
 #include "common/types/value/value.h"
 #include "query_summary.h"
 
@@ -18,6 +19,10 @@ class Statement;
 }
 namespace binder {
 class Expression;
+class ParameterExpression;
+} // namespace binder
+namespace catalog {
+class Catalog;
 }
 namespace planner {
 class LogicalPlan;
@@ -31,9 +36,19 @@ struct CachedPreparedStatement {
     std::shared_ptr<parser::Statement> parsedStatement;
     std::unique_ptr<planner::LogicalPlan> logicalPlan;
     std::vector<std::shared_ptr<binder::Expression>> columns;
+    // Parameter expressions in logicalPlan. Their values are substituted when the plan is reused.
+    std::vector<std::shared_ptr<binder::ParameterExpression>> parameters;
+    // State the logical plan was compiled against. The plan is reused by later executions only if
+    // none of it has changed, otherwise the statement is re-planned.
+    bool reusablePlan = false;
+    const catalog::Catalog* catalog = nullptr;
+    uint64_t catalogChangeCount = 0;
+    uint64_t graphEntrySetVersion = 0;
+    ClientConfig clientConfig;
 
     CachedPreparedStatement();
     ~CachedPreparedStatement();
+    CachedPreparedStatement& operator=(CachedPreparedStatement&& other) noexcept;
 
     std::vector<std::string> getColumnNames() const;
     std::vector<common::LogicalType> getColumnTypes() const;
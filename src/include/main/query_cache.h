@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace lbug {
+namespace common {
+class Value;
+} // namespace common
+
+namespace main {
+
+class PreparedStatement;
+struct CachedPreparedStatement;
+
+// Query text whose predicate literals are replaced by parameters. See QueryCache::normalize.
+struct NormalizedQuery {
+    std::string query;
+    std::unordered_map<std::string, std::shared_ptr<common::Value>> parameters;
+};
+
+// LRU cache of compiled statements keyed by the text of queries sent through
+// Connection::query. An entry is only a candidate: the client context checks that its plan is still
+// valid (see ClientContext::canReusePlan) before executing it.
+class QueryCache {
+public:
+    static constexpr std::string_view LITERAL_PARAMETER_PREFIX = "__literal_";
+
+    struct Entry {
+        std::unique_ptr<PreparedStatement> preparedStatement;
+        std::unique_ptr<CachedPreparedStatement> cachedStatement;
+
+        // An entry without statements records a normalized query that failed to compile, so that
+        // its literal form is compiled directly next time.
+        Entry();
+        Entry(std::unique_ptr<PreparedStatement> preparedStatement,
+            std::unique_ptr<CachedPreparedStatement> cachedStatement);
+        ~Entry();
+
+        bool isCompiled() const { return preparedStatement != nullptr; }
+    };
+
+    explicit QueryCache(uint64_t capacity);
+    ~QueryCache();
+
+    // Returns the entry of the query and marks it as most recently used, or nullptr if not cached.
+    std::shared_ptr<Entry> lookup(const std::string& query);
+    // Inserts the entry and evicts least recently used entries beyond capacity.
+    void insert(const std::string& query, std::shared_ptr<Entry> entry);
+    void erase(const std::string& query);
+    void clear();
+
+    // Evicts least recently used entries beyond the new capacity. 0 disables the cache.
+    void setCapacity(uint64_t newCapacity);
+    uint64_t getCapacity() const { return capacity; }
+
+    // Replaces the number and string literals of WHERE predicates with parameters, so that queries
+    // differing only in those literals share one entry. Other literals stay in the text, because
+    // they can name result columns or be read while binding.
+    static NormalizedQuery normalize(std::string_view query);
+
+    // Hits and misses also count executions of prepared statements that reuse or re-plan their
+    // cached plan, so they cover every plan lookup of the connection.
+    void recordHit() { numHits++; }
+    void recordMiss() { numMisses++; }
+
+    uint64_t getNumEntries() const { return entries.size(); }
+    uint64_t getNumHits() const { return numHits; }
+    uint64_t getNumMisses() const { return numMisses; }
+
+private:
+    // Most recently used query first.
+    std::list<std::string> queries;
+    std::unordered_map<std::string,
+        std::pair<std::list<std::string>::iterator, std::shared_ptr<Entry>>>
+        entries;
+    uint64_t capacity;
+    uint64_t numHits = 0;
+    uint64_t numMisses = 0;
+};
+
+} // namespace main
+} // namespace lbug
@@ -17,6 +17,7 @@ namespace main {
 enum class QueryResultType {
     FTABLE = 0,
     ARROW = 1,
+    STREAMING = 2,
 };
 
 /**
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "main/query_result.h"
+
+namespace lbug {
+namespace common {
+class Profiler;
+}
+namespace processor {
+class FactorizedTable;
+class FactorizedTableIterator;
+class PhysicalPlan;
+class StreamingResultQueue;
+struct ExecutionContext;
+} // namespace processor
+
+namespace main {
+class ClientContext;
+class StreamingQueryResult;
+
+// Execution state of a query whose result is streamed. It is owned by the client context, which
+// finishes the query once the result is exhausted or dropped, or before the next query runs.
+struct StreamingQuery {
+    std::unique_ptr<common::Profiler> profiler;
+    std::unique_ptr<processor::ExecutionContext> executionContext;
+    std::unique_ptr<processor::PhysicalPlan> physicalPlan;
+    std::shared_ptr<processor::StreamingResultQueue> queue;
+    // Runs the plan and pushes the result chunks into the queue.
+    std::thread producer;
+    // Set by the producer before it finishes the queue.
+    std::exception_ptr producerException;
+    // Whether the (auto) transaction of the query should be committed once it finishes.
+    bool commitTransaction = false;
+    StreamingQueryResult* result = nullptr;
+
+    StreamingQuery();
+    ~StreamingQuery();
+};
+
+// Result that hands out tuples while the query is still running. Chunks are pulled from a bounded
+// queue filled by the result collector, so only a few chunks of the result are in memory at any
+// time. The result can be read only once and does not know its number of tuples upfront.
+class StreamingQueryResult : public QueryResult {
+    static constexpr QueryResultType type_ = QueryResultType::STREAMING;
+
+public:
+    StreamingQueryResult(ClientContext* clientContext,
+        std::shared_ptr<processor::StreamingResultQueue> queue);
+    ~StreamingQueryResult() override;
+
+    uint64_t getNumTuples() const override;
+
+    bool hasNext() const override;
+
+    std::shared_ptr<processor::FlatTuple> getNext() override;
+
+    void resetIterator() override;
+
+    std::string toString() const override;
+
+    bool hasNextArrowChunk() override;
+
+    std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) override;
+
+    // Called by the client context once the query is finished. If the result has not been fully
+    // read, later reads throw.
+    void detach() { detached = true; }
+
+private:
+    // Returns false once all chunks have been read.
+    bool fetchNextChunk() const;
+
+private:
+    ClientContext* clientContext;
+    std::shared_ptr<processor::StreamingResultQueue> queue;
+    mutable std::unique_ptr<processor::FactorizedTable> chunk;
+    mutable std::unique_ptr<processor::FactorizedTableIterator> iterator;
+    mutable bool exhausted = false;
+    std::atomic<bool> detached = false;
+};
+
+} // namespace main
+} // namespace lbug
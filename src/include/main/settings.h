@@ -12,6 +12,13 @@ struct ThreadsSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct MaxThreadsPerQuerySetting {
+    static constexpr auto name = "max_threads_per_query";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct WarningLimitSetting {
     static constexpr auto name = "warning_limit";
     static constexpr auto inputType = common::LogicalTypeID::UINT64;
@@ -124,6 +131,13 @@ struct ForceCheckpointClosingDBSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct WALCompressionSetting {
+    static constexpr auto name = "wal_compression";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct SpillToDiskSetting {
     static constexpr auto name = "spill_to_disk";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -145,5 +159,26 @@ struct EnableInternalCatalogSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct QueryCacheSizeSetting {
+    static constexpr auto name = "query_cache_size";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct QueryPrioritySetting {
+    static constexpr auto name = "query_priority";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct ReoptimizationThresholdSetting {
+    static constexpr auto name = "reoptimization_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 } // namespace main
 } // namespace lbug
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "planner/operator/logical_operator.h"
+
+namespace lbug {
+namespace optimizer {
+
+struct DynamicFilterUtil {
+    // Finds the scan that produces expression in the pipeline of root. Only operators that pass
+    // their input tuples through (possibly fewer or more of them) are traversed, so dropping a
+    // tuple at the scan only drops the tuples with the same value of expression at root. Filters
+    // that are only known at runtime, e.g. from a hash join build or a top-k heap, can therefore be
+    // applied at the scan.
+    static planner::LogicalOperator* getScanTarget(const binder::Expression& expression,
+        planner::LogicalOperator* root);
+};
+
+} // namespace optimizer
+} // namespace lbug
@@ -44,5 +44,10 @@ protected:
     void visitRecursiveExtend(planner::LogicalOperator* op) override { ops.push_back(op); }
 };
 
+class LogicalTableFunctionCallCollector final : public LogicalOperatorCollector {
+protected:
+    void visitTableFunctionCall(planner::LogicalOperator* op) override { ops.push_back(op); }
+};
+
 } // namespace optimizer
 } // namespace lbug
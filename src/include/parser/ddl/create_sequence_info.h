@@ -14,6 +14,7 @@ enum class SequenceInfoType {
     MINVALUE,
     MAXVALUE,
     CYCLE,
+    CACHE,
     INVALID,
 };
 
@@ -24,6 +25,7 @@ struct CreateSequenceInfo {
     std::string minValue = "";
     std::string maxValue = "";
     bool cycle = false;
+    std::string cache = "1";
     common::ConflictAction onConflict;
 
     explicit CreateSequenceInfo(std::string sequenceName, common::ConflictAction onConflict)
@@ -34,7 +36,7 @@ private:
     CreateSequenceInfo(const CreateSequenceInfo& other)
         : sequenceName{other.sequenceName}, startWith{other.startWith}, increment{other.increment},
           minValue{other.minValue}, maxValue{other.maxValue}, cycle{other.cycle},
-          onConflict{other.onConflict} {}
+          cache{other.cache}, onConflict{other.onConflict} {}
 };
 
 } // namespace parser
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "binder/query/query_graph.h"
+#include "common/exception/exception.h"
+#include "common/types/types.h"
+
+namespace lbug {
+namespace planner {
+
+// Thrown by a pipeline breaker whose actual cardinality is far above the estimate, to stop the
+// query so that the client context plans and runs it again.
+class ReoptimizeException : public common::Exception {
+public:
+    ReoptimizeException() : Exception("Query is re-planned.") {}
+};
+
+// Cardinalities observed at the pipeline breakers of a running query. They are keyed by the part of
+// the query graph a subplan covers and replace the estimates when the query is re-planned.
+class CardinalityFeedback {
+public:
+    // Identifies the subgraph within its query graph. Keys are stable across bindings of the same
+    // statement, because the binder assigns the same unique names to the same variables.
+    static std::string getKey(const binder::QueryGraph& queryGraph,
+        const binder::SubqueryGraph& subgraph);
+
+    // Starts collecting observations for a query that can be re-planned. A threshold of 0 disables
+    // the collection.
+    void start(uint64_t threshold);
+    // Keeps the observations, but no longer asks for re-planning, e.g. once a query has been
+    // re-planned too often.
+    void stop();
+    // Drops all observations.
+    void finish();
+
+    bool isEmpty() const;
+    std::optional<common::cardinality_t> getCardinality(const std::string& key) const;
+
+    // Records the actual cardinality of a subplan. Returns true if it exceeds the estimate by more
+    // than the threshold, i.e. the query should be re-planned.
+    bool observe(const std::string& key, common::cardinality_t estimated,
+        common::cardinality_t actual);
+
+private:
+    mutable std::mutex mtx;
+    uint64_t threshold = 0;
+    std::unordered_map<std::string, common::cardinality_t> cardinalities;
+};
+
+} // namespace planner
+} // namespace lbug
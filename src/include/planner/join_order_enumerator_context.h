@@ -6,16 +6,19 @@
 namespace lbug {
 namespace planner {
 
+class CardinalityFeedback;
+
 class JoinOrderEnumeratorContext {
     friend class Planner;
 
 public:
     JoinOrderEnumeratorContext()
         : currentLevel{0}, maxLevel{0}, subPlansTable{std::make_unique<SubPlansTable>()},
-          queryGraph{nullptr} {}
+          queryGraph{nullptr}, cardinalityFeedback{nullptr} {}
     DELETE_COPY_DEFAULT_MOVE(JoinOrderEnumeratorContext);
 
-    void init(const binder::QueryGraph* queryGraph, const binder::expression_vector& predicates);
+    void init(const binder::QueryGraph* queryGraph, const binder::expression_vector& predicates,
+        const CardinalityFeedback* cardinalityFeedback);
 
     binder::expression_vector getWhereExpressions() { return whereExpressionsSplitOnAND; }
 
@@ -25,9 +28,9 @@ public:
     const std::vector<LogicalPlan>& getPlans(const binder::SubqueryGraph& subqueryGraph) const {
         return subPlansTable->getSubgraphPlans(subqueryGraph);
     }
-    void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan) {
-        subPlansTable->addPlan(subqueryGraph, std::move(plan));
-    }
+    // If the cardinality of the subgraph was observed while executing the query before, it
+    // replaces the estimate of the plan.
+    void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan);
 
     binder::SubqueryGraph getEmptySubqueryGraph() const {
         return binder::SubqueryGraph(*queryGraph);
@@ -46,6 +49,7 @@ private:
 
     std::unique_ptr<SubPlansTable> subPlansTable;
     const binder::QueryGraph* queryGraph;
+    const CardinalityFeedback* cardinalityFeedback;
 };
 
 } // namespace planner
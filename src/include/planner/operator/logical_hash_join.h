@@ -45,6 +45,22 @@ public:
     SIPInfo& getSIPInfoUnsafe() { return sipInfo; }
     SIPInfo getSIPInfo() const { return sipInfo; }
 
+    // Scan on the probe side that drops the tuples whose key cannot match, using a Bloom filter and
+    // the range of the build keys. The target points into this plan, so it is not kept by copy().
+    void setDynamicFilterTarget(LogicalOperator* op) { dynamicFilterTarget = op; }
+    LogicalOperator* getDynamicFilterTarget() const { return dynamicFilterTarget; }
+
+    // Identifies the part of the query graph the build side covers (see CardinalityFeedback), along
+    // with the estimated build side cardinality. Empty if the build side is not such a part.
+    void setBuildCardinalityKey(std::string key, common::cardinality_t estimate) {
+        buildCardinalityKey = std::move(key);
+        estimatedBuildCardinality = estimate;
+    }
+    const std::string& getBuildCardinalityKey() const { return buildCardinalityKey; }
+    common::cardinality_t getEstimatedBuildCardinality() const {
+        return estimatedBuildCardinality;
+    }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
     // Flat probe side key group in either of the following two cases:
@@ -63,6 +79,9 @@ private:
     common::JoinType joinType;
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark or Left
     SIPInfo sipInfo;
+    LogicalOperator* dynamicFilterTarget = nullptr;
+    std::string buildCardinalityKey;
+    common::cardinality_t estimatedBuildCardinality = 0;
 };
 
 } // namespace planner
@@ -33,6 +33,11 @@ public:
     bool hasLimitNum() const { return limitNum != nullptr; }
     std::shared_ptr<binder::Expression> getLimitNum() const { return limitNum; }
 
+    // Scan producing the first key. Once the top k is full, values beyond its boundary are
+    // pushed into the scan as a zone map predicate.
+    void setDynamicFilterTarget(LogicalOperator* op) { dynamicFilterTarget = op; }
+    LogicalOperator* getDynamicFilterTarget() const { return dynamicFilterTarget; }
+
     std::unique_ptr<LogicalOperator> copy() override {
         return make_unique<LogicalOrderBy>(expressionsToOrderBy, isAscOrders, children[0]->copy());
     }
@@ -42,6 +47,7 @@ private:
     std::vector<bool> isAscOrders;
     std::shared_ptr<binder::Expression> skipNum = nullptr;
     std::shared_ptr<binder::Expression> limitNum = nullptr;
+    LogicalOperator* dynamicFilterTarget = nullptr;
 };
 
 } // namespace planner
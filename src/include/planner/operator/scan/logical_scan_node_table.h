@@ -80,6 +80,17 @@ public:
     binder::expression_vector getProperties() const { return properties; }
     void addProperty(std::shared_ptr<binder::Expression> expr) {
         properties.push_back(std::move(expr));
+        if (!propertyFieldPaths.empty()) {
+            propertyFieldPaths.emplace_back();
+        }
+    }
+    void setPropertyFieldPaths(std::vector<std::vector<common::struct_field_path_t>> fieldPaths) {
+        propertyFieldPaths = std::move(fieldPaths);
+    }
+    // Struct fields to scan for the property at `idx`. Empty means all fields.
+    std::vector<common::struct_field_path_t> getPropertyFieldPaths(common::idx_t idx) const {
+        return idx < propertyFieldPaths.size() ? propertyFieldPaths[idx] :
+                                                 std::vector<common::struct_field_path_t>{};
     }
     void setPropertyPredicates(std::vector<storage::ColumnPredicateSet> predicates) {
         propertyPredicates = std::move(predicates);
@@ -104,6 +115,7 @@ private:
     std::vector<common::table_id_t> nodeTableIDs;
     binder::expression_vector properties;
     std::vector<storage::ColumnPredicateSet> propertyPredicates;
+    std::vector<std::vector<common::struct_field_path_t>> propertyFieldPaths;
     std::unique_ptr<ExtraScanNodeTableInfo> extraInfo;
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "common/enums/extend_direction.h"
 #include "common/exception/runtime.h"
 #include "planner/operator/logical_operator.h"
@@ -86,7 +88,12 @@ public:
 
     std::vector<common::table_id_t> getNodeTableIDs() const { return nodeTableIDs; }
 
-    void addTarget(const LogicalOperator* op) { targetOps.push_back(op); }
+    // Targets may be added again when the plan of a prepared statement is mapped repeatedly.
+    void addTarget(const LogicalOperator* op) {
+        if (std::find(targetOps.begin(), targetOps.end(), op) == targetOps.end()) {
+            targetOps.push_back(op);
+        }
+    }
     std::vector<const LogicalOperator*> getTargetOperators() const { return targetOps; }
 
     std::unique_ptr<LogicalOperator> copy() override {
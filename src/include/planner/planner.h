@@ -327,6 +327,9 @@ public:
         const binder::expression_vector& expressions, bool isUnionAll);
 
     binder::expression_vector getProperties(const binder::Expression& pattern) const;
+    // Struct fields to scan for a property. Empty means all fields.
+    std::vector<common::struct_field_path_t> getStructFieldPaths(
+        const binder::Expression& property) const;
 
     JoinOrderEnumeratorContext enterNewContext();
     void exitContext(JoinOrderEnumeratorContext prevContext);
@@ -345,6 +348,8 @@ public:
 private:
     main::ClientContext* clientContext;
     PropertyExprCollection propertyExprCollection;
+    // Struct fields read from each property of the single query being planned.
+    std::unordered_map<std::string, std::vector<common::struct_field_path_t>> structFieldPaths;
     CardinalityEstimator cardinalityEstimator;
     JoinOrderEnumeratorContext context;
     std::vector<extension::PlannerExtension*> plannerExtensions;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/profiler.h"
+#include "common/task_system/task.h"
 
 namespace lbug {
 namespace main {
@@ -12,6 +13,8 @@ struct LBUG_API ExecutionContext {
     uint64_t queryID;
     common::Profiler* profiler;
     main::ClientContext* clientContext;
+    // Shared by the tasks of the query if the number of threads per query is limited.
+    std::unique_ptr<common::ThreadLimit> threadLimit;
 
     ExecutionContext(common::Profiler* profiler, main::ClientContext* clientContext,
         uint64_t queryID)
@@ -3,11 +3,13 @@
 #include <mutex>
 
 #include "binder/expression/expression.h"
+#include "common/bloom_filter.h"
 #include "join_hash_table.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/result_set.h"
+#include "storage/predicate/dynamic_predicate.h"
 
 namespace lbug {
 namespace processor {
@@ -43,13 +45,36 @@ public:
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
         : hashTable{std::move(hashTable)} {};
 
-    void mergeLocalHashTable(JoinHashTable& localHashTable);
+    // Merges the local hash table along with the number of flat tuples it represents.
+    void mergeLocalHashTable(JoinHashTable& localHashTable, uint64_t numLocalFlatTuples);
 
     JoinHashTable* getHashTable() { return hashTable.get(); }
+    // Number of tuples of the build side once its unflat payloads are flattened. Equal to the
+    // number of hash table entries if all payloads are flat.
+    uint64_t getNumFlatTuples() const { return numFlatTuples; }
+
+    // Requests a Bloom filter of the build keys, which is filled once the build is finalized.
+    void setBloomFilter(std::shared_ptr<common::BloomFilter> filter) {
+        bloomFilter = std::move(filter);
+    }
+    // Requests the range of the build keys, which is published once the build is finalized.
+    void setKeyBounds(std::shared_ptr<storage::DynamicBound> minBound,
+        std::shared_ptr<storage::DynamicBound> maxBound) {
+        minKeyBound = std::move(minBound);
+        maxKeyBound = std::move(maxBound);
+    }
+
+    // Fills the requested filters from the finalized hash table.
+    void publishDynamicFilters();
 
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    uint64_t numFlatTuples = 0;
+    // Filters shared with the probe side scans that they are passed to.
+    std::shared_ptr<common::BloomFilter> bloomFilter;
+    std::shared_ptr<storage::DynamicBound> minKeyBound;
+    std::shared_ptr<storage::DynamicBound> maxKeyBound;
 };
 
 struct HashJoinBuildInfo {
@@ -57,6 +82,10 @@ struct HashJoinBuildInfo {
     std::vector<common::FStateType> fStateTypes;
     std::vector<DataPos> payloadsPos;
     FactorizedTableSchema tableSchema;
+    // If set, the number of build tuples is reported to the cardinality feedback of the query under
+    // this key.
+    std::string cardinalityKey;
+    common::cardinality_t estimatedCardinality = 0;
 
     HashJoinBuildInfo(std::vector<DataPos> keysPos, std::vector<common::FStateType> fStateTypes,
         std::vector<DataPos> payloadsPos, FactorizedTableSchema tableSchema)
@@ -69,7 +98,8 @@ struct HashJoinBuildInfo {
 private:
     HashJoinBuildInfo(const HashJoinBuildInfo& other)
         : keysPos{other.keysPos}, fStateTypes{other.fStateTypes}, payloadsPos{other.payloadsPos},
-          tableSchema{other.tableSchema.copy()} {}
+          tableSchema{other.tableSchema.copy()}, cardinalityKey{other.cardinalityKey},
+          estimatedCardinality{other.estimatedCardinality} {}
 };
 
 class HashJoinBuild : public Sink {
@@ -110,8 +140,11 @@ protected:
     // State of unFlat key(s). If all keys are flat, it points to any flat key state.
     common::DataChunkState* keyState = nullptr;
     std::vector<common::ValueVector*> payloadVectors;
+    // States of the unflat payload vectors, used to count the flat tuples of the build side.
+    std::vector<common::DataChunkState*> unflatPayloadStates;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+    uint64_t numLocalFlatTuples = 0;
 };
 
 } // namespace processor
@@ -2,17 +2,33 @@
 
 #include "processor/result/base_hash_table.h"
 #include "processor/result/factorized_table.h"
+#include "storage/compression/compression.h"
 
 namespace lbug {
+namespace common {
+class BloomFilter;
+}
 namespace storage {
 class MemoryManager;
 }
 namespace processor {
 
+// A join hash table is either a single chained hash table, or radix partitioned by the highest
+// numPartitionBits bits of the hash. A partitioned table appends tuples into one factorized table
+// per partition and gives each partition its own region of the directory, sized to fit the caches
+// if the build size is estimated well. The partitions are merged into a single factorized table
+// (in partition order) before the directory is built, so the directory is built one cache-resident
+// region after another.
 class JoinHashTable : public BaseHashTable {
 public:
     JoinHashTable(storage::MemoryManager& memoryManager, common::logical_type_vec_t keyTypes,
-        FactorizedTableSchema tableSchema);
+        FactorizedTableSchema tableSchema, uint64_t numPartitionBits = 0);
+
+    // Returns the number of partition bits for a build side of the given (estimated) cardinality.
+    // Builds whose directory fits into PARTITION_DIRECTORY_SIZE are not partitioned.
+    static uint64_t getNumPartitionBits(common::cardinality_t buildCardinality);
+    uint64_t getNumPartitionBits() const { return numPartitionBits; }
+    bool isPartitioned() const { return numPartitionBits > 0; }
 
     uint64_t appendVectors(const std::vector<common::ValueVector*>& keyVectors,
         const std::vector<common::ValueVector*>& payloadVectors, common::DataChunkState* keyState);
@@ -23,8 +39,17 @@ public:
     uint64_t appendVectorWithSorting(common::ValueVector* keyVector,
         std::vector<common::ValueVector*> payloadVectors);
 
+    // Moves the tuples of all partitions into the factorized table. Must be called before
+    // allocating the hash slots of a partitioned table.
+    void mergePartitions();
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
+    // Inserts the hashes of all tuples into the given filter.
+    void buildBloomFilter(common::BloomFilter& bloomFilter) const;
+    // Returns the smallest and largest key of a single key table. Both are nullopt if the table is
+    // empty or the key type has no zone maps.
+    std::pair<std::optional<storage::StorageValue>, std::optional<storage::StorageValue>>
+    getKeyRange() const;
 
     // The tmpHashResultVector may be null if there is only one keyVector
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
@@ -42,18 +67,37 @@ public:
         uint8_t** tuplesToRead, uint64_t startPos, uint64_t numTuplesToRead) {
         factorizedTable->lookup(vectors, colIdxesToScan, tuplesToRead, startPos, numTuplesToRead);
     }
-    void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
+    void merge(JoinHashTable& other);
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
-    uint8_t* getTupleForHash(common::hash_t hash) {
+    uint8_t* getTupleForHash(common::hash_t hash) const { return *getHashSlot(hash); }
+
+private:
+    uint64_t getSlotIdxForHash(common::hash_t hash) const {
+        if (!isPartitioned()) {
+            return BaseHashTable::getSlotIdxForHash(hash);
+        }
+        auto partitionIdx = getPartitionIdx(hash);
+        return partitionSlotOffsets[partitionIdx] + (hash & partitionSlotMasks[partitionIdx]);
+    }
+    uint8_t** getHashSlot(common::hash_t hash) const {
         auto slotIdx = getSlotIdxForHash(hash);
         KU_ASSERT(slotIdx < maxNumHashSlots);
-        return ((uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]
-                                ->getData()))[slotIdx & slotIdxInBlockMask];
+        return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData()) +
+               (slotIdx & slotIdxInBlockMask);
     }
+    uint64_t getPartitionIdx(common::hash_t hash) const { return hash >> partitionShift; }
+
+    static void appendVectorToTable(FactorizedTable& table, common::ValueVector* vector,
+        const std::vector<BlockAppendingInfo>& appendInfos, ft_col_idx_t colIdx);
+    void appendVectorsToTable(FactorizedTable& table,
+        const std::vector<common::ValueVector*>& keyVectors,
+        const std::vector<common::ValueVector*>& payloadVectors, uint64_t numTuplesToAppend);
+    // Appends the selected tuples of the key state to the partitions of their hashes.
+    void appendVectorsToPartitions(const std::vector<common::ValueVector*>& keyVectors,
+        const std::vector<common::ValueVector*>& payloadVectors, common::DataChunkState* keyState);
 
-private:
     uint8_t** findHashSlot(const uint8_t* tuple) const;
     // This function returns the pointer that previously stored in the same slot.
     uint8_t* insertEntry(uint8_t* tuple) const;
@@ -63,10 +107,29 @@ private:
 
     common::offset_t getHashValueColOffset() const;
 
+public:
+    // Target size of the directory of a partition, roughly the size of a core's L2 cache.
+    static constexpr uint64_t PARTITION_DIRECTORY_SIZE = 1 << 20;
+    // Bounds the fan-out of the partitioning, so that each input vector still appends a few tuples
+    // to each partition.
+    static constexpr uint64_t MAX_NUM_PARTITION_BITS = 8;
+
 private:
     static constexpr uint64_t PREV_PTR_COL_IDX = 1;
     static constexpr uint64_t HASH_COL_IDX = 2;
     uint64_t prevPtrColOffset;
+    uint64_t numPartitionBits;
+    uint64_t partitionShift;
+    // Tuples of each partition until mergePartitions() is called.
+    std::vector<std::unique_ptr<FactorizedTable>> partitions;
+    std::vector<uint64_t> partitionNumTuples;
+    // Start and size (as a mask) of the directory region of each partition.
+    std::vector<uint64_t> partitionSlotOffsets;
+    std::vector<uint64_t> partitionSlotMasks;
+    // Temporary buffers for appending to partitions.
+    std::vector<common::sel_t> selectedPositions;
+    std::vector<common::sel_t> partitionedPositions;
+    std::vector<uint64_t> partitionStarts;
 };
 
 } // namespace processor
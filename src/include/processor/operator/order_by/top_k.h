@@ -7,6 +7,10 @@
 #include "sort_state.h"
 
 namespace lbug {
+namespace storage {
+class DynamicBound;
+}
+
 namespace processor {
 
 struct TopKPrintInfo final : OPPrintInfo {
@@ -118,6 +122,9 @@ public:
     std::vector<vector_select_comparison_func> compareFuncs;
     std::vector<vector_select_comparison_func> equalsFuncs;
     bool hasBoundaryValue;
+    // If set, tightened with the first key of the boundary tuple so that scans below can skip
+    // node groups whose values cannot make it into the top k.
+    std::shared_ptr<storage::DynamicBound> dynamicBound;
 
 private:
     // Holds the ownership of all temp vectors.
@@ -160,10 +167,16 @@ public:
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     inline void finalize() { buffer->finalize(); }
 
+    void setDynamicBound(std::shared_ptr<storage::DynamicBound> bound) {
+        dynamicBound = std::move(bound);
+    }
+    std::shared_ptr<storage::DynamicBound> getDynamicBound() const { return dynamicBound; }
+
     std::unique_ptr<TopKBuffer> buffer;
 
 private:
     std::mutex mtx;
+    std::shared_ptr<storage::DynamicBound> dynamicBound;
 };
 
 class TopK final : public Sink {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "insert_executor.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/result/pattern_creation_info_table.h"
@@ -13,6 +15,10 @@ struct MergeInfo {
     FactorizedTableSchema tableSchema;
     common::executor_info executorInfo;
     DataPos existenceMark;
+    // Whether the pipeline of the merge can run on multiple threads. See
+    // PlanMapper::canParallelizeWrite and PlanMapper::disableUnsafeParallelWrites for when this is
+    // safe. A merge whose SET values depend on which row of a key comes first stays serial.
+    bool parallel = false;
 
     MergeInfo(std::vector<std::unique_ptr<evaluator::ExpressionEvaluator>> keyEvaluators,
         FactorizedTableSchema tableSchema, common::executor_info executorInfo,
@@ -24,7 +30,8 @@ struct MergeInfo {
 private:
     MergeInfo(const MergeInfo& other)
         : keyEvaluators{copyVector(other.keyEvaluators)}, tableSchema{other.tableSchema.copy()},
-          executorInfo{other.executorInfo}, existenceMark{other.existenceMark} {}
+          executorInfo{other.executorInfo}, existenceMark{other.existenceMark},
+          parallel{other.parallel} {}
 };
 
 struct MergePrintInfo final : OPPrintInfo {
@@ -48,17 +55,45 @@ private:
           onMatch(other.onMatch) {}
 };
 
+// Shared by all threads executing the same merge. Threads evaluate the input pipeline (e.g. file
+// scan and existence probe) in parallel. Rows are then routed to a partition by the hash of their
+// merge keys, so every key is owned by exactly one partition and is created only once even when it
+// appears in several threads' inputs. Different keys only meet on the write mutex, which guards the
+// transaction's local storage.
+struct MergeSharedState {
+    static constexpr uint64_t NUM_PARALLEL_PARTITIONS = 32;
+
+    struct Partition {
+        std::mutex mtx;
+        std::unique_ptr<PatternCreationInfoTable> hashTable;
+    };
+
+    std::mutex mtx;
+    std::vector<std::unique_ptr<Partition>> partitions;
+    std::mutex writeMtx;
+
+    void init(main::ClientContext* context, const std::vector<common::LogicalType>& keyTypes,
+        const FactorizedTableSchema& tableSchema, uint64_t numPartitions);
+
+    Partition& getPartition(common::hash_t keyHash) const {
+        return *partitions[keyHash % partitions.size()];
+    }
+};
+
 struct MergeLocalState {
     std::vector<common::ValueVector*> keyVectors;
-    std::unique_ptr<PatternCreationInfoTable> hashTable;
+    std::unique_ptr<common::ValueVector> hashVector;
     common::ValueVector* existenceVector = nullptr;
 
-    void init(ResultSet& resultSet, main::ClientContext* context, MergeInfo& info);
+    void init(ResultSet& resultSet, main::ClientContext* context, MergeInfo& info,
+        MergeSharedState& sharedState);
 
     bool patternExists() const;
 
-    PatternCreationInfo getPatternCreationInfo() const {
-        return hashTable->getPatternCreationInfo(keyVectors);
+    common::hash_t computeKeyHash() const;
+
+    PatternCreationInfo getPatternCreationInfo(PatternCreationInfoTable& hashTable) const {
+        return hashTable.getPatternCreationInfo(keyVectors);
     }
 };
 
@@ -72,17 +107,19 @@ public:
         std::vector<std::unique_ptr<RelSetExecutor>> onCreateRelSetExecutors,
         std::vector<std::unique_ptr<NodeSetExecutor>> onMatchNodeSetExecutors,
         std::vector<std::unique_ptr<RelSetExecutor>> onMatchRelSetExecutors, MergeInfo info,
-        std::unique_ptr<PhysicalOperator> child, uint32_t id,
-        std::unique_ptr<OPPrintInfo> printInfo)
+        std::shared_ptr<MergeSharedState> sharedState, std::unique_ptr<PhysicalOperator> child,
+        uint32_t id, std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
           nodeInsertExecutors{std::move(nodeInsertExecutors)},
           relInsertExecutors{std::move(relInsertExecutors)},
           onCreateNodeSetExecutors{std::move(onCreateNodeSetExecutors)},
           onCreateRelSetExecutors{std::move(onCreateRelSetExecutors)},
           onMatchNodeSetExecutors{std::move(onMatchNodeSetExecutors)},
-          onMatchRelSetExecutors{std::move(onMatchRelSetExecutors)}, info{std::move(info)} {}
+          onMatchRelSetExecutors{std::move(onMatchRelSetExecutors)}, info{std::move(info)},
+          sharedState{std::move(sharedState)} {}
 
-    bool isParallel() const override { return false; }
+    bool isParallel() const override { return info.parallel; }
+    void setParallel(bool parallel) { info.parallel = parallel; }
 
     void initLocalStateInternal(ResultSet* resultSet_, ExecutionContext* context) override;
 
@@ -92,7 +129,7 @@ public:
         return std::make_unique<Merge>(copyVector(nodeInsertExecutors),
             copyVector(relInsertExecutors), copyVector(onCreateNodeSetExecutors),
             copyVector(onCreateRelSetExecutors), copyVector(onMatchNodeSetExecutors),
-            copyVector(onMatchRelSetExecutors), info.copy(), children[0]->copy(), id,
+            copyVector(onMatchRelSetExecutors), info.copy(), sharedState, children[0]->copy(), id,
             printInfo->copy());
     }
 
@@ -103,7 +140,7 @@ private:
 
     void executeOnNewPattern(PatternCreationInfo& info, ExecutionContext* context);
 
-    void executeNoMatch(ExecutionContext* context);
+    void executeNoMatch(PatternCreationInfoTable& hashTable, ExecutionContext* context);
 
 private:
     std::vector<NodeInsertExecutor> nodeInsertExecutors;
@@ -116,6 +153,7 @@ private:
     std::vector<std::unique_ptr<RelSetExecutor>> onMatchRelSetExecutors;
 
     MergeInfo info;
+    std::shared_ptr<MergeSharedState> sharedState;
     MergeLocalState localState;
 };
 
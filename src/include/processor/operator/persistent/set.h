@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+
 #include "processor/operator/physical_operator.h"
 #include "set_executor.h"
 
@@ -23,29 +27,51 @@ private:
         : OPPrintInfo(other), expressions(other.expressions) {}
 };
 
+// Shared by all threads executing the same set. Updates of committed rows go through per-vector
+// update chains, the undo buffer and the local WAL, which are all safe to write concurrently, so
+// they only take the lock in shared mode. Anything else (e.g. rows inserted by the same
+// transaction, secondary index maintenance) takes it exclusively.
+// Concurrent sets additionally lock the row they update, so that two threads updating the same row
+// apply their in-memory updates and append their WAL records in the same order.
+struct SetSharedState {
+    static constexpr uint64_t NUM_ROW_MUTEXES = 256;
+
+    std::shared_mutex mtx;
+    std::array<std::mutex, NUM_ROW_MUTEXES> rowMtxes;
+
+    std::mutex& getRowMutex(common::internalID_t rowID) {
+        return rowMtxes[(rowID.offset ^ rowID.tableID) % NUM_ROW_MUTEXES];
+    }
+};
+
 class SetNodeProperty final : public PhysicalOperator {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::SET_PROPERTY;
 
 public:
     SetNodeProperty(std::vector<std::unique_ptr<NodeSetExecutor>> executors,
+        std::shared_ptr<SetSharedState> sharedState, bool parallel,
         std::unique_ptr<PhysicalOperator> child, uint32_t id,
         std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
-          executors{std::move(executors)} {}
+          executors{std::move(executors)}, sharedState{std::move(sharedState)},
+          parallel{parallel} {}
 
-    bool isParallel() const override { return false; }
+    bool isParallel() const override { return parallel; }
+    void setParallel(bool parallel_) { parallel = parallel_; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return std::make_unique<SetNodeProperty>(copyVector(executors), children[0]->copy(), id,
-            printInfo->copy());
+        return std::make_unique<SetNodeProperty>(copyVector(executors), sharedState, parallel,
+            children[0]->copy(), id, printInfo->copy());
     }
 
 private:
     std::vector<std::unique_ptr<NodeSetExecutor>> executors;
+    std::shared_ptr<SetSharedState> sharedState;
+    bool parallel;
 };
 
 class SetRelProperty final : public PhysicalOperator {
@@ -53,24 +79,29 @@ class SetRelProperty final : public PhysicalOperator {
 
 public:
     SetRelProperty(std::vector<std::unique_ptr<RelSetExecutor>> executors,
+        std::shared_ptr<SetSharedState> sharedState, bool parallel,
         std::unique_ptr<PhysicalOperator> child, uint32_t id,
         std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
-          executors{std::move(executors)} {}
+          executors{std::move(executors)}, sharedState{std::move(sharedState)},
+          parallel{parallel} {}
 
-    bool isParallel() const override { return false; }
+    bool isParallel() const override { return parallel; }
+    void setParallel(bool parallel_) { parallel = parallel_; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return std::make_unique<SetRelProperty>(copyVector(executors), children[0]->copy(), id,
-            printInfo->copy());
+        return std::make_unique<SetRelProperty>(copyVector(executors), sharedState, parallel,
+            children[0]->copy(), id, printInfo->copy());
     }
 
 private:
     std::vector<std::unique_ptr<RelSetExecutor>> executors;
+    std::shared_ptr<SetSharedState> sharedState;
+    bool parallel;
 };
 
 } // namespace processor
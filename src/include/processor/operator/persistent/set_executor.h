@@ -54,7 +54,11 @@ public:
     virtual void init(ResultSet* resultSet, ExecutionContext* context);
 
     void setNodeID(common::nodeID_t nodeID) const;
+    common::nodeID_t getNodeID() const;
 
+    // Whether the next set only touches thread-safe update paths of committed rows, so it can run
+    // alongside other concurrent sets of the same transaction. See SetSharedState.
+    virtual bool canSetConcurrently(ExecutionContext* context) const = 0;
     virtual void set(ExecutionContext* context) = 0;
 
     virtual std::unique_ptr<NodeSetExecutor> copy() const = 0;
@@ -70,6 +74,7 @@ public:
     SingleLabelNodeSetExecutor(const SingleLabelNodeSetExecutor& other)
         : NodeSetExecutor{other}, tableInfo(other.tableInfo.copy()) {}
 
+    bool canSetConcurrently(ExecutionContext* context) const override;
     void set(ExecutionContext* context) override;
 
     std::unique_ptr<NodeSetExecutor> copy() const override {
@@ -87,6 +92,7 @@ public:
     MultiLabelNodeSetExecutor(const MultiLabelNodeSetExecutor& other)
         : NodeSetExecutor{other}, tableInfos{copyUnorderedMap(other.tableInfos)} {}
 
+    bool canSetConcurrently(ExecutionContext* context) const override;
     void set(ExecutionContext* context) override;
 
     std::unique_ptr<NodeSetExecutor> copy() const override {
@@ -146,7 +152,11 @@ public:
     void init(ResultSet* resultSet, ExecutionContext* context);
 
     void setRelID(common::nodeID_t relID) const;
+    common::nodeID_t getRelID() const;
 
+    // Whether the next set only touches thread-safe update paths of committed rels. See
+    // SetSharedState.
+    bool canSetConcurrently() const;
     virtual void set(ExecutionContext* context) = 0;
 
     virtual std::unique_ptr<RelSetExecutor> copy() const = 0;
@@ -4,16 +4,19 @@
 
 #include "binder/expression/expression.h"
 #include "common/enums/accumulate_type.h"
+#include "common/system_config.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/streaming_result_queue.h"
 
 namespace lbug {
 namespace processor {
 
 class ResultCollectorSharedState {
 public:
-    explicit ResultCollectorSharedState(std::shared_ptr<FactorizedTable> table)
-        : table{std::move(table)} {}
+    explicit ResultCollectorSharedState(std::shared_ptr<FactorizedTable> table,
+        std::shared_ptr<StreamingResultQueue> streamingQueue = nullptr)
+        : table{std::move(table)}, streamingQueue{std::move(streamingQueue)} {}
 
     void mergeLocalTable(FactorizedTable& localTable) {
         std::unique_lock lck{mtx};
@@ -22,9 +25,13 @@ public:
 
     std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    // Set if results are streamed to the client instead of being merged into table.
+    std::shared_ptr<StreamingResultQueue> getStreamingQueue() const { return streamingQueue; }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    std::shared_ptr<StreamingResultQueue> streamingQueue;
 };
 
 struct ResultCollectorInfo {
@@ -66,6 +73,11 @@ class ResultCollector final : public Sink {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::RESULT_COLLECTOR;
 
 public:
+    // Number of flat tuples collected before a chunk is handed to a streaming result.
+    static constexpr uint64_t STREAMING_CHUNK_NUM_TUPLES = common::DEFAULT_VECTOR_CAPACITY;
+    // Number of chunks a streaming result buffers before the collector blocks.
+    static constexpr uint64_t STREAMING_QUEUE_CAPACITY = 4;
+
     ResultCollector(ResultCollectorInfo info,
         std::shared_ptr<ResultCollectorSharedState> sharedState,
         std::unique_ptr<PhysicalOperator> child, uint32_t id,
@@ -83,6 +95,10 @@ public:
 
     std::unique_ptr<main::QueryResult> getQueryResult() const override;
 
+    std::shared_ptr<StreamingResultQueue> getStreamingQueue() const {
+        return sharedState->getStreamingQueue();
+    }
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return std::make_unique<ResultCollector>(info.copy(), sharedState, children[0]->copy(), id,
             printInfo->copy());
@@ -93,6 +109,9 @@ private:
 
     void initNecessaryLocalState(ResultSet* resultSet, ExecutionContext* context);
 
+    // Hands the local table to the streaming queue and starts a new one.
+    void pushLocalTable(StreamingResultQueue& queue, ExecutionContext* context);
+
 private:
     ResultCollectorInfo info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
@@ -101,6 +120,9 @@ private:
 
     std::unique_ptr<common::ValueVector> markVector;
     std::unique_ptr<FactorizedTable> localTable;
+    // States of the unflat payload vectors, used to count the flat tuples of a streaming chunk.
+    std::vector<common::DataChunkState*> unFlatPayloadStates;
+    uint64_t numFlatTuplesInLocalTable = 0;
 };
 
 } // namespace processor
@@ -91,6 +91,10 @@ public:
 
     common::table_id_map_t<common::SemiMask*> getSemiMasks() const;
 
+    // Adds a zone map predicate on the idx-th property to the scan of each table. Returns false if
+    // no table can evaluate it.
+    bool addColumnPredicate(common::idx_t idx, const storage::ColumnPredicate& predicate);
+
     bool isSource() const override { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
@@ -1,17 +1,30 @@
 #pragma once
 
 #include "binder/expression/expression.h"
+#include "common/bloom_filter.h"
 #include "processor/operator/physical_operator.h"
 #include "storage/table/table.h"
 
 namespace lbug {
 namespace processor {
 
+// Bloom filter of the keys on the build side of a hash join, passed sideways to a scan on the probe
+// side of the join.
+struct ScanBloomFilterInfo {
+    std::shared_ptr<common::BloomFilter> bloomFilter;
+    // Position of the probe key among the output vectors of the scan.
+    DataPos keyPos;
+
+    ScanBloomFilterInfo(std::shared_ptr<common::BloomFilter> bloomFilter, DataPos keyPos)
+        : bloomFilter{std::move(bloomFilter)}, keyPos{keyPos} {}
+};
+
 struct ScanOpInfo {
     // Node ID vector position.
     DataPos nodeIDPos;
     // Output vector (properties or CSRs) positions
     std::vector<DataPos> outVectorsPos;
+    std::vector<ScanBloomFilterInfo> bloomFilterInfos;
 
     ScanOpInfo(DataPos nodeIDPos, std::vector<DataPos> outVectorsPos)
         : nodeIDPos{nodeIDPos}, outVectorsPos{std::move(outVectorsPos)} {}
@@ -19,7 +32,8 @@ struct ScanOpInfo {
 
 private:
     ScanOpInfo(const ScanOpInfo& other)
-        : nodeIDPos{other.nodeIDPos}, outVectorsPos{other.outVectorsPos} {}
+        : nodeIDPos{other.nodeIDPos}, outVectorsPos{other.outVectorsPos},
+          bloomFilterInfos{other.bloomFilterInfos} {}
 };
 
 // For multi-table scan, a column with the same name could be of different types. In such case,
@@ -63,7 +77,11 @@ struct ScanTableInfo {
         : table{table}, columnPredicates{std::move(columnPredicates)} {}
     virtual ~ScanTableInfo() = default;
 
-    void addColumnInfo(common::column_id_t columnID, ColumnCaster caster);
+    void addColumnInfo(common::column_id_t columnID, ColumnCaster caster,
+        std::vector<common::struct_field_path_t> fieldPaths = {});
+    // Adds a zone map predicate on the idx-th column. Returns false if the column is not stored
+    // with the type of the predicate, i.e. it does not exist or needs a cast.
+    bool addColumnPredicate(common::idx_t idx, std::unique_ptr<storage::ColumnPredicate> predicate);
 
     virtual void initScanState(storage::TableScanState& scanState,
         const std::vector<common::ValueVector*>& outVectors, main::ClientContext* context) = 0;
@@ -74,7 +92,8 @@ protected:
     ScanTableInfo(const ScanTableInfo& other)
         : table{other.table}, columnIDs{other.columnIDs},
           columnPredicates{copyVector(other.columnPredicates)},
-          columnCasters{copyVector(other.columnCasters)}, hasColumnCaster{other.hasColumnCaster} {}
+          columnFieldPaths{other.columnFieldPaths}, columnCasters{copyVector(other.columnCasters)},
+          hasColumnCaster{other.hasColumnCaster} {}
 
     void initScanStateVectors(storage::TableScanState& scanState,
         const std::vector<common::ValueVector*>& outVectors, storage::MemoryManager* memoryManager);
@@ -83,6 +102,8 @@ protected:
     std::vector<common::column_id_t> columnIDs;
     // Column predicates for zone map
     std::vector<storage::ColumnPredicateSet> columnPredicates;
+    // Nested fields to read for each column. Empty means the whole column is read.
+    std::vector<std::vector<common::struct_field_path_t>> columnFieldPaths;
     // Column cast handler for multi table scan of the same column name but different type
     std::vector<ColumnCaster> columnCasters;
     bool hasColumnCaster = false;
@@ -100,12 +121,38 @@ public:
         std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{operatorType, id, std::move(printInfo)}, opInfo{std::move(info)} {}
 
+    void addBloomFilter(std::shared_ptr<common::BloomFilter> bloomFilter, DataPos keyPos) {
+        opInfo.bloomFilterInfos.emplace_back(std::move(bloomFilter), keyPos);
+    }
+
 protected:
-    void initLocalStateInternal(ResultSet*, ExecutionContext*) override;
+    void initLocalStateInternal(ResultSet*, ExecutionContext* context) override;
+
+    // Drops the output tuples whose key is not in one of the Bloom filters. Returns false if no
+    // tuple is left.
+    bool applyBloomFilters();
+
+private:
+    struct BloomFilterLocalState {
+        common::ValueVector* keyVector;
+        // A filter that drops too few tuples is no longer checked.
+        bool enabled = true;
+        uint64_t numCheckedTuples = 0;
+        uint64_t numPassedTuples = 0;
+
+        explicit BloomFilterLocalState(common::ValueVector* keyVector) : keyVector{keyVector} {}
+    };
+
+    // Number of tuples checked against a filter before deciding whether it is selective enough.
+    static constexpr uint64_t NUM_TUPLES_TO_SAMPLE = 16 * common::DEFAULT_VECTOR_CAPACITY;
 
 protected:
     ScanOpInfo opInfo;
     std::vector<common::ValueVector*> outVectors;
+
+private:
+    std::vector<BloomFilterLocalState> bloomFilterStates;
+    std::unique_ptr<common::ValueVector> hashVector;
 };
 
 } // namespace processor
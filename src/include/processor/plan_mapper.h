@@ -31,6 +31,10 @@ namespace catalog {
 class TableCatalogEntry;
 }
 
+namespace storage {
+class DynamicBound;
+}
+
 namespace planner {
 class LogicalSemiMasker;
 struct LogicalInsertInfo;
@@ -41,6 +45,7 @@ class LogicalPlan;
 namespace processor {
 
 struct HashJoinBuildInfo;
+class HashJoinSharedState;
 struct AggregateInfo;
 class NodeInsertExecutor;
 class RelInsertExecutor;
@@ -172,9 +177,11 @@ public:
     std::unique_ptr<PhysicalOperator> mapExtensionClause(
         const planner::LogicalOperator* logicalOperator);
 
+    // If streaming, the collector hands its results to a StreamingResultQueue instead of
+    // materializing them.
     std::unique_ptr<ResultCollector> createResultCollector(common::AccumulateType accumulateType,
         const binder::expression_vector& expressions, planner::Schema* schema,
-        std::unique_ptr<PhysicalOperator> prevOperator);
+        std::unique_ptr<PhysicalOperator> prevOperator, bool streaming = false);
     std::unique_ptr<PhysicalOperator> createArrowResultCollector(
         common::ArrowResultConfig arrowConfig, const binder::expression_vector& expressions,
         planner::Schema* schema, std::unique_ptr<PhysicalOperator> prevOperator);
@@ -232,6 +239,17 @@ public:
         DataPos pkPos) const;
 
     static void mapSIPJoin(PhysicalOperator* joinRoot);
+    // Passes a Bloom filter and the range of the build keys of a hash join to the scan of its
+    // probe key.
+    void mapDynamicFilterSIP(const planner::LogicalOperator& target,
+        const binder::Expression& probeKey, HashJoinSharedState& sharedState);
+    // Adds a zone map predicate on expression, whose bound is only known at runtime, to the scan
+    // target. Returns false if the target cannot evaluate it.
+    bool mapDynamicPredicate(const planner::LogicalOperator& target,
+        const binder::Expression& expression, std::shared_ptr<storage::DynamicBound> bound,
+        bool canSkipNulls);
+    static bool canParallelizeWrite(PhysicalOperator* child);
+    static void disableUnsafeParallelWrites(PhysicalOperator* op, bool canFollowWrite);
 
     static std::vector<DataPos> getDataPos(const binder::expression_vector& expressions,
         const planner::Schema& schema);
@@ -10,6 +10,7 @@ namespace processor {
 class FactorizedTable;
 class PhysicalPlan;
 class PhysicalOperator;
+class ProcessorTask;
 class QueryProcessor {
 
 public:
@@ -23,8 +24,16 @@ public:
 
     std::unique_ptr<main::QueryResult> execute(PhysicalPlan* physicalPlan,
         ExecutionContext* context);
+    // Executes a plan whose result collector streams its result. Returns once the result has been
+    // handed out completely or the execution failed. Pipelines below the root one run on the
+    // workers of the scheduler as usual. The root pipeline, which blocks on the client reading the
+    // result, runs in parallel on threads of its own so that it never holds on to the workers.
+    void executeStreaming(PhysicalPlan* physicalPlan, ExecutionContext* context);
 
 private:
+    std::shared_ptr<ProcessorTask> createTask(PhysicalPlan* physicalPlan,
+        ExecutionContext* context);
+
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
     void initTask(common::Task* task);
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace lbug {
+namespace processor {
+
+class FactorizedTable;
+
+// Bounded queue of result chunks between the result collectors of a streaming query, which
+// produce them on the threads of its root pipeline, and the streaming query result, which hands
+// them to the client. Producers block while the queue is full, so unread results are never
+// materialized beyond the capacity of the queue and the chunks the producers are filling.
+class StreamingResultQueue {
+public:
+    explicit StreamingResultQueue(uint64_t capacity) : capacity{capacity} {}
+
+    // Blocks while the queue is full. Returns false if the consumer closed the queue, in which
+    // case the chunk is dropped and the producer should stop.
+    bool push(std::unique_ptr<FactorizedTable> chunk);
+    // Blocks until a chunk is available. Returns nullptr once the producers finished and all chunks
+    // have been consumed, or once the queue is closed. Rethrows the exception of a failed producer.
+    std::unique_ptr<FactorizedTable> pop();
+
+    // Called once all producers have no more chunks to push.
+    void finish(std::exception_ptr producerException = nullptr);
+    // Called by the consumer to discard pending chunks and unblock the producers.
+    void close();
+
+    bool isFinished();
+
+private:
+    std::mutex mtx;
+    // Producers wait on notFull, the consumer on notEmpty.
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    std::deque<std::unique_ptr<FactorizedTable>> chunks;
+    uint64_t capacity;
+    bool finished = false;
+    bool closed = false;
+    std::exception_ptr exception;
+};
+
+} // namespace processor
+} // namespace lbug
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "column_predicate.h"
+#include "storage/compression/compression.h"
+
+namespace lbug {
+namespace storage {
+
+// Lower or upper bound of a column that is only known while the query runs, e.g. the smallest build
+// key of a hash join or the boundary of a full top-k heap. The bound only tightens, so scans may
+// check it while it is being updated.
+class DynamicBound {
+public:
+    DynamicBound(common::PhysicalTypeID physicalType, bool isLowerBound)
+        : physicalType{physicalType}, isLowerBound{isLowerBound} {}
+
+    // Whether values of the type can be bounded, i.e. have zone maps.
+    static bool isSupported(const common::LogicalType& type);
+
+    void tighten(StorageValue value);
+    // Returns nullopt until the bound has been published.
+    std::optional<StorageValue> get() const;
+
+    common::PhysicalTypeID getPhysicalType() const { return physicalType; }
+    bool isLower() const { return isLowerBound; }
+
+private:
+    mutable std::mutex mtx;
+    std::atomic<bool> published = false;
+    common::PhysicalTypeID physicalType;
+    bool isLowerBound;
+    StorageValue value{};
+};
+
+// Compares a column against a dynamic bound (>= for a lower bound, <= for an upper bound). Until
+// the bound is published, the predicate skips nothing.
+class ColumnDynamicPredicate : public ColumnPredicate {
+public:
+    // If canSkipNulls is false, nulls are considered to pass the predicate, so that chunks which
+    // may contain nulls are never skipped.
+    ColumnDynamicPredicate(std::string columnName, std::shared_ptr<DynamicBound> bound,
+        bool canSkipNulls)
+        : ColumnPredicate{std::move(columnName),
+              bound->isLower() ? common::ExpressionType::GREATER_THAN_EQUALS :
+                                 common::ExpressionType::LESS_THAN_EQUALS},
+          bound{std::move(bound)}, canSkipNulls{canSkipNulls} {}
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+
+    std::string toString() override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnDynamicPredicate>(columnName, bound, canSkipNulls);
+    }
+
+private:
+    std::shared_ptr<DynamicBound> bound;
+    bool canSkipNulls;
+};
+
+} // namespace storage
+} // namespace lbug
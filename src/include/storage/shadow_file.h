@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "common/types/uuid.h"
 #include "storage/file_handle.h"
 
@@ -24,15 +26,17 @@ struct ShadowFileHeader {
 static_assert(std::is_trivially_copyable_v<ShadowFileHeader>);
 
 class BufferManager;
-// NOTE: This class is NOT thread-safe for now, as we are not checkpointing in parallel yet.
+// Shadow pages are created concurrently when node groups are checkpointed in parallel, so accesses
+// to the shadow page map are serialized. Callers must not shadow the same original page from
+// multiple threads.
 class ShadowFile {
 public:
     ShadowFile(BufferManager& bm, common::VirtualFileSystem* vfs, const std::string& databasePath);
 
     // TODO(Guodong): Remove originalFile param.
     bool hasShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage) const {
-        return shadowPagesMap.contains(originalFile) &&
-               shadowPagesMap.at(originalFile).contains(originalPage);
+        std::unique_lock lck{mtx};
+        return hasShadowPageNoLock(originalFile, originalPage);
     }
     void clearShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage);
     common::page_idx_t getShadowPage(common::file_idx_t originalFile,
@@ -55,6 +59,11 @@ public:
     static void replayShadowPageRecords(main::ClientContext& context);
 
 private:
+    bool hasShadowPageNoLock(common::file_idx_t originalFile,
+        common::page_idx_t originalPage) const {
+        return shadowPagesMap.contains(originalFile) &&
+               shadowPagesMap.at(originalFile).contains(originalPage);
+    }
     FileHandle* getOrCreateShadowingFH();
 
 private:
@@ -69,6 +78,7 @@ private:
         std::unordered_map<common::page_idx_t, common::page_idx_t>>
         shadowPagesMap;
     std::vector<ShadowPageRecord> shadowPageRecords;
+    mutable std::mutex mtx;
 };
 
 } // namespace storage
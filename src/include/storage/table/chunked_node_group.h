@@ -229,6 +229,8 @@ public:
         common::transaction_t commitTS);
     void rollbackDelete(common::row_idx_t startRow, common::row_idx_t numRows_,
         common::transaction_t commitTS);
+    void collapseInsertVersions(common::row_idx_t startRow, common::row_idx_t numRows_,
+        common::transaction_t commitTS);
     virtual void reclaimStorage(PageAllocator& pageAllocator) const;
 
     uint64_t getEstimatedMemoryUsage() const;
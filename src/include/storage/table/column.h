@@ -64,6 +64,10 @@ public:
     // Scan to raw data (does not scan any nested data and should only be used on primitive columns)
     void scanSegment(const SegmentState& state, common::offset_t startOffsetInSegment,
         common::offset_t length, uint8_t* result) const;
+    // Restrict scans with the given state to the nested fields in `fieldPaths`. An empty list or an
+    // empty path keeps every field.
+    virtual void projectFields(SegmentState& /*state*/,
+        const std::vector<common::struct_field_path_t>& /*fieldPaths*/) const {}
 
     common::LogicalType& getDataType() { return dataType; }
     const common::LogicalType& getDataType() const { return dataType; }
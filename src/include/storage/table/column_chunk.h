@@ -163,6 +163,9 @@ public:
         common::sel_t posInOutputVector) const;
     void update(const transaction::Transaction* transaction, common::offset_t offsetInChunk,
         const common::ValueVector& values);
+    // Writes the committed updates of the vector into in-memory data and drops their versions.
+    // On-disk chunks keep their updates until the next checkpoint.
+    void collapseUpdates(common::idx_t vectorIdx);
 
     uint64_t getEstimatedMemoryUsage() const {
         if (getResidencyState() == ResidencyState::ON_DISK) {
@@ -47,6 +47,8 @@ struct SegmentState {
 
     // Used for struct/list/string columns.
     std::vector<SegmentState> childrenStates;
+    // Set on struct field states that a scan does not need to read.
+    bool skipScan = false;
 
     // Used for floating point columns
     std::variant<std::unique_ptr<InMemoryExceptionChunk<double>>,
@@ -157,6 +157,11 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
         Column* csrOffsetCol, Column* csrLengthCol)
         : NodeGroupCheckpointState{std::move(columnIDs), std::move(columns), pageAllocator, mm},
           csrOffsetColumn{csrOffsetCol}, csrLengthColumn{csrLengthCol} {}
+
+    std::unique_ptr<NodeGroupCheckpointState> copy(PageAllocator& allocator) const override {
+        return std::make_unique<CSRNodeGroupCheckpointState>(columnIDs, columns, allocator, mm,
+            csrOffsetColumn, csrLengthColumn);
+    }
 };
 
 static constexpr common::column_id_t NBR_ID_COLUMN_ID = 0;
@@ -169,6 +174,10 @@ static constexpr common::column_id_t REL_ID_COLUMN_ID = 1;
 // Transient data are organized similar to normal node groups. Tuples are always appended to the end
 // of `chunkedGroups`. We keep an extra csrIndex to track the vector of row indices for each bound
 // node.
+// Transient data are never persisted as is: every checkpoint, including the one that ends a COPY
+// into a non-empty rel table, merges them into the CSR regions they belong to. Only node groups
+// with transient data, deletions or updates are checkpointed, so the cost of appending a batch of
+// rels is proportional to the node groups it touches rather than to the whole table.
 class CSRNodeGroup final : public NodeGroup {
 public:
     static constexpr PackedCSRInfo DEFAULT_PACKED_CSR_INFO{};
@@ -259,6 +268,8 @@ private:
     void collectOnDiskRegionChangesAndUpdateHeaderLength(const common::UniqLock& lock,
         CSRRegion& region, const CSRNodeGroupCheckpointState& csrState) const;
 
+    bool hasChangesToCheckpoint(const common::UniqLock& lock,
+        const CSRNodeGroupCheckpointState& csrState) const;
     std::vector<CSRRegion> collectLeafRegionsAndCSRLength(const common::UniqLock& lock,
         const CSRNodeGroupCheckpointState& csrState) const;
     void collectPersistentUpdatesInRegion(CSRRegion& region,
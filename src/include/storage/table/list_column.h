@@ -65,6 +65,9 @@ public:
     Column* getSizeColumn() const { return sizeColumn.get(); }
     Column* getDataColumn() const { return dataColumn.get(); }
 
+    void projectFields(SegmentState& state,
+        const std::vector<common::struct_field_path_t>& fieldPaths) const override;
+
     std::vector<std::unique_ptr<ColumnChunkData>> checkpointSegment(
         ColumnCheckpointState&& checkpointState, PageAllocator& pageAllocator,
         bool canSplitSegment = true) const override;
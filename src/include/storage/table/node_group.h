@@ -55,6 +55,13 @@ struct NodeGroupCheckpointState {
           pageAllocator{pageAllocator}, mm{mm} {}
     virtual ~NodeGroupCheckpointState() = default;
 
+    // Node groups of a collection can be checkpointed concurrently. Each node group gets its own
+    // copy of the state, which shares the columns but allocates pages from the given allocator and
+    // has none of the per-group scratch.
+    virtual std::unique_ptr<NodeGroupCheckpointState> copy(PageAllocator& allocator) const {
+        return std::make_unique<NodeGroupCheckpointState>(columnIDs, columns, allocator, mm);
+    }
+
     template<typename T>
     const T& cast() const {
         return common::ku_dynamic_cast<const T&>(*this);
@@ -5,6 +5,9 @@
 #include "storage/table/node_group.h"
 
 namespace lbug {
+namespace main {
+class ClientContext;
+}
 namespace transaction {
 class Transaction;
 }
@@ -76,7 +79,9 @@ public:
 
     uint64_t getEstimatedMemoryUsage() const;
 
-    void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
+    // Node groups are checkpointed in parallel on the task scheduler of the given context.
+    void checkpoint(main::ClientContext* context, MemoryManager& memoryManager,
+        NodeGroupCheckpointState& state);
     void reclaimStorage(PageAllocator& pageAllocator) const;
 
     TableStats getStats() const {
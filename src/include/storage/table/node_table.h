@@ -193,6 +193,9 @@ public:
     }
 
     common::node_group_idx_t getNumNodeGroups() const { return nodeGroups->getNumNodeGroups(); }
+    // Whether any node group still holds rows deleted by transactions visible to `transaction`.
+    // Node groups whose rows are all deleted are emptied at checkpoint and do not count.
+    bool hasDeletions(const transaction::Transaction* transaction) const;
     common::offset_t getNumTuplesInNodeGroup(common::node_group_idx_t nodeGroupIdx) const {
         return nodeGroups->getNodeGroup(nodeGroupIdx)->getNumRows();
     }
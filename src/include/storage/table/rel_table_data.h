@@ -20,6 +20,14 @@ class Table;
 class MemoryManager;
 class RelTableData;
 
+// Location of a committed rel inside the CSR list of its bound node.
+struct CSRRelPosition {
+    common::nodeID_t nbrNodeID;
+    common::offset_t relOffset;
+    CSRNodeGroupScanSource source;
+    common::row_idx_t rowIdx;
+};
+
 struct CSRHeaderColumns {
     std::unique_ptr<Column> offset;
     std::unique_ptr<Column> length;
@@ -64,6 +72,14 @@ public:
         const common::ValueVector& dataVector) const;
     bool delete_(transaction::Transaction* transaction, common::ValueVector& boundNodeIDVector,
         const common::ValueVector& relIDVector);
+    // Appends the positions of all committed rels of the bound node visible to the transaction.
+    void scanCommittedRelPositions(transaction::Transaction* transaction,
+        common::ValueVector& boundNodeIDVector, std::vector<CSRRelPosition>& positions) const;
+    // Deletes the given rels of a node group by row position. Consecutive rows share one undo
+    // record, and each deleted rel is added to the transaction's write set. Returns the number of
+    // rels deleted.
+    common::row_idx_t deleteByPositions(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx, std::vector<CSRRelPosition>& positions);
     void addColumn(TableAddColumnState& addColumnState, PageAllocator& pageAllocator);
 
     bool checkIfNodeHasRels(transaction::Transaction* transaction,
@@ -97,7 +113,7 @@ public:
     TableStats getStats() const { return nodeGroups->getStats(); }
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
-    void checkpoint(const std::vector<common::column_id_t>& columnIDs,
+    void checkpoint(main::ClientContext* context, const std::vector<common::column_id_t>& columnIDs,
         PageAllocator& pageAllocator);
 
     void pushInsertInfo(const transaction::Transaction* transaction, const CSRNodeGroup& nodeGroup,
@@ -19,6 +19,10 @@ public:
         KU_ASSERT(childIdx < childColumns.size());
         return childColumns[childIdx].get();
     }
+
+    void projectFields(SegmentState& state,
+        const std::vector<common::struct_field_path_t>& fieldPaths) const override;
+
     void writeSegment(ColumnChunkData& persistentChunk, SegmentState& state,
         common::offset_t offsetInSegment, const ColumnChunkData& data, common::offset_t dataOffset,
         common::length_t numValues) const override;
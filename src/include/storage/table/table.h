@@ -37,6 +37,8 @@ struct LBUG_API TableScanState {
     std::unique_ptr<NodeGroupScanState> nodeGroupScanState;
 
     std::vector<ColumnPredicateSet> columnPredicateSets;
+    // Nested fields to read for each column. Empty means the whole column is read.
+    std::vector<std::vector<common::struct_field_path_t>> columnFieldPaths;
 
     TableScanState(common::ValueVector* nodeIDVector,
         std::vector<common::ValueVector*> outputVectors,
@@ -100,6 +100,11 @@ public:
 
     void commit(common::idx_t vectorIdx, VectorUpdateInfo* info, common::transaction_t commitTS);
     void rollback(common::idx_t vectorIdx, common::transaction_t version);
+    // Calls `applyFunc` on the versions of the vector from oldest to newest and drops the chain.
+    // Does nothing if any version is uncommitted. Only valid when no active transaction can read
+    // the replaced values.
+    void collapse(common::idx_t vectorIdx,
+        const std::function<void(const VectorUpdateInfo&)>& applyFunc);
 
     common::row_idx_t getNumUpdatedRows(const transaction::Transaction* transaction) const;
 
@@ -49,6 +49,11 @@ public:
     void commitDelete(common::row_idx_t startRow, common::row_idx_t numRows,
         common::transaction_t commitTS);
     void rollbackDelete(common::row_idx_t startRow, common::row_idx_t numRows);
+    // Marks full vectors overlapping [startRow, startRow + numRows) whose rows are all committed as
+    // inserted for every transaction, so scans skip the per-row timestamp checks. Only valid when
+    // no active transaction started before those rows were committed.
+    void collapseInsertions(common::row_idx_t startRow, common::row_idx_t numRows,
+        common::row_idx_t numRowsInGroup);
 
     void serialize(common::Serializer& serializer) const;
     static std::unique_ptr<VersionInfo> deserialize(common::Deserializer& deSer);
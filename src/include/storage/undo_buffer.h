@@ -61,6 +61,7 @@ private:
     const UndoBuffer& undoBuffer;
 };
 
+class ColumnChunk;
 class UpdateInfo;
 class VersionInfo;
 struct VectorUpdateInfo;
@@ -87,11 +88,15 @@ public:
         common::row_idx_t numRows, const VersionRecordHandler* versionRecordHandler);
     void createDeleteInfo(common::node_group_idx_t nodeGroupIdx, common::row_idx_t startRow,
         common::row_idx_t numRows, const VersionRecordHandler* versionRecordHandler);
-    void createVectorUpdateInfo(UpdateInfo* updateInfo, common::idx_t vectorIdx,
-        VectorUpdateInfo* vectorUpdateInfo, common::transaction_t version);
+    void createVectorUpdateInfo(ColumnChunk* columnChunk, UpdateInfo* updateInfo,
+        common::idx_t vectorIdx, VectorUpdateInfo* vectorUpdateInfo,
+        common::transaction_t version);
 
     void commit(common::transaction_t commitTS) const;
     void rollback(main::ClientContext* context) const;
+    // Must be called after `commit`. Collapses the insertion versions and update chains touched by
+    // the committed records, so later scans take the fast path without per-row version checks.
+    void collapseCommittedVersions() const;
 
 private:
     uint8_t* createUndoRecord(uint64_t size);
@@ -119,6 +124,8 @@ private:
     static void commitVectorUpdateInfo(const uint8_t* record, common::transaction_t commitTS);
     static void rollbackVectorUpdateInfo(const uint8_t* record);
 
+    static void collapseRecord(UndoRecordType recordType, const uint8_t* record);
+
 private:
     std::mutex mtx;
     MemoryManager* mm;
@@ -13,6 +13,8 @@ class ChecksumReader : public common::Reader {
 public:
     explicit ChecksumReader(common::FileInfo& fileInfo, MemoryManager& memoryManager,
         std::string_view checksumMismatchMessage);
+    ChecksumReader(std::unique_ptr<common::Reader> reader, MemoryManager& memoryManager,
+        std::string_view checksumMismatchMessage);
 
     void read(uint8_t* data, uint64_t size) override;
     bool finished() override;
@@ -23,6 +25,7 @@ public:
     // stored value
     void onObjectEnd() override;
 
+    // Only valid if reading from a file.
     uint64_t getReadOffset() const;
 
 private:
@@ -23,6 +23,9 @@ enum class WALRecordType : uint8_t {
                         // accidentally read from an empty buffer.
     BEGIN_TRANSACTION_RECORD = 1,
     COMMIT_RECORD = 2,
+    // The records of a committed transaction, from BEGIN_TRANSACTION_RECORD to COMMIT_RECORD,
+    // compressed together with zstd.
+    COMPRESSED_TRANSACTION_RECORD = 3,
 
     COPY_TABLE_RECORD = 13,
     CREATE_CATALOG_ENTRY_RECORD = 14,
@@ -82,6 +85,22 @@ struct CommitRecord final : WALRecord {
     static std::unique_ptr<CommitRecord> deserialize(common::Deserializer& deserializer);
 };
 
+// Written instead of the records of a committed transaction when WAL compression is enabled and the
+// records are large enough to be worth compressing. Deserializing it decompresses the records.
+struct CompressedTransactionRecord final : WALRecord {
+    uint64_t uncompressedSize = 0;
+    std::vector<uint8_t> compressedData;
+    std::vector<std::unique_ptr<WALRecord>> records;
+
+    CompressedTransactionRecord() : WALRecord{WALRecordType::COMPRESSED_TRANSACTION_RECORD} {}
+    // Compresses the given serialized records.
+    CompressedTransactionRecord(const uint8_t* data, uint64_t size);
+
+    void serialize(common::Serializer& serializer) const override;
+    static std::unique_ptr<CompressedTransactionRecord> deserialize(
+        common::Deserializer& deserializer, const main::ClientContext& clientContext);
+};
+
 struct CheckpointRecord final : WALRecord {
     CheckpointRecord() : WALRecord{WALRecordType::CHECKPOINT_RECORD} {}
 
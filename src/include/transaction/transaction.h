@@ -2,6 +2,8 @@
 
 #include <atomic>
 #include <mutex>
+#include <span>
+#include <unordered_map>
 
 #include "common/types/types.h"
 
@@ -27,6 +29,7 @@ class VersionInfo;
 class UpdateInfo;
 struct VectorUpdateInfo;
 class ChunkedNodeGroup;
+class ColumnChunk;
 class VersionRecordHandler;
 } // namespace storage
 namespace transaction {
@@ -74,6 +77,34 @@ private:
     std::mutex mtx;
 };
 
+// Rows of committed data updated or deleted by a write transaction, grouped by table. When
+// multiple write transactions are enabled, the write set of a committing transaction is validated
+// against the write sets of transactions that committed after it started, so that the first
+// committer wins. Rows are kept as ranges of offsets, so that a bulk update or delete of
+// consecutive rows takes up a single range instead of an entry per row.
+class WriteSet {
+    struct OffsetRange {
+        common::offset_t start;
+        common::offset_t end;
+    };
+
+public:
+    void insert(common::table_id_t tableID, common::offset_t offset);
+    void insert(common::table_id_t tableID, std::span<const common::offset_t> offsets);
+    bool empty() const { return ranges.empty(); }
+    // Sorts and merges the ranges of each table. Must be called once all rows are inserted and
+    // before checking for overlaps.
+    void finalize();
+    bool overlaps(const WriteSet& other) const;
+
+private:
+    void insertNoLock(common::table_id_t tableID, common::offset_t offset);
+
+private:
+    std::mutex mtx;
+    std::unordered_map<common::table_id_t, std::vector<OffsetRange>> ranges;
+};
+
 class LBUG_API Transaction {
     friend class TransactionManager;
 
@@ -103,6 +134,7 @@ public:
     int64_t getCurrentTS() const { return currentTS; }
 
     void setForceCheckpoint() { forceCheckpoint = true; }
+    bool hasUncommittedCatalogChanges() const { return hasCatalogChanges; }
     bool shouldAppendToUndoBuffer() const {
         // Only write transactions and recovery transactions should append to the undo buffer.
         return isWriteTransaction() || isRecovery();
@@ -142,8 +174,25 @@ public:
         common::row_idx_t numRows, const storage::VersionRecordHandler* versionRecordHandler) const;
     void pushDeleteInfo(common::node_group_idx_t nodeGroupIdx, common::row_idx_t startRow,
         common::row_idx_t numRows, const storage::VersionRecordHandler* versionRecordHandler) const;
-    void pushVectorUpdateInfo(storage::UpdateInfo& updateInfo, common::idx_t vectorIdx,
-        storage::VectorUpdateInfo& vectorUpdateInfo, common::transaction_t version) const;
+    void pushVectorUpdateInfo(storage::ColumnChunk& columnChunk, storage::UpdateInfo& updateInfo,
+        common::idx_t vectorIdx, storage::VectorUpdateInfo& vectorUpdateInfo,
+        common::transaction_t version) const;
+    // Drops the version bookkeeping of this transaction's committed changes. Only valid when no
+    // other transaction is active, as none can read the versions they replaced.
+    void collapseCommittedVersions() const;
+    // Records a committed row updated or deleted by this transaction. No-op unless multiple write
+    // transactions are enabled, as a single writer can never conflict.
+    void addToWriteSet(common::table_id_t tableID, common::offset_t offset) const {
+        if (writeSet) {
+            writeSet->insert(tableID, offset);
+        }
+    }
+    void addToWriteSet(common::table_id_t tableID,
+        std::span<const common::offset_t> offsets) const {
+        if (writeSet) {
+            writeSet->insert(tableID, offsets);
+        }
+    }
 
     static Transaction* Get(const main::ClientContext& context);
 
@@ -160,6 +209,7 @@ private:
     std::unique_ptr<storage::LocalStorage> localStorage;
     std::unique_ptr<storage::UndoBuffer> undoBuffer;
     std::unique_ptr<storage::LocalWAL> localWAL;
+    std::unique_ptr<WriteSet> writeSet;
     LocalCacheManager localCacheManager;
     bool forceCheckpoint;
     std::atomic<bool> hasCatalogChanges;
@@ -51,12 +51,29 @@ public:
 private:
     bool hasNoActiveTransactions() const;
     void checkpointNoLock(main::ClientContext& clientContext);
+    // Runs an auto checkpoint that was deferred because other transactions were active, once the
+    // last of them has left the system.
+    void checkpointIfPendingNoLock(main::ClientContext& clientContext);
+    // Same as above, for transactions that wrote nothing. A failed checkpoint is not reported to
+    // them. It is kept pending and reported to the next write transaction that commits.
+    void tryCheckpointIfPendingNoLock(main::ClientContext& clientContext);
+    // Holds back a new write transaction while an auto checkpoint that was deferred too many times
+    // is waiting for the active transactions to leave. Read-only transactions are never held back.
+    void waitForDeferredCheckpoint();
 
     // This functions locks the mutex to start new transactions.
     common::UniqLock stopNewTransactionsAndWaitUntilAllTransactionsLeave();
 
     bool hasActiveWriteTransactionNoLock() const;
 
+    // Throws if the transaction updated or deleted a row that a write transaction committed
+    // after it started also updated or deleted (first committer wins).
+    void validateWriteSetNoLock(Transaction& transaction) const;
+    // Keeps the write set of a committed transaction as long as there are active write
+    // transactions that started before it committed.
+    void addCommittedWriteSetNoLock(Transaction& transaction);
+    void pruneCommittedWriteSetsNoLock();
+
     // Note: Used by DBTest::createDB only.
     void setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(uint64_t waitTimeInMicros) {
         checkpointWaitTimeoutInMicros = waitTimeInMicros;
@@ -75,6 +92,10 @@ private:
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
     uint64_t checkpointWaitTimeoutInMicros = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS;
+    bool hasPendingAutoCheckpoint = false;
+    uint64_t numDeferredAutoCheckpoints = 0;
+    // Commit timestamp and write set of recently committed write transactions, in commit order.
+    std::vector<std::pair<common::transaction_t, std::unique_ptr<WriteSet>>> committedWriteSets;
 
     init_checkpointer_func_t initCheckpointerFunc;
 };
@@ -1,8 +1,11 @@
 #include "main/client_context.h"
 
 #include "binder/binder.h"
+#include "binder/expression/parameter_expression.h"
+#include "catalog/catalog.h"
 #include "common/exception/checkpoint.h"
 #include "common/exception/connection.h"
+#include "common/exception/interrupt.h"
 #include "common/exception/runtime.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/random_engine.h"
@@ -15,13 +18,19 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/query_result/streaming_query_result.h"
+#include "optimizer/logical_operator_collector.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "planner/planner.h"
+#include "processor/operator/result_collector.h"
+#include "processor/physical_plan.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
+#include "processor/result/streaming_result_queue.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/storage_manager.h"
@@ -44,10 +53,11 @@ using namespace lbug::transaction;
 namespace lbug {
 namespace main {
 
-ActiveQuery::ActiveQuery() : interrupted{false} {}
+ActiveQuery::ActiveQuery() : interrupted{false}, interruptRequested{false} {}
 
 void ActiveQuery::reset() {
     interrupted = false;
+    interruptRequested = false;
     timer = Timer();
 }
 
@@ -56,6 +66,7 @@ ClientContext::ClientContext(Database* database) : localDatabase{database} {
     randomEngine = std::make_unique<RandomEngine>();
     remoteDatabase = nullptr;
     graphEntrySet = std::make_unique<graph::GraphEntrySet>();
+    cardinalityFeedback = std::make_unique<CardinalityFeedback>();
     clientConfig.homeDirectory = getUserHomeDir();
     clientConfig.fileSearchPath = "";
     clientConfig.enableSemiMask = ClientConfigDefault::ENABLE_SEMI_MASK;
@@ -76,8 +87,13 @@ ClientContext::ClientContext(Database* database) : localDatabase{database} {
 
 ClientContext::~ClientContext() {
     if (preventTransactionRollbackOnDestruction) {
+        if (streamingQuery) {
+            streamingQuery->queue->close();
+            streamingQuery->producer.join();
+        }
         return;
     }
+    finishStreamingQueryNoLock();
     if (transaction::Transaction::Get(*this)) {
         getDatabase()->transactionManager->rollback(*this, transaction::Transaction::Get(*this));
     }
@@ -266,6 +282,7 @@ void ClientContext::cleanUp() {
 std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_view query,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams) {
     std::unique_lock lck{mtx};
+    finishStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -312,6 +329,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
     // make sense to pass the map as a const reference.
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     if (!preparedStatement->isSuccess()) {
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
     }
@@ -329,22 +347,55 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     }
     // LCOV_EXCL_STOP
     auto cachedStatement = cachedPreparedStatementManager.getCachedStatement(name);
+    auto reuseTimer = TimeMetric(true /* enable */);
+    reuseTimer.start();
+    if (canReusePlan(*preparedStatement, *cachedStatement)) {
+        queryCache.recordHit();
+        // Substitute parameter values into the cached plan instead of re-planning.
+        for (auto& parameter : cachedStatement->parameters) {
+            parameter->setValue(*preparedStatement->parameterMap.at(parameter->getParameterName()));
+        }
+        reuseTimer.stop();
+        preparedStatement->preparedSummary.compilingTime = reuseTimer.getElapsedTimeMS();
+        return executeNoLock(preparedStatement, cachedStatement, queryID);
+    }
+    queryCache.recordMiss();
     // rebind
     auto [newPreparedStatement, newCachedStatement] =
         prepareNoLock(cachedStatement->parsedStatement, false /*shouldCommitNewTransaction*/,
             preparedStatement->parameterMap);
     useInternalCatalogEntry_ = false;
-    return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
+    if (!newPreparedStatement->isSuccess()) {
+        return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
+    }
+    // Keep the new plan for later executions.
+    *cachedStatement = std::move(*newCachedStatement);
+    return executeNoLock(newPreparedStatement.get(), cachedStatement, queryID);
 }
 
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     return queryNoLock(query, queryID, config);
 }
 
 std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
+    auto queryStr = std::string(query);
+    if (queryCache.getCapacity() == 0) {
+        queryCache.clear();
+    } else {
+        auto normalizedQuery = QueryCache::normalize(queryStr);
+        if (auto cachedResult = queryCachedNoLock(queryStr, normalizedQuery, queryID, config)) {
+            queryCache.recordHit();
+            return cachedResult;
+        }
+        queryCache.recordMiss();
+        if (auto normalizedResult = queryNormalizedNoLock(normalizedQuery, queryID, config)) {
+            return normalizedResult;
+        }
+    }
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -357,8 +408,14 @@ std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     for (const auto& statement : parsedStatements) {
         auto [preparedStatement, cachedStatement] =
             prepareNoLock(statement, false /*shouldCommitNewTransaction*/);
-        auto currentQueryResult =
-            executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config);
+        auto statementConfig = config;
+        if (config.resultType == QueryResultType::STREAMING &&
+            statement != parsedStatements.back()) {
+            // Only the last result can be streamed, because the next statement would close it.
+            statementConfig.resultType = QueryResultType::FTABLE;
+        }
+        auto currentQueryResult = executeNoLock(preparedStatement.get(), cachedStatement.get(),
+            queryID, statementConfig);
         if (!currentQueryResult->isSuccess()) {
             if (!lastResult) {
                 queryResult = std::move(currentQueryResult);
@@ -367,6 +424,12 @@ std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
             }
             break;
         }
+        if (parsedStatements.size() == 1 && !statement->isInternal() &&
+            cachedStatement->reusablePlan && queryCache.getCapacity() > 0) {
+            queryCache.insert(queryStr,
+                std::make_shared<QueryCache::Entry>(std::move(preparedStatement),
+                    std::move(cachedStatement)));
+        }
         auto currentQuerySummary = currentQueryResult->getQuerySummary();
         if (statement->isInternal()) {
             // The result of internal statements should be invisible to end users. Skip chaining the
@@ -391,6 +454,99 @@ std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> ClientContext::queryCachedNoLock(const std::string& query,
+    const NormalizedQuery& normalizedQuery, std::optional<uint64_t> queryID, QueryConfig config) {
+    if (auto result = executeCachedNoLock(query, {}, queryID, config)) {
+        return result;
+    }
+    if (normalizedQuery.parameters.empty()) {
+        return nullptr;
+    }
+    return executeCachedNoLock(normalizedQuery.query, normalizedQuery.parameters, queryID, config);
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeCachedNoLock(const std::string& key,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& parameters,
+    std::optional<uint64_t> queryID, QueryConfig config) {
+    auto lookupTimer = TimeMetric(true /* enable */);
+    lookupTimer.start();
+    auto entry = queryCache.lookup(key);
+    if (entry == nullptr || !entry->isCompiled()) {
+        return nullptr;
+    }
+    auto& preparedStatement = *entry->preparedStatement;
+    auto& cachedStatement = *entry->cachedStatement;
+    for (auto& [name, value] : parameters) {
+        preparedStatement.parameterMap[name] = value;
+    }
+    auto valid = canReusePlan(preparedStatement, cachedStatement);
+    if (valid) {
+        try {
+            validateTransaction(preparedStatement.isReadOnly(),
+                cachedStatement.parsedStatement->requireTransaction());
+        } catch (std::exception&) {
+            // Let the regular path report the error.
+            valid = false;
+        }
+    }
+    if (!valid) {
+        queryCache.erase(key);
+        return nullptr;
+    }
+    // Substitute the literals of this query into the cached plan.
+    for (auto& parameter : cachedStatement.parameters) {
+        parameter->setValue(*preparedStatement.parameterMap.at(parameter->getParameterName()));
+    }
+    lookupTimer.stop();
+    preparedStatement.preparedSummary.compilingTime = lookupTimer.getElapsedTimeMS();
+    // The entry is kept alive by the local reference even if the execution evicts it.
+    auto result = executeNoLock(&preparedStatement, &cachedStatement, queryID, config);
+    useInternalCatalogEntry_ = false;
+    return result;
+}
+
+std::unique_ptr<QueryResult> ClientContext::queryNormalizedNoLock(
+    const NormalizedQuery& normalizedQuery, std::optional<uint64_t> queryID, QueryConfig config) {
+    // Compiling the normalized query fails where a literal is required, e.g. a struct field name.
+    // Such a failure rolls back the active transaction, so literals are only replaced in queries
+    // that run in their own auto transaction.
+    if (normalizedQuery.parameters.empty() || !transactionContext->isAutoTransaction() ||
+        transactionContext->hasActiveTransaction()) {
+        return nullptr;
+    }
+    if (auto entry = queryCache.lookup(normalizedQuery.query); entry && !entry->isCompiled()) {
+        return nullptr;
+    }
+    auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
+    try {
+        parsedStatements = parseQuery(normalizedQuery.query);
+    } catch (std::exception&) {
+        parsedStatements.clear();
+    }
+    if (parsedStatements.size() != 1 || parsedStatements[0]->isInternal()) {
+        queryCache.insert(normalizedQuery.query, std::make_shared<QueryCache::Entry>());
+        return nullptr;
+    }
+    auto [preparedStatement, cachedStatement] = prepareNoLock(parsedStatements[0],
+        false /*shouldCommitNewTransaction*/, normalizedQuery.parameters);
+    useInternalCatalogEntry_ = false;
+    if (!preparedStatement->isSuccess()) {
+        queryCache.insert(normalizedQuery.query, std::make_shared<QueryCache::Entry>());
+        return nullptr;
+    }
+    auto result = executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config);
+    if (!cachedStatement->reusablePlan) {
+        // Later runs compile the literal form, whose plan may be cached under its own text.
+        queryCache.insert(normalizedQuery.query, std::make_shared<QueryCache::Entry>());
+    } else if (result->isSuccess()) {
+        queryCache.insert(normalizedQuery.query,
+            std::make_shared<QueryCache::Entry>(std::move(preparedStatement),
+                std::move(cachedStatement)));
+    }
+    useInternalCatalogEntry_ = false;
+    return result;
+}
+
 std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_view query) {
     if (query.empty()) {
         throw ConnectionException("Query is empty.");
@@ -472,6 +628,8 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
                 auto bestPlan = planner.planStatement(*boundStatement);
                 optimizer::Optimizer::optimize(&bestPlan, this, planner.getCardinalityEstimator());
                 cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(std::move(bestPlan));
+                cachedStatement->parameters = expressionBinder->getParameterExpressions();
+                setPlanReuseInfo(*preparedStatement, *cachedStatement);
             },
             preparedStatement->isReadOnly(),
             preparedStatement->getStatementType() == StatementType::TRANSACTION,
@@ -487,6 +645,84 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
     return {std::move(preparedStatement), std::move(cachedStatement)};
 }
 
+void ClientContext::setPlanReuseInfo(const PreparedStatement& preparedStatement,
+    CachedPreparedStatement& cachedStatement) const {
+    auto catalog = Catalog::Get(*this);
+    cachedStatement.catalog = catalog;
+    cachedStatement.catalogChangeCount = catalog->getChangeCount();
+    cachedStatement.graphEntrySetVersion = graph::GraphEntrySet::Get(*this)->getVersion();
+    cachedStatement.clientConfig = clientConfig;
+    // Only query plans are reused. Plans compiled with placeholders for unknown parameters, against
+    // uncommitted catalog changes, or with parameter types inferred during binding (e.g. the type
+    // of an empty list) are re-planned on each execution. So are plans with table function calls,
+    // whose bind data may snapshot state such as file schemas or database statistics.
+    auto tableFunctionCollector = optimizer::LogicalTableFunctionCallCollector();
+    if (!cachedStatement.logicalPlan->isEmpty()) {
+        tableFunctionCollector.collect(cachedStatement.logicalPlan->getLastOperator().get());
+    }
+    cachedStatement.reusablePlan = preparedStatement.getStatementType() == StatementType::QUERY &&
+                                   preparedStatement.getUnknownParameters().empty() &&
+                                   !Transaction::Get(*this)->hasUncommittedCatalogChanges() &&
+                                   !tableFunctionCollector.hasOperators();
+    for (auto& parameter : cachedStatement.parameters) {
+        auto& value = *preparedStatement.parameterMap.at(parameter->getParameterName());
+        if (value.getDataType().containsAny() || value.getDataType() != parameter->getDataType()) {
+            cachedStatement.reusablePlan = false;
+        }
+    }
+}
+
+bool ClientContext::canReusePlan(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement) const {
+    if (!cachedStatement.reusablePlan ||
+        cachedStatement.useInternalCatalogEntry != useInternalCatalogEntry_ ||
+        !(cachedStatement.clientConfig == clientConfig)) {
+        return false;
+    }
+    auto catalog = Catalog::Get(*this);
+    if (cachedStatement.catalog != catalog ||
+        cachedStatement.catalogChangeCount != catalog->getChangeCount() ||
+        cachedStatement.graphEntrySetVersion != graph::GraphEntrySet::Get(*this)->getVersion()) {
+        return false;
+    }
+    if (transactionContext->hasActiveTransaction() &&
+        transactionContext->getActiveTransaction()->hasUncommittedCatalogChanges()) {
+        return false;
+    }
+    for (auto& parameter : cachedStatement.parameters) {
+        auto& value = *preparedStatement.parameterMap.at(parameter->getParameterName());
+        if (value.getDataType() != parameter->getDataType()) {
+            return false;
+        }
+        // The plan was specialized for the value it was compiled with.
+        if (parameter->isValueUsedInCompilation() && !(value == parameter->getRuntimeValue())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ClientContext::canReoptimize(const PreparedStatement& preparedStatement) const {
+    // Queries are restarted from scratch, so they must not write anything.
+    return clientConfig.reoptimizationThreshold != 0 &&
+           preparedStatement.getStatementType() == StatementType::QUERY &&
+           preparedStatement.isReadOnly();
+}
+
+std::unique_ptr<LogicalPlan> ClientContext::replanNoLock(
+    const PreparedStatement& preparedStatement, const CachedPreparedStatement& cachedStatement) {
+    auto binder = Binder(this, localDatabase->getBinderExtensions());
+    auto expressionBinder = binder.getExpressionBinder();
+    for (auto& [name, value] : preparedStatement.parameterMap) {
+        expressionBinder->addParameter(name, value);
+    }
+    const auto boundStatement = binder.bind(*cachedStatement.parsedStatement);
+    auto planner = Planner(this);
+    auto bestPlan = planner.planStatement(*boundStatement);
+    optimizer::Optimizer::optimize(&bestPlan, this, planner.getCardinalityEstimator());
+    return std::make_unique<LogicalPlan>(std::move(bestPlan));
+}
+
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
     CachedPreparedStatement* cachedStatement, std::optional<uint64_t> queryID,
     QueryConfig queryConfig) {
@@ -494,6 +730,12 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
     }
     useInternalCatalogEntry_ = cachedStatement->useInternalCatalogEntry;
+    if (queryConfig.resultType == QueryResultType::STREAMING) {
+        if (canStreamResult(*preparedStatement, *cachedStatement)) {
+            return executeStreamingNoLock(preparedStatement, cachedStatement, queryID);
+        }
+        queryConfig.resultType = QueryResultType::FTABLE;
+    }
     this->resetActiveQuery();
     this->startTimer();
     auto executingTimer = TimeMetric(true /* enable */);
@@ -502,38 +744,73 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     try {
         bool isTransactionStatement =
             preparedStatement->getStatementType() == StatementType::TRANSACTION;
+        if (canReoptimize(*preparedStatement)) {
+            cardinalityFeedback->start(clientConfig.reoptimizationThreshold);
+        }
         TransactionHelper::runFuncInTransaction(
             *transactionContext,
             [&]() -> void {
-                const auto profiler = std::make_unique<Profiler>();
-                profiler->enabled = cachedStatement->logicalPlan->isProfile();
-                if (!queryID) {
-                    queryID = localDatabase->getNextQueryID();
-                }
-                const auto executionContext =
-                    std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
-                auto mapper = PlanMapper(executionContext.get());
-                const auto physicalPlan = mapper.getPhysicalPlan(cachedStatement->logicalPlan.get(),
-                    cachedStatement->columns, queryConfig.resultType, queryConfig.arrowConfig);
-                if (isTransactionStatement) {
-                    result = localDatabase->queryProcessor->execute(physicalPlan.get(),
-                        executionContext.get());
-                } else {
+                // A re-plan of a parameterized statement is only valid for the current parameter
+                // values, so later executions start from the prepared plan again.
+                std::unique_ptr<LogicalPlan> reoptimizedPlan;
+                auto logicalPlan = cachedStatement->logicalPlan.get();
+                for (auto numReoptimizations = 0u;; ++numReoptimizations) {
+                    if (numReoptimizations > 0) {
+                        reoptimizedPlan = replanNoLock(*preparedStatement, *cachedStatement);
+                        logicalPlan = reoptimizedPlan.get();
+                        if (preparedStatement->parameterMap.empty()) {
+                            cachedStatement->logicalPlan = std::move(reoptimizedPlan);
+                        }
+                    }
+                    const auto profiler = std::make_unique<Profiler>();
+                    profiler->enabled = logicalPlan->isProfile();
+                    if (!queryID) {
+                        queryID = localDatabase->getNextQueryID();
+                    }
+                    const auto executionContext =
+                        std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
+                    auto mapper = PlanMapper(executionContext.get());
+                    const auto physicalPlan =
+                        mapper.getPhysicalPlan(logicalPlan, cachedStatement->columns,
+                            queryConfig.resultType, queryConfig.arrowConfig);
+                    if (isTransactionStatement) {
+                        result = localDatabase->queryProcessor->execute(physicalPlan.get(),
+                            executionContext.get());
+                        break;
+                    }
                     if (preparedStatement->getStatementType() == StatementType::COPY_FROM) {
                         // Note: We always force checkpoint for COPY_FROM statement.
                         transaction::Transaction::Get(*this)->setForceCheckpoint();
                     }
-                    result = localDatabase->queryProcessor->execute(physicalPlan.get(),
-                        executionContext.get());
+                    try {
+                        result = localDatabase->queryProcessor->execute(physicalPlan.get(),
+                            executionContext.get());
+                    } catch (ReoptimizeException&) {
+                        // A hash join build side stopped the query because its cardinality was
+                        // far off from the estimate. Plan the query again and restart it, unless
+                        // the client interrupted it in the meantime.
+                        progressBar->endProgress(*queryID);
+                        activeQuery.interrupted = false;
+                        if (activeQuery.interruptRequested) {
+                            throw InterruptException();
+                        }
+                        if (numReoptimizations + 1 >= PlannerKnobs::MAX_NUM_REOPTIMIZATIONS) {
+                            cardinalityFeedback->stop();
+                        }
+                        continue;
+                    }
+                    break;
                 }
             },
             preparedStatement->isReadOnly(), isTransactionStatement,
             TransactionHelper::getAction(true /*shouldCommitNewTransaction*/,
                 !isTransactionStatement /*shouldCommitAutoTransaction*/));
     } catch (std::exception& e) {
+        cardinalityFeedback->finish();
         useInternalCatalogEntry_ = false;
         return handleFailedExecution(queryID, e);
     }
+    cardinalityFeedback->finish();
     const auto memoryManager = storage::MemoryManager::Get(*this);
     memoryManager->getBufferManager()->getSpillerOrSkip([](auto& spiller) { spiller.clearFile(); });
     executingTimer.stop();
@@ -545,6 +822,122 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     return result;
 }
 
+bool ClientContext::canStreamResult(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement) const {
+#ifdef __SINGLE_THREADED__
+    // Streaming needs a thread to run the query while the client reads the result.
+    return false;
+#else
+    // Write queries are materialized, so that they are committed before their result is returned.
+    return preparedStatement.getStatementType() == StatementType::QUERY &&
+           preparedStatement.isReadOnly() && !cachedStatement.logicalPlan->isProfile();
+#endif
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeStreamingNoLock(
+    PreparedStatement* preparedStatement, CachedPreparedStatement* cachedStatement,
+    std::optional<uint64_t> queryID) {
+    this->resetActiveQuery();
+    this->startTimer();
+    auto executingTimer = TimeMetric(true /* enable */);
+    executingTimer.start();
+    auto query = std::make_unique<StreamingQuery>();
+    const bool requireNewTransaction =
+        transactionContext->isAutoTransaction() && !transactionContext->hasActiveTransaction();
+    try {
+        if (requireNewTransaction) {
+            transactionContext->beginAutoTransaction(true /* readOnlyStatement */);
+        }
+        query->profiler = std::make_unique<Profiler>();
+        if (!queryID) {
+            queryID = localDatabase->getNextQueryID();
+        }
+        query->executionContext =
+            std::make_unique<ExecutionContext>(query->profiler.get(), this, *queryID);
+        auto mapper = PlanMapper(query->executionContext.get());
+        query->physicalPlan = mapper.getPhysicalPlan(cachedStatement->logicalPlan.get(),
+            cachedStatement->columns, QueryResultType::STREAMING, ArrowResultConfig{});
+        auto root = query->physicalPlan->lastOperator.get();
+        if (root->getOperatorType() == PhysicalOperatorType::RESULT_COLLECTOR) {
+            query->queue = root->ptrCast<ResultCollector>()->getStreamingQueue();
+        }
+    } catch (std::exception& e) {
+        transactionContext->rollback();
+        useInternalCatalogEntry_ = false;
+        return handleFailedExecution(queryID, e);
+    }
+    if (query->queue == nullptr) {
+        // The plan ends in its own sink, so there is nothing to stream.
+        if (requireNewTransaction) {
+            transactionContext->rollback();
+        }
+        return executeNoLock(preparedStatement, cachedStatement, queryID);
+    }
+    query->commitTransaction = transactionContext->isAutoTransaction();
+    auto result = std::make_unique<StreamingQueryResult>(this, query->queue);
+    query->result = result.get();
+    auto state = query.get();
+    query->producer = std::thread([this, state]() {
+        try {
+            localDatabase->queryProcessor->executeStreaming(state->physicalPlan.get(),
+                state->executionContext.get());
+        } catch (std::exception&) {
+            state->producerException = std::current_exception();
+        }
+        state->queue->finish(state->producerException);
+    });
+    streamingQuery = std::move(query);
+    executingTimer.stop();
+    result->setColumnNames(cachedStatement->getColumnNames());
+    result->setColumnTypes(cachedStatement->getColumnTypes());
+    auto summary = std::make_unique<QuerySummary>(preparedStatement->preparedSummary);
+    summary->setExecutionTime(executingTimer.getElapsedTimeMS());
+    result->setQuerySummary(std::move(summary));
+    return result;
+}
+
+void ClientContext::finishStreamingQuery(const StreamingQueryResult* result) {
+    lock_t lck{mtx};
+    if (streamingQuery == nullptr || streamingQuery->result != result) {
+        return;
+    }
+    finishStreamingQueryNoLock();
+}
+
+void ClientContext::finishStreamingQueryNoLock() {
+    if (streamingQuery == nullptr) {
+        return;
+    }
+    auto query = std::move(streamingQuery);
+    // If the producer is still running, the client stopped reading and the query is aborted.
+    const auto aborted = !query->queue->isFinished();
+    query->queue->close();
+    if (aborted) {
+        interrupt();
+    }
+    query->producer.join();
+    resetActiveQuery();
+    if (query->result != nullptr) {
+        query->result->detach();
+    }
+    try {
+        if (query->producerException && !aborted) {
+            transactionContext->rollback();
+        } else if (query->commitTransaction) {
+            transactionContext->commit();
+        }
+    } catch (CheckpointException&) {
+        transactionContext->clearTransaction();
+    } catch (std::exception&) {
+        transactionContext->rollback();
+    }
+    const auto memoryManager = storage::MemoryManager::Get(*this);
+    memoryManager->getBufferManager()->getSpillerOrSkip([](auto& spiller) { spiller.clearFile(); });
+    if (query->producerException && query->executionContext) {
+        progressBar->endProgress(query->executionContext->queryID);
+    }
+}
+
 std::unique_ptr<QueryResult> ClientContext::handleFailedExecution(std::optional<uint64_t> queryID,
     const std::exception& e) const {
     const auto memoryManager = storage::MemoryManager::Get(*this);
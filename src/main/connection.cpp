@@ -61,6 +61,14 @@ std::unique_ptr<QueryResult> Connection::queryAsArrow(std::string_view query, in
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> Connection::queryAsStream(std::string_view query) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    auto queryResult =
+        clientContext->query(query, std::nullopt, {QueryResultType::STREAMING, ArrowResultConfig{}});
+    queryResult->setDBLifeCycleManager(dbLifeCycleManager);
+    return queryResult;
+}
+
 std::unique_ptr<QueryResult> Connection::queryWithID(std::string_view queryStatement,
     uint64_t queryID) {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
@@ -71,7 +79,7 @@ std::unique_ptr<QueryResult> Connection::queryWithID(std::string_view queryState
 
 void Connection::interrupt() {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
-    clientContext->interrupt();
+    clientContext->requestInterrupt();
 }
 
 void Connection::setQueryTimeOut(uint64_t timeoutInMS) {
@@ -1,6 +1,7 @@
 #include "main/prepared_statement.h"
 
-#include "binder/expression/expression.h" // IWYU pragma: keep
+#include "binder/expression/expression.h"           // IWYU pragma: keep
+#include "binder/expression/parameter_expression.h" // IWYU pragma: keep
 #include "common/exception/binder.h"
 #include "common/types/value/value.h"
 #include "planner/operator/logical_plan.h" // IWYU pragma: keep
@@ -13,6 +14,8 @@ namespace main {
 
 CachedPreparedStatement::CachedPreparedStatement() = default;
 CachedPreparedStatement::~CachedPreparedStatement() = default;
+CachedPreparedStatement& CachedPreparedStatement::operator=(
+    CachedPreparedStatement&& other) noexcept = default;
 
 std::vector<std::string> CachedPreparedStatement::getColumnNames() const {
     std::vector<std::string> names;
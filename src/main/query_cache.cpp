@@ -0,0 +1,217 @@
+#include "main/query_cache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <format>
+#include <unordered_set>
+
+#include "common/types/value/value.h"
+#include "function/cast/functions/cast_from_string_functions.h"
+#include "main/prepared_statement.h"
+#include "planner/operator/logical_plan.h" // IWYU pragma: keep
+
+namespace lbug {
+namespace main {
+
+QueryCache::Entry::Entry() = default;
+
+QueryCache::Entry::Entry(std::unique_ptr<PreparedStatement> preparedStatement,
+    std::unique_ptr<CachedPreparedStatement> cachedStatement)
+    : preparedStatement{std::move(preparedStatement)},
+      cachedStatement{std::move(cachedStatement)} {}
+
+QueryCache::Entry::~Entry() = default;
+
+QueryCache::QueryCache(uint64_t capacity) : capacity{capacity} {}
+
+QueryCache::~QueryCache() = default;
+
+std::shared_ptr<QueryCache::Entry> QueryCache::lookup(const std::string& query) {
+    auto it = entries.find(query);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    queries.splice(queries.begin(), queries, it->second.first);
+    return it->second.second;
+}
+
+void QueryCache::insert(const std::string& query, std::shared_ptr<Entry> entry) {
+    erase(query);
+    if (capacity == 0) {
+        return;
+    }
+    while (entries.size() >= capacity) {
+        entries.erase(queries.back());
+        queries.pop_back();
+    }
+    queries.push_front(query);
+    entries.insert({query, {queries.begin(), std::move(entry)}});
+}
+
+void QueryCache::erase(const std::string& query) {
+    auto it = entries.find(query);
+    if (it == entries.end()) {
+        return;
+    }
+    queries.erase(it->second.first);
+    entries.erase(it);
+}
+
+void QueryCache::clear() {
+    queries.clear();
+    entries.clear();
+}
+
+void QueryCache::setCapacity(uint64_t newCapacity) {
+    capacity = newCapacity;
+    while (entries.size() > capacity) {
+        entries.erase(queries.back());
+        queries.pop_back();
+    }
+}
+
+static bool isIdentifierChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' ||
+           static_cast<unsigned char>(c) >= 0x80;
+}
+
+// Clause keywords that end the predicate of a WHERE.
+static bool isClauseKeyword(const std::string& word) {
+    static const std::unordered_set<std::string> keywords{"CALL", "COPY", "CREATE", "DELETE",
+        "DETACH", "LIMIT", "LOAD", "MATCH", "MERGE", "OPTIONAL", "ORDER", "REMOVE", "RETURN", "SET",
+        "SKIP", "UNION", "UNWIND", "WITH", "YIELD"};
+    return keywords.contains(word);
+}
+
+static size_t skipQuoted(std::string_view query, size_t pos, bool& hasEscape) {
+    auto quote = query[pos++];
+    while (pos < query.size() && query[pos] != quote) {
+        if (query[pos] == '\\') {
+            hasEscape = true;
+            pos++;
+        }
+        pos++;
+    }
+    return std::min(pos + 1, query.size() + 1);
+}
+
+NormalizedQuery QueryCache::normalize(std::string_view query) {
+    NormalizedQuery result;
+    result.query.reserve(query.size());
+    auto addParameter = [&](common::Value value) {
+        auto name = std::format("{}{}", LITERAL_PARAMETER_PREFIX, result.parameters.size());
+        result.query += "$" + name;
+        result.parameters.emplace(name, std::make_shared<common::Value>(std::move(value)));
+    };
+    // Only literals of a WHERE at the top level of the query are replaced. A WHERE nested in
+    // brackets may belong to a projected expression, e.g. a list comprehension in RETURN.
+    auto inPredicate = false;
+    auto depth = 0u;
+    // The previous token, ignoring whitespace and comments.
+    std::string_view prevToken;
+    size_t pos = 0;
+    while (pos < query.size()) {
+        auto start = pos;
+        auto c = query[pos];
+        auto replaced = false;
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            pos++;
+            result.query += c;
+            continue;
+        }
+        if (query.substr(pos, 2) == "//") {
+            pos = std::min(query.find('\n', pos), query.size());
+            result.query += query.substr(start, pos - start);
+            continue;
+        }
+        if (query.substr(pos, 2) == "/*") {
+            auto end = query.find("*/", pos + 2);
+            pos = end == std::string_view::npos ? query.size() : end + 2;
+            result.query += query.substr(start, pos - start);
+            continue;
+        }
+        if (c == '\'' || c == '"') {
+            auto hasEscape = false;
+            pos = skipQuoted(query, pos, hasEscape);
+            auto isClosed = pos <= query.size();
+            pos = std::min(pos, query.size());
+            // Regex patterns are compiled once when they are literals.
+            if (inPredicate && isClosed && !hasEscape && prevToken != "=~") {
+                addParameter(common::Value(common::LogicalType::STRING(),
+                    std::string(query.substr(start + 1, pos - start - 2))));
+                replaced = true;
+            }
+        } else if (c == '`') {
+            auto end = query.find('`', pos + 1);
+            pos = end == std::string_view::npos ? query.size() : end + 1;
+        } else if (c == '$') {
+            pos++;
+            while (pos < query.size() && isIdentifierChar(query[pos])) {
+                pos++;
+            }
+        } else if (isIdentifierChar(c) && !std::isdigit(static_cast<unsigned char>(c))) {
+            while (pos < query.size() && isIdentifierChar(query[pos])) {
+                pos++;
+            }
+            // Property names and labels can spell keywords.
+            if (depth == 0 && prevToken != "." && prevToken != ":") {
+                auto word = std::string(query.substr(start, pos - start));
+                std::transform(word.begin(), word.end(), word.begin(), ::toupper);
+                if (word == "WHERE") {
+                    inPredicate = true;
+                } else if (isClauseKeyword(word)) {
+                    inPredicate = false;
+                }
+            }
+        } else if (std::isdigit(static_cast<unsigned char>(c))) {
+            while (pos < query.size() && std::isdigit(static_cast<unsigned char>(query[pos]))) {
+                pos++;
+            }
+            auto isDouble = pos + 1 < query.size() && query[pos] == '.' &&
+                            std::isdigit(static_cast<unsigned char>(query[pos + 1]));
+            if (isDouble) {
+                pos++;
+                while (pos < query.size() && std::isdigit(static_cast<unsigned char>(query[pos]))) {
+                    pos++;
+                }
+            }
+            // Exponents, ranges such as 1..3 and numbers after a dot keep their literal form.
+            auto isPlain = (pos == query.size() || !isIdentifierChar(query[pos])) &&
+                           (start == 0 || query[start - 1] != '.') &&
+                           (pos == query.size() || query[pos] != '.');
+            while (pos < query.size() && isIdentifierChar(query[pos])) {
+                pos++;
+            }
+            if (inPredicate && isPlain) {
+                auto text = std::string(query.substr(start, pos - start));
+                common::ku_string_t literal{text.c_str(), text.length()};
+                if (isDouble) {
+                    double value = 0;
+                    function::CastString::operation(literal, value);
+                    addParameter(common::Value(value));
+                    replaced = true;
+                } else if (int64_t value = 0; function::CastString::tryCast(literal, value)) {
+                    addParameter(common::Value(value));
+                    replaced = true;
+                }
+            }
+        } else {
+            pos++;
+            if (c == '=' && pos < query.size() && query[pos] == '~') {
+                pos++;
+            } else if (c == '(' || c == '[' || c == '{') {
+                depth++;
+            } else if ((c == ')' || c == ']' || c == '}') && depth > 0) {
+                depth--;
+            }
+        }
+        if (!replaced) {
+            result.query += query.substr(start, pos - start);
+        }
+        prevToken = query.substr(start, pos - start);
+    }
+    return result;
+}
+
+} // namespace main
+} // namespace lbug
@@ -0,0 +1,146 @@
+#include "main/query_result/streaming_query_result.h"
+
+#include "common/arrow/arrow_row_batch.h"
+#include "common/exception/not_implemented.h"
+#include "common/exception/runtime.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "processor/physical_plan.h"
+#include "processor/result/factorized_table.h"
+#include "processor/result/flat_tuple.h"
+#include "processor/result/streaming_result_queue.h"
+
+using namespace lbug::common;
+using namespace lbug::processor;
+
+namespace lbug {
+namespace main {
+
+StreamingQuery::StreamingQuery() = default;
+
+StreamingQuery::~StreamingQuery() {
+    KU_ASSERT(!producer.joinable());
+}
+
+StreamingQueryResult::StreamingQueryResult(ClientContext* clientContext,
+    std::shared_ptr<StreamingResultQueue> queue)
+    : QueryResult{type_}, clientContext{clientContext}, queue{std::move(queue)} {}
+
+StreamingQueryResult::~StreamingQueryResult() {
+    if (dbLifeCycleManager && dbLifeCycleManager->isDatabaseClosed) {
+        if (chunk) {
+            chunk->setPreventDestruction(true);
+        }
+        return;
+    }
+    if (!detached) {
+        clientContext->finishStreamingQuery(this);
+    }
+}
+
+uint64_t StreamingQueryResult::getNumTuples() const {
+    throw NotImplementedException("StreamingQueryResult does not know its number of tuples before "
+                                  "all of them are read. Use MaterializedQueryResult instead.");
+}
+
+bool StreamingQueryResult::fetchNextChunk() const {
+    if (exhausted) {
+        return false;
+    }
+    iterator.reset();
+    chunk.reset();
+    try {
+        chunk = queue->pop();
+    } catch (std::exception& e) {
+        // Record the error on the result, so that clients that do not see the exception (e.g. the
+        // C API, whose has_next returns false) can tell a failed stream from an exhausted one.
+        auto& result = const_cast<StreamingQueryResult&>(*this);
+        result.success = false;
+        result.errMsg = e.what();
+        exhausted = true;
+        clientContext->finishStreamingQuery(this);
+        throw;
+    }
+    if (chunk == nullptr) {
+        exhausted = true;
+        clientContext->finishStreamingQuery(this);
+        return false;
+    }
+    iterator = std::make_unique<FactorizedTableIterator>(*chunk);
+    return true;
+}
+
+bool StreamingQueryResult::hasNext() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    if (detached && !exhausted) {
+        throw RuntimeException("The streaming query result is closed because another query was "
+                               "executed on the connection.");
+    }
+    while (iterator == nullptr || !iterator->hasNext()) {
+        if (!fetchNextChunk()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<FlatTuple> StreamingQueryResult::getNext() {
+    if (!hasNext()) {
+        throw RuntimeException(
+            "No more tuples in QueryResult, Please check hasNext() before calling getNext().");
+    }
+    iterator->getNext(*tuple);
+    return tuple;
+}
+
+void StreamingQueryResult::resetIterator() {
+    throw NotImplementedException("StreamingQueryResult can only be read once. Use "
+                                  "MaterializedQueryResult instead.");
+}
+
+std::string StreamingQueryResult::toString() const {
+    checkDatabaseClosedOrThrow();
+    if (!isSuccess()) {
+        return errMsg;
+    }
+    std::string result;
+    // print header
+    for (auto i = 0u; i < columnNames.size(); ++i) {
+        if (i != 0) {
+            result += "|";
+        }
+        result += columnNames[i];
+    }
+    result += "\n";
+    // Consumes the remaining tuples.
+    auto tuple_ = FlatTuple(this->columnTypes);
+    while (hasNext()) {
+        iterator->getNext(tuple_);
+        result += tuple_.toString();
+    }
+    return result;
+}
+
+bool StreamingQueryResult::hasNextArrowChunk() {
+    return hasNext();
+}
+
+std::unique_ptr<ArrowArray> StreamingQueryResult::getNextArrowChunk(int64_t chunkSize) {
+    checkDatabaseClosedOrThrow();
+    auto rowBatch =
+        std::make_unique<ArrowRowBatch>(columnTypes, chunkSize, false /* fallbackExtensionTypes */);
+    auto rowBatchSize = 0u;
+    while (rowBatchSize < chunkSize) {
+        if (!hasNext()) {
+            break;
+        }
+        iterator->getNext(*tuple);
+        rowBatch->append(*tuple);
+        rowBatchSize++;
+    }
+    return std::make_unique<ArrowArray>(rowBatch->toArray(columnTypes));
+}
+
+} // namespace main
+} // namespace lbug
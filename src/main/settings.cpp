@@ -20,6 +20,16 @@ common::Value ThreadsSetting::getSetting(const ClientContext* context) {
     return common::Value(context->getClientConfig()->numThreads);
 }
 
+void MaxThreadsPerQuerySetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->maxNumThreadsPerQuery = parameter.getValue<uint64_t>();
+}
+
+common::Value MaxThreadsPerQuerySetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->maxNumThreadsPerQuery);
+}
+
 void WarningLimitSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getClientConfigUnsafe()->warningLimit = parameter.getValue<uint64_t>();
@@ -178,6 +188,15 @@ common::Value ForceCheckpointClosingDBSetting::getSetting(const ClientContext* c
     return common::Value(context->getDBConfig()->forceCheckpointOnClose);
 }
 
+void WALCompressionSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getDBConfigUnsafe()->enableWALCompression = parameter.getValue<bool>();
+}
+
+common::Value WALCompressionSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getDBConfig()->enableWALCompression);
+}
+
 void EnableOptimizerSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getClientConfigUnsafe()->enablePlanOptimizer = parameter.getValue<bool>();
@@ -197,6 +216,37 @@ common::Value EnableInternalCatalogSetting::getSetting(const ClientContext* cont
     return common::Value::createValue(context->getClientConfig()->enableInternalCatalog);
 }
 
+void QueryCacheSizeSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getQueryCacheUnsafe().setCapacity(parameter.getValue<uint64_t>());
+}
+
+common::Value QueryCacheSizeSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getQueryCache().getCapacity());
+}
+
+void ReoptimizationThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->reoptimizationThreshold = parameter.getValue<uint64_t>();
+}
+
+common::Value ReoptimizationThresholdSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->reoptimizationThreshold);
+}
+
+void QueryPrioritySetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto input = parameter.getValue<std::string>();
+    context->getClientConfigUnsafe()->queryPriority = common::QueryPriorityUtils::fromString(input);
+}
+
+common::Value QueryPrioritySetting::getSetting(const ClientContext* context) {
+    const auto result =
+        common::QueryPriorityUtils::toString(context->getClientConfig()->queryPriority);
+    return common::Value::createValue(result);
+}
+
 void SpillToDiskSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getDBConfigUnsafe()->enableSpillingToDisk = parameter.getValue<bool>();
@@ -1,6 +1,7 @@
 #include "optimizer/acc_hash_join_optimizer.h"
 
 #include "catalog/catalog_entry/table_catalog_entry.h"
+#include "optimizer/dynamic_filter_util.h"
 #include "optimizer/logical_operator_collector.h"
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "planner/operator/logical_accumulate.h"
@@ -306,6 +307,28 @@ static bool tryBuildToProbeHJSIP(LogicalOperator* op) {
     return true;
 }
 
+// Pass filters built from the build keys, i.e. a Bloom filter and the key range, to the scan of the
+// probe key. Unlike semi masks, this works for keys of any type and for scans of rel tables. As the
+// Bloom filter is built from the hash of all keys, only single key joins are supported.
+static void tryDynamicFilterHJSIP(LogicalOperator* op) {
+    auto& hashJoin = op->cast<LogicalHashJoin>();
+    if (hashJoin.getJoinType() != JoinType::INNER || hashJoin.getJoinConditions().size() != 1) {
+        return;
+    }
+    if (hashJoin.getSIPInfo().dependency != SIPDependency::NONE) {
+        return;
+    }
+    // The filter pays off only if some probe keys have no match.
+    if (!subPlanContainsFilter(op->getChild(1).get())) {
+        return;
+    }
+    auto probeKey = hashJoin.getJoinConditions()[0].first;
+    auto target = DynamicFilterUtil::getScanTarget(*probeKey, op->getChild(0).get());
+    if (target != nullptr) {
+        hashJoin.setDynamicFilterTarget(target);
+    }
+}
+
 void HashJoinSIPOptimizer::visitHashJoin(LogicalOperator* op) {
     auto& hashJoin = op->cast<LogicalHashJoin>();
     if (LogicalOperatorUtils::isAccHashJoin(hashJoin)) {
@@ -317,10 +340,11 @@ void HashJoinSIPOptimizer::visitHashJoin(LogicalOperator* op) {
     if (tryBuildToProbeHJSIP(op)) { // Try build to probe SIP first.
         return;
     }
-    if (hashJoin.getSIPInfo().position == SemiMaskPosition::PROHIBIT_PROBE_TO_BUILD) {
+    if (hashJoin.getSIPInfo().position != SemiMaskPosition::PROHIBIT_PROBE_TO_BUILD &&
+        tryProbeToBuildHJSIP(op)) {
         return;
     }
-    tryProbeToBuildHJSIP(op);
+    tryDynamicFilterHJSIP(op);
 }
 
 // TODO(Xiyang): we don't apply SIP from build to probe.
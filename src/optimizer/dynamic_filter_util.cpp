@@ -0,0 +1,67 @@
+#include "optimizer/dynamic_filter_util.h"
+
+#include "binder/expression/node_expression.h"
+#include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+
+using namespace lbug::binder;
+using namespace lbug::planner;
+
+namespace lbug {
+namespace optimizer {
+
+static bool producesExpression(const LogicalOperator* op, const Expression& expression) {
+    expression_vector expressions;
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        auto& scan = op->constCast<LogicalScanNodeTable>();
+        if (scan.getScanType() != LogicalScanNodeTableType::SCAN) {
+            return false;
+        }
+        expressions = scan.getProperties();
+        expressions.push_back(scan.getNodeID());
+    } break;
+    case LogicalOperatorType::EXTEND: {
+        auto& extend = op->constCast<LogicalExtend>();
+        expressions = extend.getProperties();
+        expressions.push_back(extend.getNbrNode()->getInternalID());
+    } break;
+    default:
+        return false;
+    }
+    for (auto& expr : expressions) {
+        if (expr->getUniqueName() == expression.getUniqueName()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+LogicalOperator* DynamicFilterUtil::getScanTarget(const Expression& expression,
+    LogicalOperator* root) {
+    auto op = root;
+    while (true) {
+        if (producesExpression(op, expression)) {
+            return op;
+        }
+        switch (op->getOperatorType()) {
+        case LogicalOperatorType::FILTER:
+        case LogicalOperatorType::FLATTEN:
+        case LogicalOperatorType::PROJECTION:
+        case LogicalOperatorType::SEMI_MASKER:
+        case LogicalOperatorType::NODE_LABEL_FILTER:
+        case LogicalOperatorType::EXTEND:
+        case LogicalOperatorType::HASH_JOIN:
+        case LogicalOperatorType::INTERSECT:
+        case LogicalOperatorType::CROSS_PRODUCT: {
+            // The first child is the probe side, which is in the same pipeline.
+            op = op->getChild(0).get();
+        } break;
+        default:
+            return nullptr;
+        }
+    }
+}
+
+} // namespace optimizer
+} // namespace lbug
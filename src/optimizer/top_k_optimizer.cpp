@@ -1,5 +1,6 @@
 #include "optimizer/top_k_optimizer.h"
 
+#include "optimizer/dynamic_filter_util.h"
 #include "planner/operator/logical_limit.h"
 #include "planner/operator/logical_order_by.h"
 
@@ -56,6 +57,9 @@ std::shared_ptr<LogicalOperator> TopKOptimizer::visitLimitReplace(
     if (limit->hasSkipNum()) {
         orderBy->setSkipNum(limit->getSkipNum());
     }
+    auto firstKey = orderBy->getExpressionsToOrderBy()[0];
+    orderBy->setDynamicFilterTarget(
+        DynamicFilterUtil::getScanTarget(*firstKey, orderBy->getChild(0).get()));
     return projectionOrOrderBy;
 }
 
@@ -166,6 +166,12 @@ std::unique_ptr<Statement> Transformer::transformCreateSequence(
                 valOption = &createSequenceInfo.maxValue;
                 *valOption = seqOption->kU_MaxValue()->MINUS() ? "-" : "";
             }
+        } else if (seqOption->kU_Cache()) {
+            type = SequenceInfoType::CACHE;
+            typeString = "CACHE";
+            valCtx = seqOption->kU_Cache()->oC_IntegerLiteral();
+            valOption = &createSequenceInfo.cache;
+            *valOption = "";
         } else { // seqOption->kU_Cycle()
             type = SequenceInfoType::CYCLE;
             typeString = "CYCLE";
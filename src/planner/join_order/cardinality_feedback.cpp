@@ -0,0 +1,85 @@
+#include "planner/join_order/cardinality_feedback.h"
+
+#include <algorithm>
+
+#include "common/constants.h"
+
+using namespace lbug::binder;
+using namespace lbug::common;
+
+namespace lbug {
+namespace planner {
+
+static void appendNames(const QueryGraph& queryGraph, const SubqueryGraph& subgraph,
+    std::string& result) {
+    for (auto i = 0u; i < queryGraph.getNumQueryNodes(); ++i) {
+        if (subgraph.queryNodesSelector[i]) {
+            result += queryGraph.getQueryNode(i)->getUniqueName() + ",";
+        }
+    }
+    result += ";";
+    for (auto i = 0u; i < queryGraph.getNumQueryRels(); ++i) {
+        if (subgraph.queryRelsSelector[i]) {
+            result += queryGraph.getQueryRel(i)->getUniqueName() + ",";
+        }
+    }
+}
+
+std::string CardinalityFeedback::getKey(const QueryGraph& queryGraph,
+    const SubqueryGraph& subgraph) {
+    std::string result;
+    appendNames(queryGraph, subgraph, result);
+    // The same variables may be part of several query graphs of a statement, e.g. a correlated
+    // subquery, and are then planned with different predicates.
+    result += "/";
+    auto fullGraph = SubqueryGraph(queryGraph);
+    fullGraph.queryNodesSelector.set();
+    fullGraph.queryRelsSelector.set();
+    appendNames(queryGraph, fullGraph, result);
+    return result;
+}
+
+void CardinalityFeedback::start(uint64_t threshold_) {
+    std::unique_lock lck{mtx};
+    threshold = threshold_;
+}
+
+void CardinalityFeedback::stop() {
+    std::unique_lock lck{mtx};
+    threshold = 0;
+}
+
+void CardinalityFeedback::finish() {
+    std::unique_lock lck{mtx};
+    threshold = 0;
+    cardinalities.clear();
+}
+
+bool CardinalityFeedback::isEmpty() const {
+    std::unique_lock lck{mtx};
+    return cardinalities.empty();
+}
+
+std::optional<cardinality_t> CardinalityFeedback::getCardinality(const std::string& key) const {
+    std::unique_lock lck{mtx};
+    if (!cardinalities.contains(key)) {
+        return std::nullopt;
+    }
+    return cardinalities.at(key);
+}
+
+bool CardinalityFeedback::observe(const std::string& key, cardinality_t estimated,
+    cardinality_t actual) {
+    std::unique_lock lck{mtx};
+    if (threshold == 0) {
+        return false;
+    }
+    cardinalities[key] = actual;
+    // An overestimated build side is already done, and is only smaller than the planner expected.
+    // Restarting the query would throw that work away for little gain.
+    return actual >= PlannerKnobs::MIN_CARDINALITY_TO_REOPTIMIZE &&
+           actual / std::max<cardinality_t>(estimated, 1) >= threshold;
+}
+
+} // namespace planner
+} // namespace lbug
@@ -1,6 +1,10 @@
 #include "planner/join_order/join_plan_solver.h"
 
 #include "common/enums/extend_direction.h"
+#include "common/enums/extend_direction_util.h"
+#include "common/exception/binder.h"
+#include "common/utils.h"
+#include <format>
 
 using namespace lbug::binder;
 using namespace lbug::common;
@@ -44,6 +48,16 @@ static ExtendDirection getExtendDirection(const RelExpression& rel,
     }
 }
 
+// Rels of single-direction tables can only be extended in the direction they are stored in.
+static bool isStoredInDirection(const RelExpression& rel, ExtendDirection direction) {
+    return direction == ExtendDirection::BOTH || containsValue(rel.getExtendDirections(), direction);
+}
+
+static ExtendDirection getReverseDirection(ExtendDirection direction) {
+    KU_ASSERT(direction != ExtendDirection::BOTH);
+    return direction == ExtendDirection::FWD ? ExtendDirection::BWD : ExtendDirection::FWD;
+}
+
 static std::shared_ptr<binder::NodeExpression> getOtherNode(const RelExpression& rel,
     const NodeExpression& boundNode) {
     if (*rel.getSrcNode() == boundNode) {
@@ -65,7 +79,21 @@ LogicalPlan JoinPlanSolver::solveNodeScanTreeNode(const JoinTreeNode& treeNode)
         auto rel = std::static_pointer_cast<RelExpression>(relInfo.nodeOrRel);
         auto nbrNode = getOtherNode(*rel, *boundNode);
         auto direction = getExtendDirection(*rel, *boundNode);
-        planner->appendExtend(boundNode, nbrNode, rel, direction, relInfo.properties, plan);
+        if (isStoredInDirection(*rel, direction)) {
+            planner->appendExtend(boundNode, nbrNode, rel, direction, relInfo.properties, plan);
+        } else {
+            // Scan the rels from the neighbour side in their stored direction and join them back
+            // on the bound node. The hash table serves as a transient reverse index.
+            auto relPlan = LogicalPlan();
+            planner->appendScanNodeTable(nbrNode->getInternalID(), nbrNode->getTableIDs(),
+                expression_vector{}, relPlan);
+            planner->appendExtend(nbrNode, boundNode, rel, getReverseDirection(direction),
+                relInfo.properties, relPlan);
+            auto joinPlan = LogicalPlan();
+            planner->appendHashJoin(expression_vector{boundNode->getInternalID()},
+                JoinType::INNER, plan, relPlan, joinPlan);
+            plan = std::move(joinPlan);
+        }
         planner->appendFilters(relInfo.predicates, plan);
     }
     planner->appendFilters(extraInfo.predicates, plan);
@@ -99,6 +127,16 @@ LogicalPlan JoinPlanSolver::solveRelScanTreeNode(const JoinTreeNode& treeNode,
         KU_UNREACHABLE;
     }
     auto direction = getExtendDirection(*rel, *boundNode);
+    if (!isStoredInDirection(*rel, direction)) {
+        if (parent.type == TreeNodeType::MULTIWAY_JOIN) {
+            throw BinderException(std::format("Cannot intersect on rel pattern '{}' because its "
+                                              "rels are not stored in the {} direction.",
+                rel->toString(), ExtendDirectionUtil::toString(direction)));
+        }
+        // Both end nodes are joined by the parent, so the rels can be scanned from either side.
+        std::swap(boundNode, nbrNode);
+        direction = getReverseDirection(direction);
+    }
     auto plan = LogicalPlan();
     planner->appendScanNodeTable(boundNode->getInternalID(), boundNode->getTableIDs(),
         expression_vector{}, plan);
@@ -1,14 +1,17 @@
 #include "planner/join_order_enumerator_context.h"
 
+#include "planner/join_order/cardinality_feedback.h"
+
 using namespace lbug::binder;
 
 namespace lbug {
 namespace planner {
 
 void JoinOrderEnumeratorContext::init(const QueryGraph* queryGraph_,
-    const expression_vector& predicates) {
+    const expression_vector& predicates, const CardinalityFeedback* cardinalityFeedback_) {
     whereExpressionsSplitOnAND = predicates;
     this->queryGraph = queryGraph_;
+    this->cardinalityFeedback = cardinalityFeedback_;
     // clear and resize subPlansTable
     subPlansTable->clear();
     maxLevel = queryGraph_->getNumQueryNodes() + queryGraph_->getNumQueryRels() + 1;
@@ -18,6 +21,17 @@ void JoinOrderEnumeratorContext::init(const QueryGraph* queryGraph_,
     currentLevel = 1;
 }
 
+void JoinOrderEnumeratorContext::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan) {
+    if (cardinalityFeedback != nullptr && !cardinalityFeedback->isEmpty()) {
+        auto cardinality = cardinalityFeedback->getCardinality(
+            CardinalityFeedback::getKey(*queryGraph, subqueryGraph));
+        if (cardinality.has_value()) {
+            plan.getLastOperator()->setCardinality(*cardinality);
+        }
+    }
+    subPlansTable->addPlan(subqueryGraph, std::move(plan));
+}
+
 SubqueryGraph JoinOrderEnumeratorContext::getFullyMatchedSubqueryGraph() const {
     auto subqueryGraph = SubqueryGraph(*queryGraph);
     for (auto i = 0u; i < queryGraph->getNumQueryNodes(); ++i) {
@@ -22,8 +22,13 @@ static expression_vector removeInternalIDProperty(const expression_vector& expre
 void Planner::appendScanNodeTable(std::shared_ptr<Expression> nodeID,
     std::vector<table_id_t> tableIDs, const expression_vector& properties, LogicalPlan& plan) {
     auto propertiesToScan_ = removeInternalIDProperty(properties);
+    std::vector<std::vector<struct_field_path_t>> fieldPaths;
+    for (auto& property : propertiesToScan_) {
+        fieldPaths.push_back(getStructFieldPaths(*property));
+    }
     auto scan = make_shared<LogicalScanNodeTable>(std::move(nodeID), std::move(tableIDs),
         propertiesToScan_);
+    scan->setPropertyFieldPaths(std::move(fieldPaths));
     scan->computeFactorizedSchema();
     scan->setCardinality(cardinalityEstimator.estimateScanNode(*scan));
     plan.setLastOperator(std::move(scan));
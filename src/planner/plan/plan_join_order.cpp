@@ -7,9 +7,12 @@
 #include "common/enums/rel_direction.h"
 #include "common/enums/table_type.h"
 #include "common/utils.h"
+#include "main/client_context.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "planner/join_order/cost_model.h"
 #include "planner/join_order/join_plan_solver.h"
 #include "planner/join_order/join_tree_constructor.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/planner.h"
 
@@ -125,7 +128,7 @@ LogicalPlan Planner::planQueryGraphCollection(const QueryGraphCollection& queryG
 
 LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
     const QueryGraphPlanningInfo& info) {
-    context.init(&queryGraph, info.predicates);
+    context.init(&queryGraph, info.predicates, clientContext->getCardinalityFeedback());
     cardinalityEstimator.init(queryGraph);
     if (info.hint != nullptr) {
         auto constructor =
@@ -478,7 +481,7 @@ void Planner::planWCOJoin(const SubqueryGraph& subgraph,
         for (auto& predicate : predicates) {
             appendFilter(predicate, leftPlanCopy);
         }
-        context.subPlansTable->addPlan(newSubgraph, std::move(leftPlanCopy));
+        context.addPlan(newSubgraph, std::move(leftPlanCopy));
     }
 }
 
@@ -569,6 +572,14 @@ bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph&
     return hasAppliedINLJoin;
 }
 
+static void setBuildCardinalityKey(LogicalPlan& plan, const std::string& key) {
+    if (key.empty()) {
+        return;
+    }
+    auto& hashJoin = plan.getLastOperator()->cast<LogicalHashJoin>();
+    hashJoin.setBuildCardinalityKey(key, hashJoin.getChild(1)->getCardinality());
+}
+
 void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
     const std::vector<std::shared_ptr<NodeExpression>>& joinNodes, bool flipPlan) {
     auto newSubgraph = subgraph;
@@ -580,6 +591,13 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
     }
     auto predicates =
         getNewlyMatchedExprs(subgraph, otherSubgraph, newSubgraph, context.getWhereExpressions());
+    // Build sides report their cardinality under these keys, so that a query whose estimates are
+    // far too low can be re-planned.
+    std::string key, otherKey;
+    if (clientContext->getClientConfig()->reoptimizationThreshold != 0) {
+        key = CardinalityFeedback::getKey(*context.queryGraph, subgraph);
+        otherKey = CardinalityFeedback::getKey(*context.queryGraph, otherSubgraph);
+    }
     for (auto& leftPlan : context.getPlans(subgraph)) {
         for (auto& rightPlan : context.getPlans(otherSubgraph)) {
             if (CostModel::computeHashJoinCost(joinNodeIDs, leftPlan, rightPlan) < maxCost) {
@@ -587,6 +605,7 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanBuildCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, leftPlanProbeCopy, rightPlanBuildCopy,
                     leftPlanProbeCopy);
+                setBuildCardinalityKey(leftPlanProbeCopy, otherKey);
                 appendFilters(predicates, leftPlanProbeCopy);
                 context.addPlan(newSubgraph, std::move(leftPlanProbeCopy));
             }
@@ -597,6 +616,7 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanProbeCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, rightPlanProbeCopy, leftPlanBuildCopy,
                     rightPlanProbeCopy);
+                setBuildCardinalityKey(rightPlanProbeCopy, key);
                 appendFilters(predicates, rightPlanProbeCopy);
                 context.addPlan(newSubgraph, std::move(rightPlanProbeCopy));
             }
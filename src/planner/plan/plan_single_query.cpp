@@ -18,6 +18,7 @@ LogicalPlan Planner::planSingleQuery(const NormalizedSingleQuery& singleQuery) {
         auto& property = expr->constCast<PropertyExpression>();
         propertyExprCollection.addProperties(property.getVariableName(), expr);
     }
+    structFieldPaths = propertyCollector.getStructFieldPaths();
     context.resetState();
     auto plan = LogicalPlan();
     for (auto i = 0u; i < singleQuery.getNumQueryParts(); ++i) {
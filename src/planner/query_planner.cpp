@@ -49,6 +49,19 @@ expression_vector Planner::getProperties(const Expression& pattern) const {
     return propertyExprCollection.getProperties(pattern);
 }
 
+std::vector<struct_field_path_t> Planner::getStructFieldPaths(const Expression& property) const {
+    if (!structFieldPaths.contains(property.getUniqueName())) {
+        return {};
+    }
+    auto& paths = structFieldPaths.at(property.getUniqueName());
+    for (auto& path : paths) {
+        if (path.empty()) {
+            return {};
+        }
+    }
+    return paths;
+}
+
 JoinOrderEnumeratorContext Planner::enterNewContext() {
     auto prevContext = std::move(context);
     context = JoinOrderEnumeratorContext();
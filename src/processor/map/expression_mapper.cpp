@@ -109,7 +109,7 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getParameterEvaluator(
     std::shared_ptr<Expression> expression) {
     auto& parameterExpression = expression->constCast<ParameterExpression>();
     return std::make_unique<LiteralExpressionEvaluator>(std::move(expression),
-        parameterExpression.getValue());
+        parameterExpression.getRuntimeValue());
 }
 
 std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getReferenceEvaluator(
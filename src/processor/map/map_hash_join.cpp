@@ -2,8 +2,10 @@
 #include "planner/operator/logical_hash_join.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan/scan_table.h"
 #include "processor/plan_mapper.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/predicate/dynamic_predicate.h"
 
 using namespace lbug::binder;
 using namespace lbug::planner;
@@ -59,6 +61,36 @@ HashJoinBuildInfo PlanMapper::createHashBuildInfo(const Schema& buildSideSchema,
         std::move(tableSchema));
 }
 
+void PlanMapper::mapDynamicFilterSIP(const LogicalOperator& target, const Expression& probeKey,
+    HashJoinSharedState& sharedState) {
+    // The target is on the probe side, which has been mapped already.
+    KU_ASSERT(logicalOpToPhysicalOpMap.contains(&target));
+    auto physicalOp = logicalOpToPhysicalOpMap.at(&target);
+    switch (physicalOp->getOperatorType()) {
+    case PhysicalOperatorType::SCAN_NODE_TABLE:
+    case PhysicalOperatorType::SCAN_REL_TABLE: {
+        auto bloomFilter = std::make_shared<BloomFilter>();
+        auto keyPos = DataPos(target.getSchema()->getExpressionPos(probeKey));
+        physicalOp->ptrCast<ScanTable>()->addBloomFilter(bloomFilter, keyPos);
+        sharedState.setBloomFilter(std::move(bloomFilter));
+    } break;
+    default:
+        break;
+    }
+    // Probe keys outside the range of the build keys cannot match, so node groups whose zone map
+    // lies outside of it are skipped.
+    if (!storage::DynamicBound::isSupported(probeKey.getDataType())) {
+        return;
+    }
+    auto physicalType = probeKey.getDataType().getPhysicalType();
+    auto minBound = std::make_shared<storage::DynamicBound>(physicalType, true /* isLowerBound */);
+    auto maxBound = std::make_shared<storage::DynamicBound>(physicalType, false /* isLowerBound */);
+    if (mapDynamicPredicate(target, probeKey, minBound, true /* canSkipNulls */) &&
+        mapDynamicPredicate(target, probeKey, maxBound, true /* canSkipNulls */)) {
+        sharedState.setKeyBounds(std::move(minBound), std::move(maxBound));
+    }
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator* logicalOperator) {
     auto hashJoin = logicalOperator->constPtrCast<LogicalHashJoin>();
     auto outSchema = hashJoin->getSchema();
@@ -84,10 +116,23 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
         ExpressionUtil::excludeExpressions(hashJoin->getExpressionsToMaterialize(), probeKeys);
     // Create build
     auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads);
+    // Semi masks passed from the probe side shrink the build side below the cardinality of the
+    // part of the query graph it covers.
+    if (hashJoin->getSIPInfo().direction != SIPDirection::PROBE_TO_BUILD) {
+        buildInfo.cardinalityKey = hashJoin->getBuildCardinalityKey();
+        buildInfo.estimatedCardinality = hashJoin->getEstimatedBuildCardinality();
+    }
+    // Large build sides are radix partitioned, so that the directory is built in cache-sized
+    // regions.
+    auto numPartitionBits =
+        JoinHashTable::getNumPartitionBits(hashJoin->getChild(1)->getCardinality());
     auto globalHashTable =
         std::make_unique<JoinHashTable>(*storage::MemoryManager::Get(*clientContext),
-            LogicalType::copy(buildKeyTypes), buildInfo.tableSchema.copy());
+            LogicalType::copy(buildKeyTypes), buildInfo.tableSchema.copy(), numPartitionBits);
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    if (hashJoin->getDynamicFilterTarget() != nullptr) {
+        mapDynamicFilterSIP(*hashJoin->getDynamicFilterTarget(), *probeKeys[0], *sharedState);
+    }
     auto buildPrintInfo = std::make_unique<HashJoinBuildPrintInfo>(buildKeys, payloads);
     auto hashJoinBuild = std::make_unique<HashJoinBuild>(PhysicalOperatorType::HASH_JOIN_BUILD,
         sharedState, std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(),
@@ -1,3 +1,6 @@
+#include "binder/expression/scalar_function_expression.h"
+#include "binder/expression_visitor.h"
+#include "function/sequence/sequence_functions.h"
 #include "planner/operator/persistent/logical_merge.h"
 #include "processor/operator/persistent/merge.h"
 #include "processor/plan_mapper.h"
@@ -25,6 +28,54 @@ static FactorizedTableSchema getFactorizedTableSchema(const binder::expression_v
     return tableSchema;
 }
 
+static bool callsNextVal(const binder::Expression& expr) {
+    if (expr.expressionType == common::ExpressionType::FUNCTION &&
+        expr.constCast<binder::ScalarFunctionExpression>().getFunction().name ==
+            function::NextValFunction::name) {
+        return true;
+    }
+    for (auto& child : binder::ExpressionChildrenCollector::collectChildren(expr)) {
+        if (callsNextVal(*child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Rows with the same keys reach a parallel merge in no particular order, so the first of them
+// creates the pattern and the last of them writes the final ON MATCH values. This is only safe if
+// the SET values are the same whichever row of a key comes first, i.e. they read nothing but the
+// merged pattern and constants.
+static bool isSetOrderInsensitive(const LogicalMerge& merge) {
+    std::unordered_set<std::string> patternNames;
+    for (auto& info : merge.getInsertNodeInfos()) {
+        patternNames.insert(info.pattern->getUniqueName());
+    }
+    for (auto& info : merge.getInsertRelInfos()) {
+        patternNames.insert(info.pattern->getUniqueName());
+    }
+    auto isInsensitive = [&](const std::vector<binder::BoundSetPropertyInfo>& infos) {
+        for (auto& info : infos) {
+            if (binder::ExpressionVisitor::isRandom(*info.columnData) ||
+                callsNextVal(*info.columnData)) {
+                return false;
+            }
+            auto collector = binder::DependentVarNameCollector();
+            collector.visit(info.columnData);
+            for (auto& name : collector.getVarNames()) {
+                if (!patternNames.contains(name)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    return isInsensitive(merge.getOnCreateSetNodeInfos()) &&
+           isInsensitive(merge.getOnCreateSetRelInfos()) &&
+           isInsensitive(merge.getOnMatchSetNodeInfos()) &&
+           isInsensitive(merge.getOnMatchSetRelInfos());
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapMerge(const LogicalOperator* logicalOperator) {
     auto& logicalMerge = logicalOperator->constCast<LogicalMerge>();
     auto outSchema = logicalMerge.getSchema();
@@ -107,10 +158,15 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapMerge(const LogicalOperator* lo
             logicalMerge.getOnMatchSetNodeInfos().size(),
             logicalMerge.getOnMatchSetRelInfos().size()),
         std::move(executorInfo), existenceMarkPos};
+    // Operators above the merge are not mapped yet. They are checked by
+    // disableUnsafeParallelWrites once the whole plan is mapped.
+    mergeInfo.parallel =
+        canParallelizeWrite(prevOperator.get()) && isSetOrderInsensitive(logicalMerge);
     return std::make_unique<Merge>(std::move(nodeInsertExecutors), std::move(relInsertExecutors),
         std::move(onCreateNodeSetExecutors), std::move(onCreateRelSetExecutors),
         std::move(onMatchNodeSetExecutors), std::move(onMatchRelSetExecutors), std::move(mergeInfo),
-        std::move(prevOperator), getOperatorID(), std::move(printInfo));
+        std::make_shared<MergeSharedState>(), std::move(prevOperator), getOperatorID(),
+        std::move(printInfo));
 }
 
 } // namespace processor
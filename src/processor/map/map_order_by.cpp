@@ -8,6 +8,7 @@
 #include "processor/operator/order_by/top_k.h"
 #include "processor/operator/order_by/top_k_scanner.h"
 #include "processor/plan_mapper.h"
+#include "storage/predicate/dynamic_predicate.h"
 
 using namespace lbug::binder;
 using namespace lbug::common;
@@ -78,6 +79,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator*
             skipNum = ExpressionUtil::evaluateAsSkipLimit(*skipExpr);
         }
         auto topKSharedState = std::make_shared<TopKSharedState>();
+        auto target = logicalOrderBy.getDynamicFilterTarget();
+        auto& firstKey = *keyExpressions[0];
+        if (target != nullptr && storage::DynamicBound::isSupported(firstKey.getDataType())) {
+            auto isAsc = logicalOrderBy.getIsAscOrders()[0];
+            // Nulls are ordered last in ascending order, so they never enter a full top k.
+            auto bound = std::make_shared<storage::DynamicBound>(
+                firstKey.getDataType().getPhysicalType(), !isAsc /* isLowerBound */);
+            if (mapDynamicPredicate(*target, firstKey, bound, isAsc /* canSkipNulls */)) {
+                topKSharedState->setDynamicBound(std::move(bound));
+            }
+        }
         auto printInfo =
             std::make_unique<TopKPrintInfo>(keyExpressions, payloadExpressions, skipNum, limitNum);
         auto topK = make_unique<TopK>(std::move(orderByDataInfo), topKSharedState, skipNum,
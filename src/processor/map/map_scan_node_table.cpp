@@ -3,11 +3,13 @@
 #include "binder/expression_binder.h"
 #include "catalog/catalog.h"
 #include "common/mask.h"
+#include "main/client_context.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "processor/expression_mapper.h"
 #include "processor/operator/scan/primary_key_scan_node_table.h"
 #include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
+#include "storage/predicate/dynamic_predicate.h"
 #include "storage/storage_manager.h"
 
 using namespace lbug::binder;
@@ -17,6 +19,28 @@ using namespace lbug::planner;
 namespace lbug {
 namespace processor {
 
+bool PlanMapper::mapDynamicPredicate(const LogicalOperator& target, const Expression& expression,
+    std::shared_ptr<storage::DynamicBound> bound, bool canSkipNulls) {
+    if (!clientContext->getClientConfig()->enableZoneMap ||
+        target.getOperatorType() != LogicalOperatorType::SCAN_NODE_TABLE) {
+        return false;
+    }
+    KU_ASSERT(logicalOpToPhysicalOpMap.contains(&target));
+    auto physicalOp = logicalOpToPhysicalOpMap.at(&target);
+    if (physicalOp->getOperatorType() != PhysicalOperatorType::SCAN_NODE_TABLE) {
+        return false;
+    }
+    auto properties = target.constCast<LogicalScanNodeTable>().getProperties();
+    for (auto i = 0u; i < properties.size(); ++i) {
+        if (properties[i]->getUniqueName() == expression.getUniqueName()) {
+            auto predicate = storage::ColumnDynamicPredicate(expression.toString(),
+                std::move(bound), canSkipNulls);
+            return physicalOp->ptrCast<ScanNodeTable>()->addColumnPredicate(i, predicate);
+        }
+    }
+    return false;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
     const LogicalOperator* logicalOperator) {
     auto storageManager = storage::StorageManager::Get(*clientContext);
@@ -40,20 +64,24 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
         tableNames.push_back(tableEntry->getName());
         auto table = storageManager->getTable(tableID)->ptrCast<storage::NodeTable>();
         auto tableInfo = ScanNodeTableInfo(table, copyVector(scan.getPropertyPredicates()));
-        for (auto& expr : scan.getProperties()) {
-            auto& property = expr->constCast<PropertyExpression>();
+        auto properties = scan.getProperties();
+        for (auto i = 0u; i < properties.size(); ++i) {
+            auto& property = properties[i]->constCast<PropertyExpression>();
             if (property.hasProperty(tableEntry->getTableID())) {
                 auto propertyName = property.getPropertyName();
                 auto& columnType = tableEntry->getProperty(propertyName).getType();
                 auto columnCaster = ColumnCaster(columnType.copy());
+                // Field paths refer to the property type, so they only apply without a cast.
+                auto fieldPaths = scan.getPropertyFieldPaths(i);
                 if (property.getDataType() != columnType) {
                     auto columnExpr = std::make_shared<PropertyExpression>(property);
                     columnExpr->dataType = columnType.copy();
                     columnCaster.setCastExpr(
                         expressionBinder.forceCast(columnExpr, property.getDataType()));
+                    fieldPaths.clear();
                 }
                 tableInfo.addColumnInfo(tableEntry->getColumnID(propertyName),
-                    std::move(columnCaster));
+                    std::move(columnCaster), std::move(fieldPaths));
             } else {
                 tableInfo.addColumnInfo(INVALID_COLUMN_ID, ColumnCaster(LogicalType::ANY()));
             }
@@ -104,8 +104,10 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapSetNodeProperty(
         expressions.emplace_back(info.column, info.columnData);
     }
     auto printInfo = std::make_unique<SetPropertyPrintInfo>(expressions);
-    return std::make_unique<SetNodeProperty>(std::move(executors), std::move(prevOperator),
-        getOperatorID(), std::move(printInfo));
+    auto sharedState = std::make_shared<SetSharedState>();
+    auto parallel = canParallelizeWrite(prevOperator.get());
+    return std::make_unique<SetNodeProperty>(std::move(executors), std::move(sharedState), parallel,
+        std::move(prevOperator), getOperatorID(), std::move(printInfo));
 }
 
 std::unique_ptr<RelSetExecutor> PlanMapper::getRelSetExecutor(const BoundSetPropertyInfo& boundInfo,
@@ -162,8 +164,10 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapSetRelProperty(
         expressions.emplace_back(info.column, info.columnData);
     }
     auto printInfo = std::make_unique<SetPropertyPrintInfo>(expressions);
-    return std::make_unique<SetRelProperty>(std::move(executors), std::move(prevOperator),
-        getOperatorID(), std::move(printInfo));
+    auto sharedState = std::make_shared<SetSharedState>();
+    auto parallel = canParallelizeWrite(prevOperator.get());
+    return std::make_unique<SetRelProperty>(std::move(executors), std::move(sharedState), parallel,
+        std::move(prevOperator), getOperatorID(), std::move(printInfo));
 }
 
 } // namespace processor
@@ -1,9 +1,14 @@
 #include "processor/plan_mapper.h"
 
+#include "function/table/scan_file_function.h"
 #include "main/client_context.h"
 #include "main/database.h"
 #include "planner/operator/logical_plan.h"
+#include "processor/operator/persistent/merge.h"
+#include "processor/operator/persistent/set.h"
 #include "processor/operator/profile.h"
+#include "processor/operator/table_function_call.h"
+#include "processor/operator/table_scan/ftable_scan_function.h"
 #include "storage/storage_manager.h"
 #include "storage/table/node_table.h"
 
@@ -31,9 +36,11 @@ std::unique_ptr<PhysicalPlan> PlanMapper::getPhysicalPlan(const LogicalPlan* log
                 std::move(root));
         } else {
             root = createResultCollector(AccumulateType::REGULAR, expressions,
-                logicalPlan->getSchema(), std::move(root));
+                logicalPlan->getSchema(), std::move(root),
+                resultType == main::QueryResultType::STREAMING);
         }
     }
+    disableUnsafeParallelWrites(root.get(), true /* canFollowWrite */);
     auto physicalPlan = std::make_unique<PhysicalPlan>(std::move(root));
     if (logicalPlan->isProfile()) {
         physicalPlan->lastOperator->ptrCast<Profile>()->setPhysicalPlan(physicalPlan.get());
@@ -233,6 +240,83 @@ FactorizedTableSchema PlanMapper::createFlatFTableSchema(const expression_vector
     return tableSchema;
 }
 
+// Write operators serialize the writes that are not safe to run concurrently themselves, so they
+// may run on multiple threads as long as nothing else in their pipeline reads from storage (which
+// could observe partial writes) or writes to it. We only allow pipelines that read their input from
+// files or materialized intermediate results, e.g. LOAD FROM ... MERGE or the accumulated input of
+// SET, possibly probing hash tables that were built by earlier pipelines. Operators above the write
+// are checked by disableUnsafeParallelWrites.
+bool PlanMapper::canParallelizeWrite(PhysicalOperator* child) {
+    auto op = child;
+    while (true) {
+        switch (op->getOperatorType()) {
+        case PhysicalOperatorType::FILTER:
+        case PhysicalOperatorType::FLATTEN:
+        case PhysicalOperatorType::PROJECTION:
+        case PhysicalOperatorType::UNWIND:
+        case PhysicalOperatorType::HASH_JOIN_PROBE:
+        case PhysicalOperatorType::CROSS_PRODUCT: {
+            op = op->getChild(0);
+        } break;
+        case PhysicalOperatorType::TABLE_FUNCTION_CALL: {
+            auto bindData = op->constCast<TableFunctionCall>().getInfo().bindData.get();
+            return op->isParallel() && (dynamic_cast<function::ScanFileBindData*>(bindData) ||
+                                           dynamic_cast<FTableScanBindData*>(bindData));
+        }
+        default:
+            return false;
+        }
+    }
+}
+
+// Operators that may sit above a parallel write in the same pipeline. They only pass on or consume
+// the tuples produced by the write, without reading from or writing to storage.
+static bool canFollowParallelWrite(const PhysicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case PhysicalOperatorType::AGGREGATE:
+    case PhysicalOperatorType::CROSS_PRODUCT:
+    case PhysicalOperatorType::DUMMY_SINK:
+    case PhysicalOperatorType::DUMMY_SIMPLE_SINK:
+    case PhysicalOperatorType::FILTER:
+    case PhysicalOperatorType::FLATTEN:
+    case PhysicalOperatorType::HASH_JOIN_BUILD:
+    case PhysicalOperatorType::HASH_JOIN_PROBE:
+    case PhysicalOperatorType::ORDER_BY:
+    case PhysicalOperatorType::PROFILE:
+    case PhysicalOperatorType::PROJECTION:
+    case PhysicalOperatorType::RESULT_COLLECTOR:
+    case PhysicalOperatorType::TOP_K:
+    case PhysicalOperatorType::UNWIND:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// canParallelizeWrite only sees the operators below a write, since the ones above are mapped later.
+// Once the whole plan is mapped, fall back to a single thread for writes that share their pipeline
+// with an operator that could observe or interfere with their partial writes.
+void PlanMapper::disableUnsafeParallelWrites(PhysicalOperator* op, bool canFollowWrite) {
+    if (!canFollowWrite) {
+        if (op->getOperatorType() == PhysicalOperatorType::MERGE) {
+            op->ptrCast<Merge>()->setParallel(false);
+        } else if (auto setNode = dynamic_cast<SetNodeProperty*>(op)) {
+            setNode->setParallel(false);
+        } else if (auto setRel = dynamic_cast<SetRelProperty*>(op)) {
+            setRel->setParallel(false);
+        }
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        // A sink ends the pipelines of all its children. Other children of a non-sink operator
+        // (e.g. hash join builds) are sinks that end their own pipelines.
+        auto childCanFollowWrite = true;
+        if (op->isSink() || i == 0) {
+            childCanFollowWrite = canFollowParallelWrite(op) && (op->isSink() || canFollowWrite);
+        }
+        disableUnsafeParallelWrites(op->getChild(i), childCanFollowWrite);
+    }
+}
+
 std::unique_ptr<SemiMask> PlanMapper::createSemiMask(table_id_t tableID) const {
     auto table = StorageManager::Get(*clientContext)->getTable(tableID)->ptrCast<NodeTable>();
     return SemiMaskUtil::createMask(
@@ -1,6 +1,10 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
+#include <algorithm>
+
 #include "binder/expression/expression_util.h"
+#include "main/client_context.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 
@@ -20,9 +24,24 @@ std::string HashJoinBuildPrintInfo::toString() const {
     return result;
 }
 
-void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
+void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable,
+    uint64_t numLocalFlatTuples) {
     std::unique_lock lck(mtx);
     hashTable->merge(localHashTable);
+    numFlatTuples += numLocalFlatTuples;
+}
+
+void HashJoinSharedState::publishDynamicFilters() {
+    if (bloomFilter != nullptr) {
+        hashTable->buildBloomFilter(*bloomFilter);
+    }
+    if (minKeyBound != nullptr) {
+        auto [minKey, maxKey] = hashTable->getKeyRange();
+        if (minKey.has_value()) {
+            minKeyBound->tighten(*minKey);
+            maxKeyBound->tighten(*maxKey);
+        }
+    }
 }
 
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
@@ -38,11 +57,19 @@ void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     if (keyState == nullptr) {
         setKeyState(keyVectors[0]->state.get());
     }
-    for (auto& pos : info.payloadsPos) {
-        payloadVectors.push_back(resultSet->getValueVector(pos).get());
+    for (auto i = 0u; i < info.payloadsPos.size(); ++i) {
+        auto vector = resultSet->getValueVector(info.payloadsPos[i]).get();
+        auto state = vector->state.get();
+        if (!info.tableSchema.getColumn(info.getNumKeys() + i)->isFlat() &&
+            std::find(unflatPayloadStates.begin(), unflatPayloadStates.end(), state) ==
+                unflatPayloadStates.end()) {
+            unflatPayloadStates.push_back(state);
+        }
+        payloadVectors.push_back(vector);
     }
     hashTable = std::make_unique<JoinHashTable>(*MemoryManager::Get(*context->clientContext),
-        std::move(keyTypes), info.tableSchema.copy());
+        std::move(keyTypes), info.tableSchema.copy(),
+        sharedState->getHashTable()->getNumPartitionBits());
 }
 
 void HashJoinBuild::setKeyState(common::DataChunkState* state) {
@@ -53,10 +80,23 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
-void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
+void HashJoinBuild::finalizeInternal(ExecutionContext* context) {
+    sharedState->getHashTable()->mergePartitions();
     auto numTuples = sharedState->getHashTable()->getNumEntries();
+    if (!info.cardinalityKey.empty()) {
+        // Unflat payloads are stored as lists, so the number of entries may be far below the
+        // cardinality of the build side.
+        auto feedback = context->clientContext->getCardinalityFeedback();
+        if (feedback->observe(info.cardinalityKey, info.estimatedCardinality,
+                sharedState->getNumFlatTuples())) {
+            // The plan was chosen based on a wrong estimate. Stop the query, so that the client
+            // context re-plans it with the observed cardinality.
+            throw planner::ReoptimizeException();
+        }
+    }
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
+    sharedState->publishDynamicFilters();
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
@@ -67,9 +107,14 @@ void HashJoinBuild::executeInternal(ExecutionContext* context) {
             numAppended += appendVectors();
         }
         metrics->numOutputTuple.increase(numAppended);
+        auto numFlatTuples = numAppended;
+        for (auto state : unflatPayloadStates) {
+            numFlatTuples *= state->getSelVector().getSelSize();
+        }
+        numLocalFlatTuples += numFlatTuples;
     }
     // Merge with global hash table once local tuples are all appended.
-    sharedState->mergeLocalHashTable(*hashTable);
+    sharedState->mergeLocalHashTable(*hashTable, numLocalFlatTuples);
 }
 
 } // namespace processor
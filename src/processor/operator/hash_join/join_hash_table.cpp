@@ -1,5 +1,9 @@
 #include "processor/operator/hash_join/join_hash_table.h"
 
+#include <bit>
+
+#include "common/bloom_filter.h"
+#include "common/type_utils.h"
 #include "common/utils.h"
 #include "function/hash/vector_hash_functions.h"
 #include "processor/result/factorized_table.h"
@@ -12,15 +16,42 @@ namespace lbug {
 namespace processor {
 
 JoinHashTable::JoinHashTable(MemoryManager& memoryManager, logical_type_vec_t keyTypes,
-    FactorizedTableSchema tableSchema)
-    : BaseHashTable{memoryManager, std::move(keyTypes)} {
+    FactorizedTableSchema tableSchema, uint64_t numPartitionBits)
+    : BaseHashTable{memoryManager, std::move(keyTypes)}, numPartitionBits{numPartitionBits},
+      partitionShift{sizeof(hash_t) * 8 - numPartitionBits} {
+    KU_ASSERT(numPartitionBits <= MAX_NUM_PARTITION_BITS);
     auto numSlotsPerBlock = HASH_BLOCK_SIZE / sizeof(uint8_t*);
     initSlotConstant(numSlotsPerBlock);
     // Prev pointer is always the last column in the table.
     prevPtrColOffset = tableSchema.getColOffset(tableSchema.getNumColumns() - PREV_PTR_COL_IDX);
+    if (isPartitioned()) {
+        auto numPartitions = (uint64_t)1 << numPartitionBits;
+        for (auto i = 0u; i < numPartitions; ++i) {
+            partitions.push_back(
+                std::make_unique<FactorizedTable>(&memoryManager, tableSchema.copy()));
+        }
+        partitionStarts.resize(numPartitions + 1);
+    }
     factorizedTable = std::make_unique<FactorizedTable>(&memoryManager, std::move(tableSchema));
 }
 
+uint64_t JoinHashTable::getNumPartitionBits(cardinality_t buildCardinality) {
+    // The directory has two slots per tuple.
+    auto numPartitions = buildCardinality / (PARTITION_DIRECTORY_SIZE / (2 * sizeof(uint8_t*)));
+    if (numPartitions <= 1) {
+        return 0;
+    }
+    return std::min<uint64_t>(std::bit_width(numPartitions - 1), MAX_NUM_PARTITION_BITS);
+}
+
+static void prefetch(const void* ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr);
+#else
+    KU_UNUSED(ptr);
+#endif
+}
+
 static bool discardNullFromKeys(const std::vector<ValueVector*>& vectors) {
     bool hasNonNullKeys = true;
     for (auto& vector : vectors) {
@@ -36,27 +67,114 @@ uint64_t JoinHashTable::appendVectors(const std::vector<ValueVector*>& keyVector
     const std::vector<ValueVector*>& payloadVectors, DataChunkState* keyState) {
     discardNullFromKeys(keyVectors);
     auto numTuplesToAppend = keyState->getSelVector().getSelSize();
-    auto appendInfos = factorizedTable->allocateFlatTupleBlocks(numTuplesToAppend);
     computeVectorHashes(keyVectors);
+    if (isPartitioned()) {
+        appendVectorsToPartitions(keyVectors, payloadVectors, keyState);
+    } else {
+        appendVectorsToTable(*factorizedTable, keyVectors, payloadVectors, numTuplesToAppend);
+    }
+    return numTuplesToAppend;
+}
+
+void JoinHashTable::appendVectorToTable(FactorizedTable& table, ValueVector* vector,
+    const std::vector<BlockAppendingInfo>& appendInfos, ft_col_idx_t colIdx) {
+    auto numAppendedTuples = 0ul;
+    for (auto& blockAppendInfo : appendInfos) {
+        table.copyVectorToColumn(*vector, blockAppendInfo, numAppendedTuples, colIdx);
+        numAppendedTuples += blockAppendInfo.numTuplesToAppend;
+    }
+}
+
+void JoinHashTable::appendVectorsToTable(FactorizedTable& table,
+    const std::vector<ValueVector*>& keyVectors, const std::vector<ValueVector*>& payloadVectors,
+    uint64_t numTuplesToAppend) {
+    auto appendInfos = table.allocateFlatTupleBlocks(numTuplesToAppend);
     auto colIdx = 0u;
     for (auto& vector : keyVectors) {
-        appendVector(vector, appendInfos, colIdx++);
+        appendVectorToTable(table, vector, appendInfos, colIdx++);
     }
     for (auto& vector : payloadVectors) {
-        appendVector(vector, appendInfos, colIdx++);
+        appendVectorToTable(table, vector, appendInfos, colIdx++);
     }
-    appendVector(hashVector.get(), appendInfos, colIdx);
-    factorizedTable->numTuples += numTuplesToAppend;
-    return numTuplesToAppend;
+    appendVectorToTable(table, hashVector.get(), appendInfos, colIdx);
+    table.numTuples += numTuplesToAppend;
+}
+
+void JoinHashTable::appendVectorsToPartitions(const std::vector<ValueVector*>& keyVectors,
+    const std::vector<ValueVector*>& payloadVectors, DataChunkState* keyState) {
+    auto& selVector = keyState->getSelVectorUnsafe();
+    auto numTuples = selVector.getSelSize();
+    if (numTuples == 0) {
+        return;
+    }
+    if (keyState->isFlat()) {
+        auto hash = hashVector->getValue<hash_t>(hashVector->state->getSelVector()[0]);
+        appendVectorsToTable(*partitions[getPartitionIdx(hash)], keyVectors, payloadVectors,
+            numTuples);
+        return;
+    }
+    // Group the selected positions by partition (counting sort), then append each group with the
+    // selection vector of the key state restricted to the group. The unflat keys and the hashes
+    // share the key state.
+    KU_ASSERT(hashVector->state.get() == keyState);
+    selectedPositions.assign(selVector.getSelectedPositions().begin(),
+        selVector.getSelectedPositions().end());
+    partitionedPositions.resize(numTuples);
+    std::fill(partitionStarts.begin(), partitionStarts.end(), 0);
+    for (auto pos : selectedPositions) {
+        partitionStarts[getPartitionIdx(hashVector->getValue<hash_t>(pos)) + 1]++;
+    }
+    for (auto i = 1u; i < partitionStarts.size(); ++i) {
+        partitionStarts[i] += partitionStarts[i - 1];
+    }
+    for (auto pos : selectedPositions) {
+        auto partitionIdx = getPartitionIdx(hashVector->getValue<hash_t>(pos));
+        partitionedPositions[partitionStarts[partitionIdx]++] = pos;
+    }
+    // The starts have been shifted to the ends of the groups.
+    auto buffer = selVector.getMutableBuffer();
+    uint64_t groupStart = 0;
+    for (auto partitionIdx = 0u; partitionIdx < partitions.size(); ++partitionIdx) {
+        auto groupEnd = partitionStarts[partitionIdx];
+        auto groupSize = groupEnd - groupStart;
+        if (groupSize > 0) {
+            std::memcpy(buffer.data(), partitionedPositions.data() + groupStart,
+                groupSize * sizeof(sel_t));
+            selVector.setToFiltered(groupSize);
+            appendVectorsToTable(*partitions[partitionIdx], keyVectors, payloadVectors, groupSize);
+        }
+        groupStart = groupEnd;
+    }
+    // Restore the selection of the key state.
+    std::memcpy(buffer.data(), selectedPositions.data(), numTuples * sizeof(sel_t));
+    selVector.setToFiltered(numTuples);
 }
 
 void JoinHashTable::appendVector(ValueVector* vector,
     const std::vector<BlockAppendingInfo>& appendInfos, ft_col_idx_t colIdx) {
-    auto numAppendedTuples = 0ul;
-    for (auto& blockAppendInfo : appendInfos) {
-        factorizedTable->copyVectorToColumn(*vector, blockAppendInfo, numAppendedTuples, colIdx);
-        numAppendedTuples += blockAppendInfo.numTuplesToAppend;
+    appendVectorToTable(*factorizedTable, vector, appendInfos, colIdx);
+}
+
+void JoinHashTable::merge(JoinHashTable& other) {
+    KU_ASSERT(numPartitionBits == other.numPartitionBits);
+    if (!isPartitioned()) {
+        factorizedTable->merge(*other.factorizedTable);
+        return;
+    }
+    for (auto i = 0u; i < partitions.size(); ++i) {
+        partitions[i]->merge(*other.partitions[i]);
+    }
+}
+
+void JoinHashTable::mergePartitions() {
+    if (!isPartitioned()) {
+        return;
+    }
+    for (auto& partition : partitions) {
+        partitionNumTuples.push_back(partition->getNumTuples());
+        factorizedTable->merge(*partition);
     }
+    partitions.clear();
 }
 
 static void sortSelectedPos(ValueVector* nodeIDVector) {
@@ -105,7 +223,19 @@ uint64_t JoinHashTable::appendVectorWithSorting(ValueVector* keyVector,
 }
 
 void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
-    setMaxNumHashSlots(nextPowerOfTwo(numTuples * 2));
+    if (isPartitioned()) {
+        KU_ASSERT(partitions.empty() && partitionNumTuples.size() == (1ull << numPartitionBits));
+        auto numSlots = 0ul;
+        for (auto partitionNumTuple : partitionNumTuples) {
+            auto numPartitionSlots = nextPowerOfTwo(std::max<uint64_t>(partitionNumTuple * 2, 1));
+            partitionSlotOffsets.push_back(numSlots);
+            partitionSlotMasks.push_back(numPartitionSlots - 1);
+            numSlots += numPartitionSlots;
+        }
+        setMaxNumHashSlots(numSlots);
+    } else {
+        setMaxNumHashSlots(nextPowerOfTwo(numTuples * 2));
+    }
     auto numSlotsPerBlock = (uint64_t)1 << numSlotsPerBlockLog2;
     auto numBlocksNeeded = (maxNumHashSlots + numSlotsPerBlock - 1) / numSlotsPerBlock;
     while (hashSlotsBlocks.size() < numBlocksNeeded) {
@@ -126,6 +256,49 @@ void JoinHashTable::buildHashSlots() {
     }
 }
 
+void JoinHashTable::buildBloomFilter(BloomFilter& bloomFilter) const {
+    bloomFilter.init(getNumEntries());
+    auto hashColOffset = getHashValueColOffset();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        const uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            bloomFilter.insert(*(hash_t*)(tuple + hashColOffset));
+            tuple += getTableSchema()->getNumBytesPerTuple();
+        }
+    }
+}
+
+std::pair<std::optional<StorageValue>, std::optional<StorageValue>>
+JoinHashTable::getKeyRange() const {
+    KU_ASSERT(keyTypes.size() == 1);
+    std::optional<StorageValue> minKey, maxKey;
+    auto keyColOffset = getTableSchema()->getColOffset(0);
+    TypeUtils::visit(
+        keyTypes[0].getPhysicalType(),
+        [&]<StorageValueType T>(T) {
+            std::optional<T> min, max;
+            for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+                const uint8_t* tuple = tupleBlock->getData();
+                for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+                    auto key = *(T*)(tuple + keyColOffset);
+                    if (!min.has_value() || key < *min) {
+                        min = key;
+                    }
+                    if (!max.has_value() || *max < key) {
+                        max = key;
+                    }
+                    tuple += getTableSchema()->getNumBytesPerTuple();
+                }
+            }
+            if (min.has_value()) {
+                minKey = StorageValue(*min);
+                maxKey = StorageValue(*max);
+            }
+        },
+        [](auto) {});
+    return {minKey, maxKey};
+}
+
 void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
     SelectionVector& hashSelVec, ValueVector* tmpHashResultVector, uint8_t** probedTuples) {
     KU_ASSERT(keyVectors.size() == keyTypes.size());
@@ -145,6 +318,13 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
         VectorHashFunction::combineHash(hashVector, hashSelVec, *tmpHashResultVector, hashSelVec,
             hashVector, hashSelVec);
     }
+    if (isPartitioned()) {
+        // The directory of a partitioned table does not fit into the caches. Prefetch the slots of
+        // all keys first, so that the cache misses of the batch overlap.
+        for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
+            prefetch(getHashSlot(hashVector.getValue<hash_t>(hashSelVec[i])));
+        }
+    }
     for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
         KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
         probedTuples[i] = getTupleForHash(hashVector.getValue<hash_t>(hashSelVec[i]));
@@ -188,9 +368,7 @@ sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTupl
 
 uint8_t** JoinHashTable::findHashSlot(const uint8_t* tuple) const {
     auto hash = *(hash_t*)(tuple + getHashValueColOffset());
-    auto slotIdx = getSlotIdxForHash(hash);
-    return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
-                       (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
+    return getHashSlot(hash);
 }
 
 uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
@@ -8,6 +8,7 @@
 #include "function/comparison/comparison_functions.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/predicate/dynamic_predicate.h"
 
 using namespace lbug::common;
 
@@ -183,12 +184,17 @@ void TopKBuffer::setBoundaryValue() {
         auto dstData = boundaryVec->getData() +
                        boundaryVec->getNumBytesPerValue() * boundaryVec->state->getSelVector()[0];
         auto srcVector = lastKeyVecsToScan[i];
-        auto srcData =
-            srcVector->getData() +
-            srcVector->getNumBytesPerValue() *
-                srcVector->state->getSelVector()[srcVector->state->getSelVector().getSelSize() - 1];
+        auto srcPos =
+            srcVector->state->getSelVector()[srcVector->state->getSelVector().getSelSize() - 1];
+        auto srcData = srcVector->getData() + srcVector->getNumBytesPerValue() * srcPos;
         boundaryVec->copyFromVectorData(dstData, srcVector, srcData);
         hasBoundaryValue = true;
+        if (i == 0 && dynamicBound != nullptr && !srcVector->isNull(srcPos)) {
+            auto value = storage::StorageValue::readFromVector(*srcVector, srcPos);
+            if (value.has_value()) {
+                dynamicBound->tighten(*value);
+            }
+        }
     }
 }
 
@@ -262,6 +268,7 @@ void TopK::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* contex
     localState = TopKLocalState();
     localState.init(info, storage::MemoryManager::Get(*context->clientContext), *resultSet,
         skipNumber, limitNumber);
+    localState.buffer->dynamicBound = sharedState->getDynamicBound();
     for (auto& dataPos : info.payloadsPos) {
         payloadVectors.push_back(resultSet->getValueVector(dataPos).get());
     }
@@ -1,6 +1,8 @@
 #include "processor/operator/persistent/merge.h"
 
 #include "binder/expression/expression_util.h"
+#include "function/hash/hash_functions.h"
+#include "function/hash/vector_hash_functions.h"
 #include "main/client_context.h"
 
 namespace lbug {
@@ -40,19 +42,39 @@ void Merge::initLocalStateInternal(ResultSet* resultSet_, ExecutionContext* cont
     for (auto& evaluator : info.keyEvaluators) {
         evaluator->init(*resultSet_, context->clientContext);
     }
-    localState.init(*resultSet, context->clientContext, info);
+    localState.init(*resultSet, context->clientContext, info, *sharedState);
 }
 
-void MergeLocalState::init(ResultSet& resultSet, main::ClientContext* context, MergeInfo& info) {
+void MergeSharedState::init(main::ClientContext* context,
+    const std::vector<common::LogicalType>& keyTypes, const FactorizedTableSchema& tableSchema,
+    uint64_t numPartitions) {
+    std::unique_lock lck{mtx};
+    if (!partitions.empty()) {
+        return;
+    }
+    // TODO: remove types
+    for (auto i = 0u; i < numPartitions; i++) {
+        auto partition = std::make_unique<Partition>();
+        partition->hashTable = std::make_unique<PatternCreationInfoTable>(
+            *storage::MemoryManager::Get(*context), copyVector(keyTypes), tableSchema.copy());
+        partitions.push_back(std::move(partition));
+    }
+}
+
+void MergeLocalState::init(ResultSet& resultSet, main::ClientContext* context, MergeInfo& info,
+    MergeSharedState& sharedState) {
     std::vector<common::LogicalType> types;
     for (auto& evaluator : info.keyEvaluators) {
         auto keyVector = evaluator->resultVector.get();
         types.push_back(keyVector->dataType.copy());
         keyVectors.push_back(keyVector);
     }
-    // TODO: remove types
-    hashTable = std::make_unique<PatternCreationInfoTable>(*storage::MemoryManager::Get(*context),
-        std::move(types), std::move(info.tableSchema));
+    // A single partition keeps the serial merge at one hash table.
+    auto numPartitions =
+        info.parallel && !keyVectors.empty() ? MergeSharedState::NUM_PARALLEL_PARTITIONS : 1;
+    sharedState.init(context, types, info.tableSchema, numPartitions);
+    hashVector = std::make_unique<common::ValueVector>(common::LogicalType::HASH(),
+        storage::MemoryManager::Get(*context));
     existenceVector = resultSet.getValueVector(info.existenceMark).get();
 }
 
@@ -62,6 +84,20 @@ bool MergeLocalState::patternExists() const {
     return existenceVector->getValue<bool>(pos);
 }
 
+common::hash_t MergeLocalState::computeKeyHash() const {
+    common::hash_t result = 0;
+    for (auto i = 0u; i < keyVectors.size(); i++) {
+        auto keyVector = keyVectors[i];
+        KU_ASSERT(keyVector->state->getSelVector().getSelSize() == 1);
+        hashVector->state = keyVector->state;
+        function::VectorHashFunction::computeHash(*keyVector, keyVector->state->getSelVector(),
+            *hashVector, hashVector->state->getSelVector());
+        auto hash = hashVector->getValue<common::hash_t>(keyVector->state->getSelVector()[0]);
+        result = i == 0 ? hash : function::combineHashScalar(result, hash);
+    }
+    return result;
+}
+
 void Merge::executeOnMatch(ExecutionContext* context) {
     for (auto& executor : onMatchNodeSetExecutors) {
         executor->set(context);
@@ -115,11 +151,9 @@ void Merge::executeOnNewPattern(PatternCreationInfo& patternCreationInfo,
     }
 }
 
-void Merge::executeNoMatch(ExecutionContext* context) {
-    for (auto& evaluator : info.keyEvaluators) {
-        evaluator->evaluate();
-    }
-    auto patternCreationInfo = localState.getPatternCreationInfo();
+void Merge::executeNoMatch(PatternCreationInfoTable& hashTable, ExecutionContext* context) {
+    auto patternCreationInfo = localState.getPatternCreationInfo(hashTable);
+    std::unique_lock lck{sharedState->writeMtx};
     if (patternCreationInfo.hasCreated) {
         executeOnCreatedPattern(patternCreationInfo, context);
     } else {
@@ -131,10 +165,18 @@ bool Merge::getNextTuplesInternal(ExecutionContext* context) {
     if (!children[0]->getNextTuple(context)) {
         return false;
     }
+    for (auto& evaluator : info.keyEvaluators) {
+        evaluator->evaluate();
+    }
+    // All rows with the same keys go through the same partition, one at a time, so a pattern is
+    // created by the first of them and the rest see it as created.
+    auto& partition = sharedState->getPartition(localState.computeKeyHash());
+    std::unique_lock lck{partition.mtx};
     if (localState.patternExists()) {
+        std::unique_lock writeLck{sharedState->writeMtx};
         executeOnMatch(context);
     } else {
-        executeNoMatch(context);
+        executeNoMatch(*partition.hashTable, context);
     }
     return true;
 }
@@ -16,7 +16,14 @@ bool SetNodeProperty::getNextTuplesInternal(ExecutionContext* context) {
         return false;
     }
     for (auto& executor : executors) {
-        executor->set(context);
+        if (executor->canSetConcurrently(context)) {
+            std::shared_lock lck{sharedState->mtx};
+            std::lock_guard rowLck{sharedState->getRowMutex(executor->getNodeID())};
+            executor->set(context);
+        } else {
+            std::unique_lock lck{sharedState->mtx};
+            executor->set(context);
+        }
     }
     return true;
 }
@@ -32,7 +39,14 @@ bool SetRelProperty::getNextTuplesInternal(ExecutionContext* context) {
         return false;
     }
     for (auto& executor : executors) {
-        executor->set(context);
+        if (executor->canSetConcurrently()) {
+            std::shared_lock lck{sharedState->mtx};
+            std::lock_guard rowLck{sharedState->getRowMutex(executor->getRelID())};
+            executor->set(context);
+        } else {
+            std::unique_lock lck{sharedState->mtx};
+            executor->set(context);
+        }
     }
     return true;
 }
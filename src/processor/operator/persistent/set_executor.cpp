@@ -24,6 +24,20 @@ void NodeSetExecutor::setNodeID(nodeID_t nodeID) const {
     info.nodeIDVector->setValue(info.nodeIDVector->state->getSelVector()[0], nodeID);
 }
 
+nodeID_t NodeSetExecutor::getNodeID() const {
+    return info.nodeIDVector->getValue<nodeID_t>(info.nodeIDVector->state->getSelVector()[0]);
+}
+
+static bool canUpdateNodeConcurrently(ExecutionContext* context, storage::NodeTable& table,
+    offset_t nodeOffset) {
+    // Rows inserted by this transaction live in its local storage, and secondary indexes are
+    // maintained through shared structures. Neither is safe to update from multiple threads. The
+    // primary key index is never touched because the primary key cannot be updated.
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    return !transaction->isUnCommitted(table.getTableID(), nodeOffset) &&
+           table.getIndexes().size() <= 1;
+}
+
 static void writeColumnUpdateResult(ValueVector* idVector, ValueVector* columnVector,
     ValueVector* dataVector) {
     auto& idSelVector = idVector->state->getSelVector();
@@ -42,6 +56,15 @@ static void writeColumnUpdateResult(ValueVector* idVector, ValueVector* columnVe
     columnVector->copyFromVectorData(columnSelVector[0], dataVector, dataSelVector[0]);
 }
 
+bool SingleLabelNodeSetExecutor::canSetConcurrently(ExecutionContext* context) const {
+    auto pos = info.nodeIDVector->state->getSelVector()[0];
+    if (tableInfo.columnID == INVALID_COLUMN_ID || info.nodeIDVector->isNull(pos)) {
+        return true;
+    }
+    return canUpdateNodeConcurrently(context, *tableInfo.table,
+        info.nodeIDVector->readNodeOffset(pos));
+}
+
 void SingleLabelNodeSetExecutor::set(ExecutionContext* context) {
     if (tableInfo.columnID == INVALID_COLUMN_ID) {
         // Not a valid column. Set projected column to null.
@@ -60,6 +83,19 @@ void SingleLabelNodeSetExecutor::set(ExecutionContext* context) {
     }
 }
 
+bool MultiLabelNodeSetExecutor::canSetConcurrently(ExecutionContext* context) const {
+    auto pos = info.nodeIDVector->state->getSelVector()[0];
+    if (info.nodeIDVector->isNull(pos)) {
+        return true;
+    }
+    auto& nodeID = info.nodeIDVector->getValue<internalID_t>(pos);
+    if (!tableInfos.contains(nodeID.tableID)) {
+        return true;
+    }
+    return canUpdateNodeConcurrently(context, *tableInfos.at(nodeID.tableID).table,
+        nodeID.offset);
+}
+
 void MultiLabelNodeSetExecutor::set(ExecutionContext* context) {
     info.evaluator->evaluate();
     auto& nodeIDSelVector = info.nodeIDVector->state->getSelVector();
@@ -101,6 +137,17 @@ void RelSetExecutor::setRelID(nodeID_t relID) const {
     info.relIDVector->setValue(info.relIDVector->state->getSelVector()[0], relID);
 }
 
+nodeID_t RelSetExecutor::getRelID() const {
+    return info.relIDVector->getValue<nodeID_t>(info.relIDVector->state->getSelVector()[0]);
+}
+
+bool RelSetExecutor::canSetConcurrently() const {
+    // Rels inserted by this transaction live in its local storage, which is not thread-safe.
+    auto pos = info.relIDVector->state->getSelVector()[0];
+    return info.relIDVector->isNull(pos) ||
+           info.relIDVector->readNodeOffset(pos) < StorageConstants::MAX_NUM_ROWS_IN_TABLE;
+}
+
 void SingleLabelRelSetExecutor::set(ExecutionContext* context) {
     if (tableInfo.columnID == INVALID_COLUMN_ID) {
         if (info.columnVectorPos.isValid()) {
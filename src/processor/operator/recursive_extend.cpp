@@ -72,14 +72,19 @@ static double getRJProgress(offset_t totalNumNodes, offset_t completedNumNodes)
     return (double)completedNumNodes / totalNumNodes;
 }
 
-static bool requireRelID(const RJAlgorithm& function) {
+static bool requireRelID(const RJAlgorithm& function, const RJBindData& bindData) {
     if (function.getFunctionName() == WeightedSPPathsFunction::name ||
         function.getFunctionName() == SingleSPPathsFunction::name ||
         function.getFunctionName() == AllSPPathsFunction::name ||
-        function.getFunctionName() == AllWeightedSPPathsFunction::name ||
-        function.getFunctionName() == VarLenJoinsFunction::name) {
+        function.getFunctionName() == AllWeightedSPPathsFunction::name) {
         return true;
     }
+    if (function.getFunctionName() == VarLenJoinsFunction::name) {
+        // Rel IDs are only needed to materialize paths or to check trail semantic. Otherwise the
+        // scan reads the neighbour column only, e.g. when counting reachable nodes over a rel
+        // table without properties.
+        return bindData.writePath || bindData.semantic == PathSemantic::TRAIL;
+    }
     return false;
 }
 
@@ -98,7 +103,7 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         }
     }
     std::vector<std::string> propertyNames;
-    if (requireRelID(*function)) {
+    if (requireRelID(*function, bindData)) {
         propertyNames.push_back(InternalKeyword::ID);
     }
     if (bindData.weightPropertyExpr != nullptr) {
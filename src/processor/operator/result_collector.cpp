@@ -1,6 +1,9 @@
 #include "processor/operator/result_collector.h"
 
+#include <algorithm>
+
 #include "binder/expression/expression_util.h"
+#include "common/exception/interrupt.h"
 #include "main/query_result/materialized_query_result.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -41,20 +44,58 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
     initNecessaryLocalState(resultSet, context);
     localTable = std::make_unique<FactorizedTable>(MemoryManager::Get(*context->clientContext),
         info.tableSchema.copy());
+    for (auto i = 0u; i < payloadVectors.size(); ++i) {
+        auto state = payloadVectors[i]->state.get();
+        if (!info.tableSchema.getColumn(i)->isFlat() &&
+            std::find(unFlatPayloadStates.begin(), unFlatPayloadStates.end(), state) ==
+                unFlatPayloadStates.end()) {
+            unFlatPayloadStates.push_back(state);
+        }
+    }
+}
+
+void ResultCollector::pushLocalTable(StreamingResultQueue& queue, ExecutionContext* context) {
+    metrics->numOutputTuple.increase(numFlatTuplesInLocalTable);
+    numFlatTuplesInLocalTable = 0;
+    auto chunk = std::move(localTable);
+    localTable = std::make_unique<FactorizedTable>(MemoryManager::Get(*context->clientContext),
+        info.tableSchema.copy());
+    if (!queue.push(std::move(chunk))) {
+        // The client stopped reading the result.
+        throw InterruptException{};
+    }
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    auto streamingQueue = sharedState->getStreamingQueue();
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
                 localTable->append(payloadAndMarkVectors);
             }
+            if (streamingQueue) {
+                auto numFlatTuples = resultSet->multiplicity;
+                for (auto state : unFlatPayloadStates) {
+                    numFlatTuples *= state->getSelVector().getSelSize();
+                }
+                numFlatTuplesInLocalTable += numFlatTuples;
+                if (numFlatTuplesInLocalTable >= STREAMING_CHUNK_NUM_TUPLES) {
+                    pushLocalTable(*streamingQueue, context);
+                }
+            }
         }
     }
-    if (!payloadVectors.empty()) {
-        metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
-        sharedState->mergeLocalTable(*localTable);
+    if (payloadVectors.empty()) {
+        return;
+    }
+    if (streamingQueue) {
+        if (!localTable->isEmpty()) {
+            pushLocalTable(*streamingQueue, context);
+        }
+        return;
     }
+    metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+    sharedState->mergeLocalTable(*localTable);
 }
 
 void ResultCollector::finalizeInternal(ExecutionContext* context) {
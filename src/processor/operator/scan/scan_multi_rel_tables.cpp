@@ -94,6 +94,9 @@ bool ScanMultiRelTable::getNextTuplesInternal(ExecutionContext* context) {
     while (true) {
         if (currentScanner != nullptr &&
             currentScanner->scan(context->clientContext, *scanState, outVectors)) {
+            if (!applyBloomFilters()) {
+                continue;
+            }
             metrics->numOutputTuple.increase(scanState->outState->getSelVector().getSelSize());
             return true;
         }
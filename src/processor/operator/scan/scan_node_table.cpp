@@ -1,6 +1,7 @@
 #include "processor/operator/scan/scan_node_table.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/task_system/task_scheduler.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/local_storage/local_node_table.h"
@@ -100,9 +101,18 @@ void ScanNodeTableInfo::initScanState(TableScanState& scanState,
     const std::vector<ValueVector*>& outVectors, main::ClientContext* context) {
     auto transaction = transaction::Transaction::Get(*context);
     scanState.setToTable(transaction, table, columnIDs, copyVector(columnPredicates));
+    scanState.columnFieldPaths = columnFieldPaths;
     initScanStateVectors(scanState, outVectors, MemoryManager::Get(*context));
 }
 
+bool ScanNodeTable::addColumnPredicate(idx_t idx, const ColumnPredicate& predicate) {
+    auto added = false;
+    for (auto& info : tableInfos) {
+        added |= info.addColumnPredicate(idx, predicate.copy());
+    }
+    return added;
+}
+
 void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     ScanTable::initLocalStateInternal(resultSet, context);
     auto nodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
@@ -156,11 +166,19 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
             const auto outputSize = scanState->outState->getSelVector().getSelSize();
             if (outputSize > 0) {
                 info.castColumns();
+                if (!applyBloomFilters()) {
+                    continue;
+                }
                 scanState->outState->setToUnflat();
-                metrics->numOutputTuple.increase(outputSize);
+                metrics->numOutputTuple.increase(scanState->outState->getSelVector().getSelSize());
                 return true;
             }
         }
+        // Morsel boundaries are the points where a thread can hand itself over to a starving task.
+        // The remaining morsels are scanned by the other threads of the task.
+        if (TaskScheduler::Get(*context->clientContext)->shouldYield()) {
+            return false;
+        }
         sharedStates[currentTableIdx]->nextMorsel(*scanState, *progressSharedState);
         if (scanState->source == TableScanSource::NONE) {
             currentTableIdx++;
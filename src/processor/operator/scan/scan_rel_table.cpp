@@ -1,6 +1,7 @@
 #include "processor/operator/scan/scan_rel_table.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/task_system/task_scheduler.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/local_storage/local_rel_table.h"
@@ -94,10 +95,16 @@ bool ScanRelTable::getNextTuplesInternal(ExecutionContext* context) {
             const auto outputSize = scanState->outState->getSelVector().getSelSize();
             if (outputSize > 0) {
                 // No need to perform column cast because this is single table scan.
-                metrics->numOutputTuple.increase(outputSize);
+                if (!applyBloomFilters()) {
+                    continue;
+                }
+                metrics->numOutputTuple.increase(scanState->outState->getSelVector().getSelSize());
                 return true;
             }
         }
+        // The rels of the bound nodes are scanned. The thread cannot hand its remaining input over
+        // to the other threads of its task, but it can work on a starving task before going on.
+        TaskScheduler::Get(*context->clientContext)->runStarvingTask();
         if (!children[0]->getNextTuple(context)) {
             return false;
         }
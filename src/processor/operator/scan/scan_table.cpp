@@ -1,9 +1,14 @@
 #include "processor/operator/scan/scan_table.h"
 
 #include "binder/expression/scalar_function_expression.h"
+#include "function/hash/vector_hash_functions.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace lbug::common;
 using namespace lbug::storage;
+using namespace lbug::function;
 
 namespace lbug {
 namespace processor {
@@ -30,14 +35,28 @@ void ScanTableInfo::castColumns() {
     }
 }
 
-void ScanTableInfo::addColumnInfo(column_id_t columnID, ColumnCaster caster) {
+void ScanTableInfo::addColumnInfo(column_id_t columnID, ColumnCaster caster,
+    std::vector<struct_field_path_t> fieldPaths) {
     if (caster.hasCast()) {
         hasColumnCaster = true;
     }
     columnIDs.push_back(columnID);
+    columnFieldPaths.push_back(std::move(fieldPaths));
     columnCasters.push_back(std::move(caster));
 }
 
+bool ScanTableInfo::addColumnPredicate(idx_t idx, std::unique_ptr<ColumnPredicate> predicate) {
+    KU_ASSERT(idx < columnIDs.size());
+    if (columnIDs[idx] == INVALID_COLUMN_ID || columnCasters[idx].hasCast()) {
+        return false;
+    }
+    if (columnPredicates.empty()) {
+        columnPredicates.resize(columnIDs.size());
+    }
+    columnPredicates[idx].addPredicate(std::move(predicate));
+    return true;
+}
+
 void ScanTableInfo::initScanStateVectors(TableScanState& scanState,
     const std::vector<ValueVector*>& outVectors, MemoryManager* memoryManager) {
     if (!hasColumnCaster) {
@@ -59,10 +78,52 @@ void ScanTableInfo::initScanStateVectors(TableScanState& scanState,
     }
 }
 
-void ScanTable::initLocalStateInternal(ResultSet*, ExecutionContext*) {
+void ScanTable::initLocalStateInternal(ResultSet*, ExecutionContext* context) {
     for (auto& pos : opInfo.outVectorsPos) {
         outVectors.push_back(resultSet->getValueVector(pos).get());
     }
+    if (opInfo.bloomFilterInfos.empty()) {
+        return;
+    }
+    for (auto& info : opInfo.bloomFilterInfos) {
+        bloomFilterStates.emplace_back(resultSet->getValueVector(info.keyPos).get());
+    }
+    hashVector = std::make_unique<ValueVector>(LogicalType::HASH(),
+        MemoryManager::Get(*context->clientContext));
+}
+
+bool ScanTable::applyBloomFilters() {
+    for (auto i = 0u; i < bloomFilterStates.size(); ++i) {
+        auto& filterState = bloomFilterStates[i];
+        auto& bloomFilter = *opInfo.bloomFilterInfos[i].bloomFilter;
+        if (!filterState.enabled || !bloomFilter.isInitialized()) {
+            continue;
+        }
+        auto& selVector = filterState.keyVector->state->getSelVectorUnsafe();
+        auto numTuples = selVector.getSelSize();
+        VectorHashFunction::computeHash(*filterState.keyVector, selVector, *hashVector,
+            selVector);
+        auto buffer = selVector.getMutableBuffer();
+        sel_t numSelected = 0;
+        for (auto j = 0u; j < numTuples; ++j) {
+            auto pos = selVector[j];
+            buffer[numSelected] = pos;
+            numSelected += bloomFilter.mayContain(hashVector->getValue<hash_t>(pos));
+        }
+        selVector.setToFiltered(numSelected);
+        filterState.numCheckedTuples += numTuples;
+        filterState.numPassedTuples += numSelected;
+        // Stop checking a filter that passes more than 90% of the tuples, as the probe would drop
+        // the few remaining ones at a similar cost.
+        if (filterState.numCheckedTuples >= NUM_TUPLES_TO_SAMPLE &&
+            filterState.numPassedTuples * 10 > filterState.numCheckedTuples * 9) {
+            filterState.enabled = false;
+        }
+        if (numSelected == 0) {
+            return false;
+        }
+    }
+    return true;
 }
 
 } // namespace processor
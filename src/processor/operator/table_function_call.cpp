@@ -1,6 +1,7 @@
 #include "processor/operator/table_function_call.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/task_system/task_scheduler.h"
 #include "processor/execution_context.h"
 
 using namespace lbug::common;
@@ -37,6 +38,11 @@ void TableFunctionCall::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
 }
 
 bool TableFunctionCall::getNextTuplesInternal(ExecutionContext* context) {
+    // The remaining morsels are scanned by the other threads of the task.
+    if (info.function.canYieldFunc() &&
+        TaskScheduler::Get(*context->clientContext)->shouldYield()) {
+        return false;
+    }
     funcOutput->resetState();
     funcInput->bindData->evaluateParams(context->clientContext);
     auto numTuplesScanned = info.function.tableFunc(*funcInput, *funcOutput);
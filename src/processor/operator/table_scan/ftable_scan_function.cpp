@@ -71,6 +71,7 @@ std::unique_ptr<TableFunction> FTableScan::getFunction() {
     function->initSharedStateFunc = initSharedState;
     function->initLocalStateFunc = TableFunction::initEmptyLocalState;
     function->initOutputFunc = initFTableScanOutput;
+    function->canYieldFunc = [] { return true; };
     return function;
 }
 
@@ -4,6 +4,8 @@
 #include <filesystem>
 #include <format>
 
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "common/exception/runtime.h"
 #include "common/exception/transaction_manager.h"
 #include "main/client_context.h"
@@ -11,6 +13,8 @@
 #include "main/query_result.h"
 #include "processor/execution_context.h"
 #include "processor/result/flat_tuple.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
 #include "transaction/transaction_context.h"
 #include "transaction/transaction_manager.h"
 
@@ -66,6 +70,22 @@ static std::string quoteIdentifier(const std::string& identifier) {
     return escaped;
 }
 
+// Deleted rows are the only thing a rebuild reclaims that checkpointing does not: fully deleted
+// node groups are already emptied at checkpoint and rel deletions are compacted with their CSR
+// regions. Node offsets, however, are only remapped by a rebuild.
+static bool hasNodeTableDeletions(main::ClientContext* clientContext) {
+    auto catalog = catalog::Catalog::Get(*clientContext);
+    auto storageManager = storage::StorageManager::Get(*clientContext);
+    for (const auto tableEntry : catalog->getNodeTableEntries(&DUMMY_CHECKPOINT_TRANSACTION)) {
+        const auto& nodeTable =
+            storageManager->getTable(tableEntry->getTableID())->cast<storage::NodeTable>();
+        if (nodeTable.hasDeletions(&DUMMY_CHECKPOINT_TRANSACTION)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::unique_ptr<main::QueryResult> Transaction::runQueryNoLock(main::ClientContext* clientContext,
     const std::string& query, const std::string& phase) const {
     auto res = VacuumDBHelper::queryNoLock(clientContext, query);
@@ -101,6 +121,10 @@ void Transaction::vacuumDatabase(main::ClientContext* clientContext) const {
 
     // Ensure this transaction statement starts from a checkpointed state.
     runQueryNoLock(clientContext, "CHECKPOINT;", "initial checkpoint");
+    if (!hasNodeTableDeletions(clientContext)) {
+        // Nothing to compact, so skip the export/import round trip.
+        return;
+    }
     runQueryNoLock(clientContext,
         std::format("EXPORT DATABASE '{}' (FORMAT='parquet');", escapedExportDir), "export");
 
@@ -1,8 +1,14 @@
 #include "processor/processor.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "common/task_system/progress_bar.h"
 #include "main/query_result.h"
+#include "processor/operator/result_collector.h"
 #include "processor/operator/sink.h"
+#include "processor/operator/table_function_call.h"
+#include "processor/operator/table_scan/ftable_scan_function.h"
 #include "processor/physical_plan.h"
 #include "processor/processor_task.h"
 
@@ -23,6 +29,25 @@ QueryProcessor::QueryProcessor(uint64_t numThreads) {
 #endif
 
 std::unique_ptr<main::QueryResult> QueryProcessor::execute(PhysicalPlan* physicalPlan,
+    ExecutionContext* context) {
+    auto task = createTask(physicalPlan, context);
+    auto progressBar = ProgressBar::Get(*context->clientContext);
+    progressBar->startProgress(context->queryID);
+    taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    progressBar->endProgress(context->queryID);
+    return task->sink->getQueryResult();
+}
+
+void QueryProcessor::executeStreaming(PhysicalPlan* physicalPlan, ExecutionContext* context) {
+    auto task = createTask(physicalPlan, context);
+    auto progressBar = ProgressBar::Get(*context->clientContext);
+    progressBar->startProgress(context->queryID);
+    // The root pipeline blocks whenever the client falls behind reading the result.
+    taskScheduler->scheduleTaskOnNewThreadsAndWaitOrError(task, context);
+    progressBar->endProgress(context->queryID);
+}
+
+std::shared_ptr<ProcessorTask> QueryProcessor::createTask(PhysicalPlan* physicalPlan,
     ExecutionContext* context) {
     auto lastOperator = physicalPlan->lastOperator.get();
     // The root pipeline(task) consists of operators and its prevOperator only, because we
@@ -35,11 +60,7 @@ std::unique_ptr<main::QueryResult> QueryProcessor::execute(PhysicalPlan* physica
         decomposePlanIntoTask(sink->getChild(i), task.get(), context);
     }
     initTask(task.get());
-    auto progressBar = ProgressBar::Get(*context->clientContext);
-    progressBar->startProgress(context->queryID);
-    taskScheduler->scheduleTaskAndWaitOrError(task, context);
-    progressBar->endProgress(context->queryID);
-    return sink->getQueryResult();
+    return task;
 }
 
 void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
@@ -61,6 +82,111 @@ void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     }
 }
 
+// Operators that do not write to the database. Apart from the tables of result collectors, which
+// are checked by readsTableOf(), they share no state with pipelines other than their own
+// dependencies. Child pipelines consisting of these operators only can run concurrently.
+static bool isIndependentOperator(PhysicalOperatorType type) {
+    switch (type) {
+    case PhysicalOperatorType::AGGREGATE:
+    case PhysicalOperatorType::AGGREGATE_FINALIZE:
+    case PhysicalOperatorType::AGGREGATE_SCAN:
+    case PhysicalOperatorType::COUNT_REL_TABLE:
+    case PhysicalOperatorType::CROSS_PRODUCT:
+    case PhysicalOperatorType::EMPTY_RESULT:
+    case PhysicalOperatorType::FILTER:
+    case PhysicalOperatorType::FLATTEN:
+    case PhysicalOperatorType::HASH_JOIN_BUILD:
+    case PhysicalOperatorType::HASH_JOIN_PROBE:
+    case PhysicalOperatorType::INTERSECT_BUILD:
+    case PhysicalOperatorType::INTERSECT:
+    case PhysicalOperatorType::LIMIT:
+    case PhysicalOperatorType::MULTIPLICITY_REDUCER:
+    case PhysicalOperatorType::PATH_PROPERTY_PROBE:
+    case PhysicalOperatorType::PRIMARY_KEY_SCAN_NODE_TABLE:
+    case PhysicalOperatorType::PROJECTION:
+    case PhysicalOperatorType::RECURSIVE_EXTEND:
+    case PhysicalOperatorType::RESULT_COLLECTOR:
+    case PhysicalOperatorType::SCAN_NODE_TABLE:
+    case PhysicalOperatorType::SCAN_REL_TABLE:
+    case PhysicalOperatorType::SKIP:
+    case PhysicalOperatorType::TABLE_FUNCTION_CALL:
+    case PhysicalOperatorType::TOP_K:
+    case PhysicalOperatorType::TOP_K_SCAN:
+    case PhysicalOperatorType::ORDER_BY:
+    case PhysicalOperatorType::ORDER_BY_MERGE:
+    case PhysicalOperatorType::ORDER_BY_SCAN:
+    case PhysicalOperatorType::UNION_ALL_SCAN:
+    case PhysicalOperatorType::UNWIND:
+        return true;
+    default:
+        // E.g. semi maskers fill masks that are read by scans in sibling pipelines, and updates
+        // must not run concurrently.
+        return false;
+    }
+}
+
+static bool isIndependentPlan(const PhysicalOperator* op) {
+    if (!isIndependentOperator(op->getOperatorType())) {
+        return false;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (!isIndependentPlan(op->getChild(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Tables written by the result collectors of a plan and tables read by its FTable scans.
+struct PlanTables {
+    std::unordered_set<const FactorizedTable*> written;
+    std::unordered_set<const FactorizedTable*> read;
+};
+
+static void collectTables(const PhysicalOperator* op, PlanTables& tables) {
+    if (op->getOperatorType() == PhysicalOperatorType::RESULT_COLLECTOR) {
+        tables.written.insert(
+            ku_dynamic_cast<const ResultCollector*>(op)->getResultFTable().get());
+    } else if (op->getOperatorType() == PhysicalOperatorType::TABLE_FUNCTION_CALL) {
+        auto& info = ku_dynamic_cast<const TableFunctionCall*>(op)->getInfo();
+        if (info.function.name == FTableScan::name) {
+            tables.read.insert(info.bindData->constPtrCast<FTableScanBindData>()->table.get());
+        }
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        collectTables(op->getChild(i), tables);
+    }
+}
+
+// A pipeline can read the table of a result collector that is not one of its dependencies. E.g. a
+// semi-join from the probe to the build side (see PlanMapper::mapSIPJoin()) accumulates the probe
+// side in one child pipeline of the probe and scans it in the build pipeline, its sibling.
+static bool readsTableOf(const PlanTables& reader, const PlanTables& writer) {
+    return std::any_of(reader.read.begin(), reader.read.end(),
+        [&](const auto* table) { return writer.written.contains(table); });
+}
+
+static bool areIndependentPlans(const std::vector<const PhysicalOperator*>& plans) {
+    if (plans.size() <= 1) {
+        return false;
+    }
+    std::vector<PlanTables> childTables(plans.size());
+    for (auto i = 0u; i < plans.size(); ++i) {
+        if (!isIndependentPlan(plans[i])) {
+            return false;
+        }
+        collectTables(plans[i], childTables[i]);
+    }
+    for (auto i = 0u; i < childTables.size(); ++i) {
+        for (auto j = 0u; j < childTables.size(); ++j) {
+            if (i != j && readsTableOf(childTables[i], childTables[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void QueryProcessor::initTask(Task* task) {
     auto processorTask = ku_dynamic_cast<ProcessorTask*>(task);
     PhysicalOperator* op = processorTask->sink;
@@ -73,6 +199,13 @@ void QueryProcessor::initTask(Task* task) {
     if (!op->isParallel()) {
         task->setSingleThreadedTask();
     }
+    std::vector<const PhysicalOperator*> childPlans;
+    for (auto& child : task->children) {
+        childPlans.push_back(ku_dynamic_cast<ProcessorTask*>(child.get())->sink);
+    }
+    if (areIndependentPlans(childPlans)) {
+        task->setIndependentChildren();
+    }
     for (auto& child : task->children) {
         initTask(child.get());
     }
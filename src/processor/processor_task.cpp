@@ -14,7 +14,18 @@ namespace processor {
 ProcessorTask::ProcessorTask(Sink* sink, ExecutionContext* executionContext)
     : Task{executionContext->clientContext->getCurrentSetting(main::ThreadsSetting::name)
                .getValue<uint64_t>()},
-      sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {}
+      sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {
+    setPriority(executionContext->clientContext->getClientConfig()->queryPriority);
+    auto maxNumThreadsPerQuery =
+        executionContext->clientContext->getCurrentSetting(main::MaxThreadsPerQuerySetting::name)
+            .getValue<uint64_t>();
+    if (maxNumThreadsPerQuery != 0) {
+        if (executionContext->threadLimit == nullptr) {
+            executionContext->threadLimit = std::make_unique<ThreadLimit>(maxNumThreadsPerQuery);
+        }
+        setThreadLimit(executionContext->threadLimit.get());
+    }
+}
 
 void ProcessorTask::run() {
     // We need the lock when cloning because multiple threads can be accessing to clone,
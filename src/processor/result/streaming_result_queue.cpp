@@ -0,0 +1,63 @@
+#include "processor/result/streaming_result_queue.h"
+
+#include "processor/result/factorized_table.h"
+
+namespace lbug {
+namespace processor {
+
+bool StreamingResultQueue::push(std::unique_ptr<FactorizedTable> chunk) {
+    std::unique_lock lck{mtx};
+    notFull.wait(lck, [&] { return chunks.size() < capacity || closed; });
+    if (closed) {
+        return false;
+    }
+    chunks.push_back(std::move(chunk));
+    lck.unlock();
+    notEmpty.notify_one();
+    return true;
+}
+
+std::unique_ptr<FactorizedTable> StreamingResultQueue::pop() {
+    std::unique_lock lck{mtx};
+    notEmpty.wait(lck, [&] { return !chunks.empty() || finished || closed; });
+    if (closed) {
+        return nullptr;
+    }
+    if (chunks.empty()) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        return nullptr;
+    }
+    auto chunk = std::move(chunks.front());
+    chunks.pop_front();
+    lck.unlock();
+    // Each popped chunk frees room for a single producer.
+    notFull.notify_one();
+    return chunk;
+}
+
+void StreamingResultQueue::finish(std::exception_ptr producerException) {
+    std::unique_lock lck{mtx};
+    finished = true;
+    exception = std::move(producerException);
+    lck.unlock();
+    notEmpty.notify_all();
+}
+
+void StreamingResultQueue::close() {
+    std::unique_lock lck{mtx};
+    closed = true;
+    chunks.clear();
+    lck.unlock();
+    notFull.notify_all();
+    notEmpty.notify_all();
+}
+
+bool StreamingResultQueue::isFinished() {
+    std::unique_lock lck{mtx};
+    return finished;
+}
+
+} // namespace processor
+} // namespace lbug
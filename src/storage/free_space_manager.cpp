@@ -1,5 +1,7 @@
 #include "storage/free_space_manager.h"
 
+#include <algorithm>
+
 #include "common/serializer/deserializer.h"
 #include "common/serializer/in_mem_file_writer.h"
 #include "common/serializer/serializer.h"
@@ -132,7 +134,14 @@ static common::row_idx_t serializeCheckpointedEntries(
 template<typename ValueProcessor>
 static common::row_idx_t serializeUncheckpointedEntries(
     const FreeSpaceManager::free_list_t& uncheckpointedEntries, ValueProcessor& ser) {
-    for (const auto& entry : uncheckpointedEntries) {
+    // Pages can be freed concurrently (e.g. by node groups checkpointed in parallel), so serialize
+    // them in page order to keep the serialized free list deterministic.
+    auto sortedEntries = uncheckpointedEntries;
+    std::sort(sortedEntries.begin(), sortedEntries.end(),
+        [](const auto& entryA, const auto& entryB) {
+            return entryA.startPageIdx < entryB.startPageIdx;
+        });
+    for (const auto& entry : sortedEntries) {
         ser.processValue(entry.startPageIdx);
         ser.processValue(entry.numPages);
     }
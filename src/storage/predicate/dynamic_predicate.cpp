@@ -0,0 +1,67 @@
+#include "storage/predicate/dynamic_predicate.h"
+
+#include "common/type_utils.h"
+#include "storage/table/column_chunk_stats.h"
+
+using namespace lbug::common;
+
+namespace lbug {
+namespace storage {
+
+bool DynamicBound::isSupported(const LogicalType& type) {
+    if (type.getPhysicalType() == PhysicalTypeID::BOOL) {
+        return false;
+    }
+    return TypeUtils::visit(type.getPhysicalType(),
+        []<typename T>(T) { return StorageValueType<T>; });
+}
+
+void DynamicBound::tighten(StorageValue newValue) {
+    std::unique_lock lck{mtx};
+    if (published) {
+        auto isTighter = isLowerBound ? newValue.gt(value, physicalType) :
+                                        value.gt(newValue, physicalType);
+        if (!isTighter) {
+            return;
+        }
+    }
+    value = newValue;
+    published = true;
+}
+
+std::optional<StorageValue> DynamicBound::get() const {
+    if (!published) {
+        return std::nullopt;
+    }
+    std::unique_lock lck{mtx};
+    return value;
+}
+
+ZoneMapCheckResult ColumnDynamicPredicate::checkZoneMap(
+    const MergedColumnChunkStats& mergedStats) const {
+    auto value = bound->get();
+    if (!value.has_value()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    if (mergedStats.guaranteedAllNulls) {
+        return canSkipNulls ? ZoneMapCheckResult::SKIP_SCAN : ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    if (!canSkipNulls && !mergedStats.guaranteedNoNulls) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    auto& stats = mergedStats.stats;
+    if (!stats.min.has_value() || !stats.max.has_value()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    auto physicalType = bound->getPhysicalType();
+    auto outOfBound = bound->isLower() ? value->gt(*stats.max, physicalType) :
+                                         stats.min->gt(*value, physicalType);
+    return outOfBound ? ZoneMapCheckResult::SKIP_SCAN : ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
+std::string ColumnDynamicPredicate::toString() {
+    return ColumnPredicate::toString() + " <dynamic>";
+}
+
+} // namespace storage
+} // namespace lbug
@@ -536,6 +536,14 @@ void ChunkedNodeGroup::commitDelete(row_idx_t startRow, row_idx_t numRows_,
     versionInfo->commitDelete(startRow, numRows_, commitTS);
 }
 
+// NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+void ChunkedNodeGroup::collapseInsertVersions(row_idx_t startRow, row_idx_t numRows_,
+    transaction_t) {
+    if (versionInfo) {
+        versionInfo->collapseInsertions(startRow, numRows_, numRows);
+    }
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
 void ChunkedNodeGroup::rollbackDelete(row_idx_t startRow, row_idx_t numRows_, transaction_t) {
     versionInfo->rollbackDelete(startRow, numRows_);
@@ -190,10 +190,25 @@ void ColumnChunk::update(const Transaction* transaction, offset_t offsetInChunk,
     const auto rowIdxInVector = offsetInChunk % DEFAULT_VECTOR_CAPACITY;
     auto& vectorUpdateInfo = updateInfo.update(data.front()->getMemoryManager(), transaction,
         vectorIdx, rowIdxInVector, values);
-    transaction->pushVectorUpdateInfo(updateInfo, vectorIdx, vectorUpdateInfo,
+    transaction->pushVectorUpdateInfo(*this, updateInfo, vectorIdx, vectorUpdateInfo,
         transaction->getID());
 }
 
+void ColumnChunk::collapseUpdates(idx_t vectorIdx) {
+    if (getResidencyState() != ResidencyState::IN_MEMORY) {
+        return;
+    }
+    updateInfo.collapse(vectorIdx, [&](const VectorUpdateInfo& vectorUpdateInfo) {
+        for (auto i = 0u; i < vectorUpdateInfo.numRowsUpdated; i++) {
+            const auto offsetInChunk =
+                vectorIdx * DEFAULT_VECTOR_CAPACITY + vectorUpdateInfo.rowsInVector[i];
+            rangeSegments(offsetInChunk, 1, [&](auto& segment, auto offsetInSegment, auto, auto) {
+                segment->write(vectorUpdateInfo.data.get(), i, offsetInSegment, 1);
+            });
+        }
+    });
+}
+
 MergedColumnChunkStats ColumnChunk::getMergedColumnChunkStats() const {
     KU_ASSERT(!updateInfo.isSet());
     auto baseStats = MergedColumnChunkStats{ColumnChunkStats{}, true, true};
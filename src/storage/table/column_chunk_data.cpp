@@ -364,6 +364,7 @@ void ColumnChunkData::initializeScanState(SegmentState& state, const Column* col
         nullData->initializeScanState(*state.nullState, column->getNullColumn());
     }
     state.column = column;
+    state.skipScan = false;
     if (residencyState == ResidencyState::ON_DISK) {
         state.metadata = metadata;
         state.numValuesPerPage = state.metadata.compMeta.numValues(LBUG_PAGE_SIZE, dataType);
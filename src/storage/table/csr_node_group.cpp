@@ -491,9 +491,14 @@ static std::unique_ptr<ChunkedCSRNodeGroup> createNewPersistentChunkGroup(
 }
 
 void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheckpointState& state) {
-    // TODO(Guodong): Should skip early here if no changes in the node group, so we avoid scanning
-    // the csr header. Case: No insertions/deletions in persistent chunk and no in-mem chunks.
     auto& csrState = state.cast<CSRNodeGroupCheckpointState>();
+    if (!hasChangesToCheckpoint(lock, csrState)) {
+        // Nothing was inserted, deleted or updated in this node group, so no CSR region needs to be
+        // rewritten. Skip scanning the csr header, which keeps the checkpoint after appending a
+        // small batch of rels (e.g. COPY into a large non-empty table) proportional to the
+        // touched node groups instead of the whole table.
+        return;
+    }
     // Scan old csr header from disk and construct new csr header.
     persistentChunkGroup->cast<ChunkedCSRNodeGroup>().scanCSRHeader(*state.mm, csrState);
     csrState.newHeader =
@@ -552,6 +557,14 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
     finalizeCheckpoint(lock);
 }
 
+bool CSRNodeGroup::hasChangesToCheckpoint(const UniqLock& lock,
+    const CSRNodeGroupCheckpointState& csrState) const {
+    KU_ASSERT(persistentChunkGroup);
+    return !chunkedGroups.isEmpty(lock) || persistentChunkGroup->hasVersionInfo() ||
+           persistentChunkGroup->hasUpdates() ||
+           csrState.columnIDs.size() != persistentChunkGroup->getNumColumns();
+}
+
 std::vector<CSRRegion> CSRNodeGroup::collectLeafRegionsAndCSRLength(const UniqLock& lock,
     const CSRNodeGroupCheckpointState& csrState) const {
     std::vector<CSRRegion> leafRegions;
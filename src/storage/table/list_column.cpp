@@ -85,6 +85,11 @@ bool ListColumn::disableCompressionOnData(const LogicalType& dataType) {
     return false;
 }
 
+void ListColumn::projectFields(SegmentState& state,
+    const std::vector<struct_field_path_t>& fieldPaths) const {
+    dataColumn->projectFields(state.getChildState(DATA_COLUMN_CHILD_READ_STATE_IDX), fieldPaths);
+}
+
 std::unique_ptr<ColumnChunkData> ListColumn::flushChunkData(const ColumnChunkData& chunk,
     PageAllocator& pageAllocator) {
     auto flushedChunk = flushNonNestedChunkData(chunk, pageAllocator);
@@ -171,6 +171,11 @@ static void initializeScanStateForChunkedGroup(const TableScanState& state,
         auto& chunk = chunkedGroup->getColumnChunk(columnID);
         auto& chunkState = nodeGroupScanState.chunkStates[i];
         chunk.initializeScanState(chunkState, state.columns[i]);
+        if (i < state.columnFieldPaths.size() && !state.columnFieldPaths[i].empty()) {
+            for (auto& segmentState : chunkState.segmentStates) {
+                state.columns[i]->projectFields(segmentState, state.columnFieldPaths[i]);
+            }
+        }
     }
 }
 
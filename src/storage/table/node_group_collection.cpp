@@ -1,6 +1,12 @@
 #include "storage/table/node_group_collection.h"
 
+#include <condition_variable>
+#include <mutex>
+
+#include "common/task_system/task_scheduler.h"
 #include "common/vector/value_vector.h"
+#include "main/client_context.h"
+#include "storage/page_allocator.h"
 #include "storage/table/chunked_node_group.h"
 #include "storage/table/csr_node_group.h"
 #include "storage/table/table.h"
@@ -198,13 +204,167 @@ uint64_t NodeGroupCollection::getEstimatedMemoryUsage() const {
     return estimatedMemUsage;
 }
 
-// NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
-void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
+// Pages that node groups checkpointed concurrently allocate from the shared page allocator once
+// their reserved range runs out. A node group only allocates from it after all node groups before
+// it completed their checkpoint, so that these pages are allocated in node group order as well.
+class OrderedPageAllocation {
+public:
+    OrderedPageAllocation(PageAllocator& pageAllocator, node_group_idx_t numNodeGroups)
+        : pageAllocator{pageAllocator}, completed(numNodeGroups, false),
+          numCompletedNodeGroups{0} {}
+
+    PageRange allocatePageRange(node_group_idx_t nodeGroupIdx, page_idx_t numPages) {
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return numCompletedNodeGroups >= nodeGroupIdx; });
+        return pageAllocator.allocatePageRange(numPages);
+    }
+
+    void complete(node_group_idx_t nodeGroupIdx) {
+        std::unique_lock lck{mtx};
+        completed[nodeGroupIdx] = true;
+        while (numCompletedNodeGroups < completed.size() && completed[numCompletedNodeGroups]) {
+            numCompletedNodeGroups++;
+        }
+        lck.unlock();
+        cv.notify_all();
+    }
+
+private:
+    PageAllocator& pageAllocator;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<bool> completed;
+    // Number of node groups at the start of the collection that completed their checkpoint.
+    node_group_idx_t numCompletedNodeGroups;
+};
+
+// Allocates the pages of the checkpoint of one node group from a page range reserved for it before
+// the node groups are checkpointed, so that the pages of a node group do not depend on how the
+// checkpoints of the node groups interleave.
+class NodeGroupPageAllocator final : public PageAllocator {
+public:
+    NodeGroupPageAllocator(PageAllocator& pageAllocator, OrderedPageAllocation& orderedAllocation,
+        node_group_idx_t nodeGroupIdx, PageRange reservedPages)
+        : PageAllocator{pageAllocator.getDataFH()}, pageAllocator{pageAllocator},
+          orderedAllocation{orderedAllocation}, nodeGroupIdx{nodeGroupIdx},
+          reservedPages{reservedPages}, numUsedPages{0} {}
+
+    PageRange allocatePageRange(page_idx_t numPages) override {
+        if (numPages == 0) {
+            // Empty ranges (e.g. of constant compressed chunks) occupy no pages.
+            return pageAllocator.allocatePageRange(numPages);
+        }
+        if (numUsedPages + numPages > reservedPages.numPages) {
+            return orderedAllocation.allocatePageRange(nodeGroupIdx, numPages);
+        }
+        const auto startPageIdx = reservedPages.startPageIdx + numUsedPages;
+        numUsedPages += numPages;
+        return PageRange(startPageIdx, numPages);
+    }
+
+    void freePageRange(PageRange block) override { pageAllocator.freePageRange(block); }
+
+    // Frees the reserved pages that the checkpoint did not use.
+    void freeUnusedPages() {
+        if (numUsedPages < reservedPages.numPages) {
+            pageAllocator.freePageRange(PageRange(reservedPages.startPageIdx + numUsedPages,
+                reservedPages.numPages - numUsedPages));
+        }
+    }
+
+private:
+    PageAllocator& pageAllocator;
+    OrderedPageAllocation& orderedAllocation;
+    node_group_idx_t nodeGroupIdx;
+    PageRange reservedPages;
+    page_idx_t numUsedPages;
+};
+
+// Workers repeatedly claim the next node group and checkpoint it with its own copy of the
+// checkpoint state. Node groups own disjoint column chunks, so the only shared resources are the
+// page allocator and the shadow file, both of which are thread-safe.
+class NodeGroupCheckpointTask final : public Task {
+public:
+    NodeGroupCheckpointTask(uint64_t maxNumThreads, MemoryManager& memoryManager,
+        const std::vector<std::unique_ptr<NodeGroup>>& nodeGroups,
+        const NodeGroupCheckpointState& state,
+        std::vector<std::unique_ptr<NodeGroupPageAllocator>>& pageAllocators,
+        OrderedPageAllocation& orderedAllocation)
+        : Task{maxNumThreads}, memoryManager{memoryManager}, nodeGroups{nodeGroups}, state{state},
+          pageAllocators{pageAllocators}, orderedAllocation{orderedAllocation},
+          nextNodeGroupIdx{0} {}
+
+    void run() override {
+        while (true) {
+            const auto nodeGroupIdx = nextNodeGroupIdx.fetch_add(1);
+            if (nodeGroupIdx >= nodeGroups.size()) {
+                break;
+            }
+            try {
+                const auto localState = state.copy(*pageAllocators[nodeGroupIdx]);
+                nodeGroups[nodeGroupIdx]->checkpoint(memoryManager, *localState);
+            } catch (...) {
+                // Node groups after this one may wait for it to allocate pages.
+                orderedAllocation.complete(nodeGroupIdx);
+                throw;
+            }
+            orderedAllocation.complete(nodeGroupIdx);
+        }
+    }
+
+private:
+    MemoryManager& memoryManager;
+    const std::vector<std::unique_ptr<NodeGroup>>& nodeGroups;
+    const NodeGroupCheckpointState& state;
+    std::vector<std::unique_ptr<NodeGroupPageAllocator>>& pageAllocators;
+    OrderedPageAllocation& orderedAllocation;
+    std::atomic<node_group_idx_t> nextNodeGroupIdx;
+};
+
+// Estimates the pages the checkpoint of a node group allocates: its in-memory data, which is
+// usually larger than once compressed, plus a few pages per column for partially filled pages.
+static page_idx_t estimateNumPagesToCheckpoint(const NodeGroup& nodeGroup,
+    const NodeGroupCheckpointState& state) {
+    const auto memoryUsage = nodeGroup.getEstimatedMemoryUsage();
+    if (memoryUsage == 0) {
+        return 0;
+    }
+    return ColumnChunkData::getNumPagesForBytes(memoryUsage) + 2 * state.columnIDs.size();
+}
+
+void NodeGroupCollection::checkpoint(main::ClientContext* context, MemoryManager& memoryManager,
     NodeGroupCheckpointState& state) {
     KU_ASSERT(residency == ResidencyState::ON_DISK);
     const auto lock = nodeGroups.lock();
-    for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
-        nodeGroup->checkpoint(memoryManager, state);
+    const auto& groups = nodeGroups.getAllGroups(lock);
+    const auto numThreads = std::min<uint64_t>(context->getMaxNumThreadForExec(), groups.size());
+    if (numThreads <= 1) {
+        for (const auto& nodeGroup : groups) {
+            nodeGroup->checkpoint(memoryManager, state);
+        }
+    } else {
+        // Reserve the pages of each node group in node group order before checkpointing them
+        // concurrently, so that the layout of the checkpointed data is deterministic.
+        OrderedPageAllocation orderedAllocation{state.pageAllocator, groups.size()};
+        std::vector<std::unique_ptr<NodeGroupPageAllocator>> pageAllocators;
+        for (auto i = 0u; i < groups.size(); i++) {
+            const auto numPages = estimateNumPagesToCheckpoint(*groups[i], state);
+            const auto reservedPages =
+                numPages == 0 ? PageRange{} : state.pageAllocator.allocatePageRange(numPages);
+            pageAllocators.push_back(std::make_unique<NodeGroupPageAllocator>(state.pageAllocator,
+                orderedAllocation, i, reservedPages));
+        }
+        auto task = std::make_shared<NodeGroupCheckpointTask>(numThreads, memoryManager, groups,
+            state, pageAllocators, orderedAllocation);
+        // Checkpoints can be triggered by a COMMIT or CHECKPOINT statement that is itself running
+        // on a worker thread. Launch a dedicated thread so the task always makes progress even if
+        // that worker is the only one in the system. The checkpoint must not be abandoned halfway,
+        // so it is neither subject to the timeout of the client nor interrupted.
+        TaskScheduler::Get(*context)->scheduleTaskAndWaitOrError(task, nullptr /* context */,
+            true /* launchNewWorkerThread */);
+        for (auto& pageAllocator : pageAllocators) {
+            pageAllocator->freeUnusedPages();
+        }
     }
     std::vector<LogicalType> typesAfterCheckpoint;
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
@@ -498,6 +498,7 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
         nodeGroups->getNodeGroup(nodeGroupIdx)
             ->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
                 nodeUpdateState.propertyVector);
+        transaction->addToWriteSet(tableID, nodeOffset);
     }
     if (updateState.logToWAL && transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
@@ -534,6 +535,7 @@ bool NodeTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
         if (transaction->shouldAppendToUndoBuffer()) {
             transaction->pushDeleteInfo(nodeGroupIdx, rowIdxInGroup, 1, &versionRecordHandler);
         }
+        transaction->addToWriteSet(tableID, nodeOffset);
     }
     if (isDeleted) {
         hasChanges = true;
@@ -644,6 +646,15 @@ void NodeTable::commit(main::ClientContext* context, TableCatalogEntry* tableEnt
     localTable->clear(*MemoryManager::Get(*context));
 }
 
+bool NodeTable::hasDeletions(const Transaction* transaction) const {
+    for (auto i = 0u; i < nodeGroups->getNumNodeGroups(); i++) {
+        if (nodeGroups->getNodeGroup(i)->hasDeletions(transaction)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 visible_func NodeTable::getVisibleFunc(const Transaction* transaction) const {
     return
         [this, transaction](offset_t offset_) -> bool { return isVisible(transaction, offset_); };
@@ -670,7 +681,7 @@ bool NodeTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tabl
 
         NodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator,
             memoryManager};
-        nodeGroups->checkpoint(*memoryManager, state);
+        nodeGroups->checkpoint(context, *memoryManager, state);
         for (auto& index : indexes) {
             index.checkpoint(context, pageAllocator);
         }
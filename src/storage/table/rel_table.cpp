@@ -2,8 +2,9 @@
 
 #include <algorithm>
 #include <atomic>
-#include <deque>
+#include <functional>
 #include <mutex>
+#include <span>
 #include <thread>
 
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
@@ -252,6 +253,7 @@ void RelTable::update(Transaction* transaction, TableUpdateState& updateState) {
                 relUpdateState.getBoundNodeIDVector(relData->getDirection()),
                 relUpdateState.relIDVector, relUpdateState.columnID, relUpdateState.propertyVector);
         }
+        transaction->addToWriteSet(tableID, relOffset);
     }
     if (updateState.logToWAL && transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
@@ -282,6 +284,9 @@ bool RelTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
                 break;
             }
         }
+        if (isDeleted) {
+            transaction->addToWriteSet(tableID, relOffset);
+        }
     }
     if (isDeleted) {
         hasChanges = true;
@@ -325,6 +330,53 @@ void RelTable::detachDelete(Transaction* transaction, RelTableDeleteState* delet
     hasChanges = true;
 }
 
+static void runInParallel(uint64_t maxThreads, size_t numTasks,
+    const std::function<void(size_t)>& func) {
+    const auto numWorkers = std::min<size_t>(numTasks, std::max<uint64_t>(1, maxThreads));
+    if (numWorkers <= 1) {
+        for (auto i = 0u; i < numTasks; i++) {
+            func(i);
+        }
+        return;
+    }
+    std::atomic<size_t> nextTaskIdx{0};
+    std::vector<std::thread> workers;
+    workers.reserve(numWorkers);
+    for (size_t i = 0; i < numWorkers; i++) {
+        workers.emplace_back([&]() {
+            while (true) {
+                const auto taskIdx = nextTaskIdx.fetch_add(1);
+                if (taskIdx >= numTasks) {
+                    break;
+                }
+                func(taskIdx);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// Splits items sorted by node offset into [begin, end) ranges that fall into the same node group.
+template<typename T, typename GET_OFFSET>
+static std::vector<std::pair<size_t, size_t>> getNodeGroupRanges(const std::vector<T>& items,
+    GET_OFFSET getOffset) {
+    std::vector<std::pair<size_t, size_t>> ranges;
+    size_t begin = 0;
+    while (begin < items.size()) {
+        const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(getOffset(items[begin]));
+        auto end = begin + 1;
+        while (end < items.size() &&
+               StorageUtils::getNodeGroupIdx(getOffset(items[end])) == nodeGroupIdx) {
+            end++;
+        }
+        ranges.emplace_back(begin, end);
+        begin = end;
+    }
+    return ranges;
+}
+
 void RelTable::detachDeleteBatch(Transaction* transaction, ValueVector& srcNodeIDVector,
     ValueVector& dstNodeIDVector, ValueVector& relIDVector, RelDataDirection direction) {
     KU_UNUSED(dstNodeIDVector);
@@ -356,116 +408,105 @@ void RelTable::detachDeleteBatch(Transaction* transaction, ValueVector& srcNodeI
         return;
     }
 
-    struct RelDeleteRecord {
-        nodeID_t srcNodeID;
-        nodeID_t dstNodeID;
-        nodeID_t relID;
-        node_group_idx_t srcNodeGroupIdx;
-        node_group_idx_t dstNodeGroupIdx;
-    };
-
     const auto maxThreads = transaction->getClientContext()
                                 ->getCurrentSetting(main::ThreadsSetting::name)
                                 .getValue<uint64_t>();
-    const auto numWorkers = std::min<size_t>(srcNodeIDs.size(), std::max<uint64_t>(1, maxThreads));
-    std::atomic<size_t> nextSrcNodeIdx{0};
-    std::mutex recordsMtx;
-    std::vector<RelDeleteRecord> records;
-
-    auto scanWorker = [&]() {
-        std::vector<RelDeleteRecord> localRecords;
-        while (true) {
-            const auto srcIdx = nextSrcNodeIdx.fetch_add(1);
-            if (srcIdx >= srcNodeIDs.size()) {
-                break;
-            }
-            const auto srcNodeID = srcNodeIDs[srcIdx];
-            const auto tempState = std::make_shared<DataChunkState>();
-            tempState->setToFlat();
-            ValueVector tempSrcNodeID(LogicalType::INTERNAL_ID());
-            tempSrcNodeID.setState(tempState);
-            tempSrcNodeID.setValue(0, srcNodeID);
-
-            const auto outState = std::make_shared<DataChunkState>();
-            ValueVector tempDstNodeIDVector(LogicalType::INTERNAL_ID());
-            ValueVector tempRelIDVector(LogicalType::INTERNAL_ID());
-            tempDstNodeIDVector.setState(outState);
-            tempRelIDVector.setState(outState);
-
-            auto relReadState = std::make_unique<RelTableScanState>(*memoryManager, &tempSrcNodeID,
-                std::vector<ValueVector*>{&tempDstNodeIDVector, &tempRelIDVector}, outState,
-                true /*randomLookup*/);
-            relReadState->setToTable(transaction, this, {NBR_ID_COLUMN_ID, REL_ID_COLUMN_ID}, {},
-                direction);
-            initScanState(transaction, *relReadState);
-
-            while (scan(transaction, *relReadState)) {
-                const auto& relSelVec = tempRelIDVector.state->getSelVector();
-                const auto numRelsScanned = relSelVec.getSelSize();
-                for (auto i = 0u; i < numRelsScanned; i++) {
-                    const auto pos = relSelVec[i];
-                    const auto dstNodeID = tempDstNodeIDVector.getValue<nodeID_t>(pos);
-                    localRecords.push_back(
-                        {srcNodeID, dstNodeID, tempRelIDVector.getValue<nodeID_t>(pos),
-                            StorageUtils::getNodeGroupIdx(srcNodeID.offset),
-                            StorageUtils::getNodeGroupIdx(dstNodeID.offset)});
-                }
-            }
-        }
-        if (!localRecords.empty()) {
-            std::lock_guard<std::mutex> lck{recordsMtx};
-            records.insert(records.end(), localRecords.begin(), localRecords.end());
-        }
+    // Committed rels are deleted by their row positions: the CSR list of each bound node is
+    // scanned once, so the cost of detaching a node is linear in its degree. Work is split by
+    // node group, and each node group is owned by a single worker.
+    std::ranges::sort(srcNodeIDs, {}, &nodeID_t::offset);
+    const auto srcGroupRanges = getNodeGroupRanges(srcNodeIDs,
+        [](const nodeID_t& nodeID) { return nodeID.offset; });
+    struct ReverseRel {
+        nodeID_t boundNodeID;
+        offset_t relOffset;
     };
-
-    if (numWorkers <= 1) {
-        scanWorker();
-    } else {
-        std::vector<std::thread> workers;
-        workers.reserve(numWorkers);
-        for (size_t i = 0; i < numWorkers; i++) {
-            workers.emplace_back(scanWorker);
-        }
-        for (auto& worker : workers) {
-            worker.join();
-        }
-    }
-
-    std::vector<RelDeleteRecord> localRelRecords;
-    std::vector<RelDeleteRecord> committedRelRecords;
-    localRelRecords.reserve(records.size());
-    committedRelRecords.reserve(records.size());
-    for (const auto& record : records) {
-        if (record.relID.offset >= StorageConstants::MAX_NUM_ROWS_IN_TABLE) {
-            localRelRecords.push_back(record);
-        } else {
-            committedRelRecords.push_back(record);
+    std::mutex reverseRelsMtx;
+    std::vector<ReverseRel> reverseRels;
+    runInParallel(maxThreads, srcGroupRanges.size(), [&](size_t idx) {
+        const auto [begin, end] = srcGroupRanges[idx];
+        const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(srcNodeIDs[begin].offset);
+        const auto boundNodeState = std::make_shared<DataChunkState>();
+        boundNodeState->setToFlat();
+        ValueVector boundNodeIDVector(LogicalType::INTERNAL_ID());
+        boundNodeIDVector.setState(boundNodeState);
+        std::vector<CSRRelPosition> positions;
+        for (auto i = begin; i < end; i++) {
+            boundNodeIDVector.setValue(0, srcNodeIDs[i]);
+            tableData->scanCommittedRelPositions(transaction, boundNodeIDVector, positions);
         }
-    }
-
-    std::unordered_map<node_group_idx_t, size_t> srcLockIdxByGroup;
-    std::deque<std::mutex> srcGroupLocks;
-    for (const auto& record : committedRelRecords) {
-        if (!srcLockIdxByGroup.contains(record.srcNodeGroupIdx)) {
-            srcLockIdxByGroup.insert({record.srcNodeGroupIdx, srcGroupLocks.size()});
-            srcGroupLocks.emplace_back();
+        if (positions.empty()) {
+            return;
         }
-    }
-    std::unordered_map<node_group_idx_t, size_t> dstLockIdxByGroup;
-    std::deque<std::mutex> dstGroupLocks;
-    if (reverseTableData) {
-        for (const auto& record : committedRelRecords) {
-            if (!dstLockIdxByGroup.contains(record.dstNodeGroupIdx)) {
-                dstLockIdxByGroup.insert({record.dstNodeGroupIdx, dstGroupLocks.size()});
-                dstGroupLocks.emplace_back();
+        if (reverseTableData) {
+            std::vector<ReverseRel> localReverseRels;
+            localReverseRels.reserve(positions.size());
+            for (const auto& position : positions) {
+                localReverseRels.push_back({position.nbrNodeID, position.relOffset});
             }
+            std::lock_guard<std::mutex> lck{reverseRelsMtx};
+            reverseRels.insert(reverseRels.end(), localReverseRels.begin(), localReverseRels.end());
         }
+        tableData->deleteByPositions(transaction, nodeGroupIdx, positions);
+    });
+
+    // Each neighbour's CSR list in the other direction is likewise scanned once, no matter how
+    // many of its rels are being removed.
+    if (!reverseRels.empty()) {
+        std::ranges::sort(reverseRels, [](const ReverseRel& a, const ReverseRel& b) {
+            return std::tie(a.boundNodeID.offset, a.relOffset) <
+                   std::tie(b.boundNodeID.offset, b.relOffset);
+        });
+        const auto dstGroupRanges = getNodeGroupRanges(reverseRels,
+            [](const ReverseRel& rel) { return rel.boundNodeID.offset; });
+        runInParallel(maxThreads, dstGroupRanges.size(), [&](size_t idx) {
+            const auto [begin, end] = dstGroupRanges[idx];
+            const auto nodeGroupIdx =
+                StorageUtils::getNodeGroupIdx(reverseRels[begin].boundNodeID.offset);
+            const auto boundNodeState = std::make_shared<DataChunkState>();
+            boundNodeState->setToFlat();
+            ValueVector boundNodeIDVector(LogicalType::INTERNAL_ID());
+            boundNodeIDVector.setState(boundNodeState);
+            std::vector<CSRRelPosition> nodePositions;
+            std::vector<CSRRelPosition> positions;
+            auto nodeBegin = begin;
+            while (nodeBegin < end) {
+                const auto boundNodeID = reverseRels[nodeBegin].boundNodeID;
+                auto nodeEnd = nodeBegin;
+                while (nodeEnd < end && reverseRels[nodeEnd].boundNodeID == boundNodeID) {
+                    nodeEnd++;
+                }
+                boundNodeIDVector.setValue(0, boundNodeID);
+                nodePositions.clear();
+                reverseTableData->scanCommittedRelPositions(transaction, boundNodeIDVector,
+                    nodePositions);
+                const auto relsToDelete = std::span{reverseRels}.subspan(nodeBegin,
+                    nodeEnd - nodeBegin);
+                for (const auto& position : nodePositions) {
+                    if (std::ranges::binary_search(relsToDelete, position.relOffset, {},
+                            &ReverseRel::relOffset)) {
+                        positions.push_back(position);
+                    }
+                }
+                nodeBegin = nodeEnd;
+            }
+            reverseTableData->deleteByPositions(transaction, nodeGroupIdx, positions);
+        });
     }
 
-    const auto applyNumWorkers =
-        std::min<size_t>(committedRelRecords.size(), std::max<uint64_t>(1, maxThreads));
-    std::atomic<size_t> nextApplyIdx{0};
-    auto applyWorker = [&]() {
+    // Keep local rel deletes serial. Local table data structures are not designed for concurrent
+    // writes.
+    if (localTable) {
+        auto& localRelTable = localTable->cast<LocalRelTable>();
+        const auto tempState = std::make_shared<DataChunkState>();
+        tempState->setToFlat();
+        ValueVector tempSrcNodeID(LogicalType::INTERNAL_ID());
+        tempSrcNodeID.setState(tempState);
+        const auto outState = std::make_shared<DataChunkState>();
+        ValueVector tempDstNodeIDVector(LogicalType::INTERNAL_ID());
+        ValueVector tempRelIDVector(LogicalType::INTERNAL_ID());
+        tempDstNodeIDVector.setState(outState);
+        tempRelIDVector.setState(outState);
         const auto writeState = std::make_shared<DataChunkState>();
         writeState->setToFlat();
         ValueVector writeSrcNodeIDVector(LogicalType::INTERNAL_ID());
@@ -474,60 +515,49 @@ void RelTable::detachDeleteBatch(Transaction* transaction, ValueVector& srcNodeI
         writeSrcNodeIDVector.setState(writeState);
         writeDstNodeIDVector.setState(writeState);
         writeRelIDVector.setState(writeState);
-        while (true) {
-            const auto idx = nextApplyIdx.fetch_add(1);
-            if (idx >= committedRelRecords.size()) {
-                break;
+        std::vector<std::pair<nodeID_t, nodeID_t>> localRels;
+        for (const auto& srcNodeID : srcNodeIDs) {
+            tempSrcNodeID.setValue(0, srcNodeID);
+            if (!localRelTable.checkIfNodeHasRels(&tempSrcNodeID, direction)) {
+                continue;
             }
-            const auto& record = committedRelRecords[idx];
-            writeSrcNodeIDVector.setValue(0, record.srcNodeID);
-            writeDstNodeIDVector.setValue(0, record.dstNodeID);
-            writeRelIDVector.setValue(0, record.relID);
-            const auto srcLockIdx = srcLockIdxByGroup.at(record.srcNodeGroupIdx);
-            std::lock_guard<std::mutex> srcLck{srcGroupLocks[srcLockIdx]};
-            [[maybe_unused]] const auto deleted =
-                tableData->delete_(transaction, writeSrcNodeIDVector, writeRelIDVector);
-            if (reverseTableData) {
-                const auto dstLockIdx = dstLockIdxByGroup.at(record.dstNodeGroupIdx);
-                std::lock_guard<std::mutex> dstLck{dstGroupLocks[dstLockIdx]};
-                [[maybe_unused]] const auto reverseDeleted =
-                    reverseTableData->delete_(transaction, writeDstNodeIDVector, writeRelIDVector);
+            auto relReadState = std::make_unique<RelTableScanState>(*memoryManager,
+                &tempSrcNodeID, std::vector<ValueVector*>{&tempDstNodeIDVector, &tempRelIDVector},
+                outState, true /*randomLookup*/);
+            relReadState->setToTable(transaction, this, {NBR_ID_COLUMN_ID, REL_ID_COLUMN_ID}, {},
+                direction);
+            initScanState(transaction, *relReadState);
+            localRels.clear();
+            while (scan(transaction, *relReadState)) {
+                const auto& relSelVec = tempRelIDVector.state->getSelVector();
+                for (auto i = 0u; i < relSelVec.getSelSize(); i++) {
+                    const auto pos = relSelVec[i];
+                    const auto relID = tempRelIDVector.getValue<nodeID_t>(pos);
+                    if (relID.offset >= StorageConstants::MAX_NUM_ROWS_IN_TABLE) {
+                        localRels.emplace_back(tempDstNodeIDVector.getValue<nodeID_t>(pos), relID);
+                    }
+                }
+            }
+            for (const auto& [dstNodeID, relID] : localRels) {
+                writeSrcNodeIDVector.setValue(0, srcNodeID);
+                writeDstNodeIDVector.setValue(0, dstNodeID);
+                writeRelIDVector.setValue(0, relID);
+                RelTableDeleteState localDeleteState{writeSrcNodeIDVector, writeDstNodeIDVector,
+                    writeRelIDVector, direction};
+                localTable->delete_(transaction, localDeleteState);
             }
-        }
-    };
-
-    if (applyNumWorkers <= 1) {
-        applyWorker();
-    } else {
-        std::vector<std::thread> applyWorkers;
-        applyWorkers.reserve(applyNumWorkers);
-        for (size_t i = 0; i < applyNumWorkers; i++) {
-            applyWorkers.emplace_back(applyWorker);
-        }
-        for (auto& worker : applyWorkers) {
-            worker.join();
         }
     }
-
-    // Keep local rel deletes serial. Local table data structures are not designed for concurrent
-    // writes.
-    if (!localRelRecords.empty()) {
-        KU_ASSERT(localTable);
-        const auto writeState = std::make_shared<DataChunkState>();
-        writeState->setToFlat();
-        ValueVector writeSrcNodeIDVector(LogicalType::INTERNAL_ID());
-        ValueVector writeDstNodeIDVector(LogicalType::INTERNAL_ID());
-        ValueVector writeRelIDVector(LogicalType::INTERNAL_ID());
-        writeSrcNodeIDVector.setState(writeState);
-        writeDstNodeIDVector.setState(writeState);
-        writeRelIDVector.setState(writeState);
-        for (const auto& record : localRelRecords) {
-            writeSrcNodeIDVector.setValue(0, record.srcNodeID);
-            writeDstNodeIDVector.setValue(0, record.dstNodeID);
-            writeRelIDVector.setValue(0, record.relID);
-            RelTableDeleteState localDeleteState{writeSrcNodeIDVector, writeDstNodeIDVector,
-                writeRelIDVector, direction};
-            localTable->delete_(transaction, localDeleteState);
+    if (transaction->shouldLogToWAL()) {
+        KU_ASSERT(transaction->isWriteTransaction());
+        auto& wal = transaction->getLocalWAL();
+        const auto logState = std::make_shared<DataChunkState>();
+        logState->setToFlat();
+        ValueVector logSrcNodeIDVector(LogicalType::INTERNAL_ID());
+        logSrcNodeIDVector.setState(logState);
+        for (const auto& srcNodeID : srcNodeIDs) {
+            logSrcNodeIDVector.setValue(0, srcNodeID);
+            wal.logRelDetachDelete(tableID, direction, &logSrcNodeIDVector);
         }
     }
     hasChanges = true;
@@ -590,13 +620,16 @@ void RelTable::detachDeleteForCSRRels(Transaction* transaction, RelTableData* ta
                 localTable->delete_(transaction, *deleteState);
                 continue;
             }
-            [[maybe_unused]] const auto deleted = tableData->delete_(transaction,
-                deleteState->srcNodeIDVector, deleteState->relIDVector);
+            const auto deleted = tableData->delete_(transaction, deleteState->srcNodeIDVector,
+                deleteState->relIDVector);
             if (reverseTableData) {
                 [[maybe_unused]] const auto reverseDeleted = reverseTableData->delete_(transaction,
                     deleteState->dstNodeIDVector, deleteState->relIDVector);
                 KU_ASSERT(deleted == reverseDeleted);
             }
+            if (deleted) {
+                transaction->addToWriteSet(tableID, relOffset);
+            }
         }
         tempState->getSelVectorUnsafe().setToUnfiltered();
     }
@@ -733,7 +766,7 @@ void RelTable::prepareCommitForNodeGroup(const Transaction* transaction,
     }
 }
 
-bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
+bool RelTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tableEntry,
     PageAllocator& pageAllocator) {
     bool ret = hasChanges;
     if (hasChanges) {
@@ -744,7 +777,7 @@ bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
             columnIDs.push_back(tableEntry->getColumnID(property.getName()));
         }
         for (auto& directedRelData : directedRelData) {
-            directedRelData->checkpoint(columnIDs, pageAllocator);
+            directedRelData->checkpoint(context, columnIDs, pageAllocator);
         }
         hasChanges = false;
     }
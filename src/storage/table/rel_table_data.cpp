@@ -1,5 +1,8 @@
 #include "storage/table/rel_table_data.h"
 
+#include <algorithm>
+#include <tuple>
+
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "common/enums/rel_direction.h"
 #include "common/types/types.h"
@@ -144,6 +147,82 @@ bool RelTableData::delete_(Transaction* transaction, ValueVector& boundNodeIDVec
     return isDeleted;
 }
 
+void RelTableData::scanCommittedRelPositions(Transaction* transaction,
+    ValueVector& boundNodeIDVector, std::vector<CSRRelPosition>& positions) const {
+    KU_ASSERT(boundNodeIDVector.state->getSelVector().getSelSize() == 1);
+    const auto boundNodePos = boundNodeIDVector.state->getSelVector()[0];
+    const auto boundNodeOffset = boundNodeIDVector.getValue<nodeID_t>(boundNodePos).offset;
+    const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(boundNodeOffset);
+    if (nodeGroupIdx >= getNumNodeGroups()) {
+        return;
+    }
+    DataChunk scanChunk(2);
+    // NbrID and relID output vectors.
+    scanChunk.insert(0, std::make_shared<ValueVector>(LogicalType::INTERNAL_ID()));
+    scanChunk.insert(1, std::make_shared<ValueVector>(LogicalType::INTERNAL_ID()));
+    std::vector columnIDs = {NBR_ID_COLUMN_ID, REL_ID_COLUMN_ID, ROW_IDX_COLUMN_ID};
+    auto scanState = std::make_unique<RelTableScanState>(*mm, &boundNodeIDVector,
+        std::vector{&scanChunk.getValueVectorMutable(0), &scanChunk.getValueVectorMutable(1)},
+        scanChunk.state, true /*randomLookup*/);
+    scanState->setToTable(transaction, &table, columnIDs, {}, direction);
+    scanState->initState(transaction, getNodeGroup(nodeGroupIdx));
+    const auto nbrIDVector = scanState->outputVectors[0];
+    const auto relIDVector = scanState->outputVectors[1];
+    while (true) {
+        const auto scanResult = scanState->nodeGroup->scan(transaction, *scanState);
+        if (scanResult == NODE_GROUP_SCAN_EMPTY_RESULT) {
+            break;
+        }
+        const auto source = scanState->nodeGroupScanState->cast<CSRNodeGroupScanState>().source;
+        for (auto i = 0u; i < scanState->outState->getSelVector().getSelSize(); i++) {
+            const auto pos = scanState->outState->getSelVector()[i];
+            const auto rowIdxPos = scanState->rowIdxVector->state->getSelVector()[i];
+            positions.push_back({nbrIDVector->getValue<nodeID_t>(pos),
+                relIDVector->getValue<nodeID_t>(pos).offset, source,
+                scanState->rowIdxVector->getValue<row_idx_t>(rowIdxPos)});
+        }
+    }
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+row_idx_t RelTableData::deleteByPositions(Transaction* transaction,
+    node_group_idx_t nodeGroupIdx, std::vector<CSRRelPosition>& positions) {
+    std::ranges::sort(positions, [](const CSRRelPosition& a, const CSRRelPosition& b) {
+        return std::tie(a.source, a.rowIdx) < std::tie(b.source, b.rowIdx);
+    });
+    auto& csrNodeGroup = getNodeGroup(nodeGroupIdx)->cast<CSRNodeGroup>();
+    std::vector<offset_t> deletedRelOffsets;
+    auto runSource = CSRNodeGroupScanSource::NONE;
+    row_idx_t runStart = INVALID_ROW_IDX;
+    row_idx_t runLength = 0;
+    const auto flushRun = [&]() {
+        if (runLength > 0 && transaction->shouldAppendToUndoBuffer()) {
+            transaction->pushDeleteInfo(nodeGroupIdx, runStart, runLength,
+                getVersionRecordHandler(runSource));
+        }
+        runLength = 0;
+    };
+    for (const auto& position : positions) {
+        if (!csrNodeGroup.delete_(transaction, position.source, position.rowIdx)) {
+            continue;
+        }
+        deletedRelOffsets.push_back(position.relOffset);
+        if (runLength == 0 || position.source != runSource ||
+            position.rowIdx != runStart + runLength) {
+            flushRun();
+            runSource = position.source;
+            runStart = position.rowIdx;
+        }
+        runLength++;
+    }
+    flushRun();
+    // Rels created together have consecutive offsets, so sorting lets the write set keep them as a
+    // few ranges.
+    std::ranges::sort(deletedRelOffsets);
+    transaction->addToWriteSet(table.getTableID(), deletedRelOffsets);
+    return deletedRelOffsets.size();
+}
+
 void RelTableData::addColumn(TableAddColumnState& addColumnState, PageAllocator& pageAllocator) {
     auto& definition = addColumnState.propertyDefinition;
     columns.push_back(ColumnFactory::createColumn(definition.getName(), definition.getType().copy(),
@@ -242,8 +321,8 @@ void RelTableData::pushInsertInfo(const Transaction* transaction, const CSRNodeG
         getVersionRecordHandler(source), shouldIncrementNumRows);
 }
 
-void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
-    PageAllocator& pageAllocator) {
+void RelTableData::checkpoint(main::ClientContext* context,
+    const std::vector<column_id_t>& columnIDs, PageAllocator& pageAllocator) {
     std::vector<std::unique_ptr<Column>> checkpointColumns;
     for (auto i = 0u; i < columnIDs.size(); i++) {
         const auto columnID = columnIDs[i];
@@ -258,7 +337,7 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
 
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator, mm,
         csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
-    nodeGroups->checkpoint(*mm, state);
+    nodeGroups->checkpoint(context, *mm, state);
 }
 
 void RelTableData::serialize(Serializer& serializer) const {
@@ -41,6 +41,32 @@ std::unique_ptr<ColumnChunkData> StructColumn::flushChunkData(const ColumnChunkD
     return flushedChunk;
 }
 
+void StructColumn::projectFields(SegmentState& state,
+    const std::vector<struct_field_path_t>& fieldPaths) const {
+    if (fieldPaths.empty()) {
+        return;
+    }
+    for (auto& path : fieldPaths) {
+        if (path.empty()) {
+            return;
+        }
+    }
+    for (auto i = 0u; i < childColumns.size(); i++) {
+        std::vector<struct_field_path_t> childPaths;
+        for (auto& path : fieldPaths) {
+            if (path[0] == i) {
+                childPaths.emplace_back(path.begin() + 1, path.end());
+            }
+        }
+        auto& childState = state.getChildState(i);
+        if (childPaths.empty()) {
+            childState.skipScan = true;
+        } else {
+            childColumns[i]->projectFields(childState, childPaths);
+        }
+    }
+}
+
 void StructColumn::scanSegment(const SegmentState& state, ColumnChunkData* resultChunk,
     common::offset_t startOffsetInSegment, common::row_idx_t numValuesToScan) const {
     KU_ASSERT(resultChunk->getDataType().getPhysicalType() == PhysicalTypeID::STRUCT);
@@ -62,6 +88,10 @@ void StructColumn::scanSegment(const SegmentState& state, offset_t startOffsetIn
     Column::scanSegment(state, startOffsetInSegment, numValuesToScan, resultVector, offsetInResult);
     for (auto i = 0u; i < childColumns.size(); i++) {
         const auto fieldVector = StructVector::getFieldVector(resultVector, i).get();
+        if (state.childrenStates[i].skipScan) {
+            fieldVector->setNullRange(offsetInResult, numValuesToScan, true);
+            continue;
+        }
         childColumns[i]->scanSegment(state.childrenStates[i], startOffsetInSegment, numValuesToScan,
             fieldVector, offsetInResult);
     }
@@ -71,6 +101,10 @@ void StructColumn::lookupInternal(const SegmentState& state, offset_t offsetInSe
     ValueVector* resultVector, uint32_t posInVector) const {
     for (auto i = 0u; i < childColumns.size(); i++) {
         const auto fieldVector = StructVector::getFieldVector(resultVector, i).get();
+        if (state.childrenStates[i].skipScan) {
+            fieldVector->setNull(posInVector, true);
+            continue;
+        }
         childColumns[i]->lookupInternal(state.childrenStates[i], offsetInSegment, fieldVector,
             posInVector);
     }
@@ -27,6 +27,7 @@ void TableScanState::setToTable(const transaction::Transaction*, Table* table_,
     table = table_;
     columnIDs = std::move(columnIDs_);
     columnPredicateSets = std::move(columnPredicateSets_);
+    columnFieldPaths.clear();
     nodeGroupScanState->chunkStates.resize(columnIDs.size());
 }
 
@@ -200,6 +200,36 @@ void UpdateInfo::rollback(idx_t vectorIdx, transaction_t version) {
     }
 }
 
+void UpdateInfo::collapse(idx_t vectorIdx,
+    const std::function<void(const VectorUpdateInfo&)>& applyFunc) {
+    std::unique_lock lock{mtx};
+    if (vectorIdx >= updates.size()) {
+        return;
+    }
+    auto& header = *updates[vectorIdx];
+    std::unique_lock chainLock{header.mtx};
+    auto oldest = header.info.get();
+    if (!oldest) {
+        return;
+    }
+    while (true) {
+        if (oldest->version >= Transaction::START_TRANSACTION_ID) {
+            return;
+        }
+        if (!oldest->getPrev()) {
+            break;
+        }
+        oldest = oldest->getPrev();
+    }
+    for (auto current = oldest; current; current = current->getNext()) {
+        applyFunc(*current);
+    }
+    header.info = nullptr;
+    if (std::ranges::all_of(updates, [](const auto& node) { return node->info == nullptr; })) {
+        updates.clear();
+    }
+}
+
 row_idx_t UpdateInfo::getNumUpdatedRows(const Transaction* transaction) const {
     std::unordered_set<row_idx_t> updatedRows;
     for (auto vectorIdx = 0u; vectorIdx < updates.size(); vectorIdx++) {
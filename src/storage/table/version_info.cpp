@@ -48,6 +48,7 @@ struct VectorVersionInfo {
 
     void rollbackInsertions(row_idx_t startRowInVector, row_idx_t numRows);
     void rollbackDeletions(row_idx_t startRowInVector, row_idx_t numRows);
+    void collapseInsertions();
 
     bool hasDeletions(const transaction::Transaction* transaction) const;
 
@@ -72,6 +73,8 @@ private:
 
 void VectorVersionInfo::append(const transaction_t transactionID, const row_idx_t startRow,
     const row_idx_t numRows) {
+    // Only full vectors are collapsed, so no rows can be appended to them.
+    KU_ASSERT(insertionStatus != InsertionStatus::ALWAYS_INSERTED);
     insertionStatus = InsertionStatus::CHECK_VERSION;
     if (transactionID == sameInsertionVersion) {
         return;
@@ -280,6 +283,28 @@ void VectorVersionInfo::rollbackInsertions(row_idx_t startRowInVector, row_idx_t
     }
 }
 
+void VectorVersionInfo::collapseInsertions() {
+    if (insertionStatus != InsertionStatus::CHECK_VERSION) {
+        return;
+    }
+    if (isSameInsertionVersion()) {
+        if (sameInsertionVersion >= transaction::Transaction::START_TRANSACTION_ID) {
+            return;
+        }
+    } else {
+        KU_ASSERT(insertedVersions);
+        for (auto i = 0u; i < DEFAULT_VECTOR_CAPACITY; i++) {
+            // Rolled back rows are INVALID_TRANSACTION, which is never treated as committed.
+            if (insertedVersions->operator[](i) >= transaction::Transaction::START_TRANSACTION_ID) {
+                return;
+            }
+        }
+    }
+    insertionStatus = InsertionStatus::ALWAYS_INSERTED;
+    sameInsertionVersion = INVALID_TRANSACTION;
+    insertedVersions.reset();
+}
+
 void VectorVersionInfo::rollbackDeletions(row_idx_t startRowInVector, row_idx_t numRows) {
     if (isSameDeletionVersion()) {
         // This implicitly assumes that all rows are deleted in the same transaction, so regardless
@@ -661,6 +686,28 @@ void VersionInfo::rollbackDelete(row_idx_t startRow, row_idx_t numRows) {
     }
 }
 
+void VersionInfo::collapseInsertions(row_idx_t startRow, row_idx_t numRows,
+    row_idx_t numRowsInGroup) {
+    if (numRows == 0) {
+        return;
+    }
+    const auto startVectorIdx = startRow / DEFAULT_VECTOR_CAPACITY;
+    const auto endVectorIdx = (startRow + numRows - 1) / DEFAULT_VECTOR_CAPACITY;
+    for (auto vectorIdx = startVectorIdx; vectorIdx <= endVectorIdx; vectorIdx++) {
+        const auto vectorInfo = getVectorVersionInfo(vectorIdx);
+        if (!vectorInfo) {
+            continue;
+        }
+        // A partially filled vector keeps its per-row versions. Collapsing it would force the next
+        // append to rebuild the whole array, which is costly for small, frequent commits. It is
+        // collapsed once a later commit fills it.
+        if ((vectorIdx + 1) * DEFAULT_VECTOR_CAPACITY > numRowsInGroup) {
+            continue;
+        }
+        vectorInfo->collapseInsertions();
+    }
+}
+
 void VersionInfo::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("vectors_info_size");
     serializer.write<uint64_t>(vectorsInfo.size());
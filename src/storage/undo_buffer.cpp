@@ -5,6 +5,7 @@
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "catalog/catalog_set.h"
 #include "storage/table/chunked_node_group.h"
+#include "storage/table/column_chunk.h"
 #include "storage/table/update_info.h"
 #include "storage/table/version_record_handler.h"
 #include "transaction/transaction.h"
@@ -46,6 +47,7 @@ struct VersionRecord {
 };
 
 struct VectorUpdateRecord {
+    ColumnChunk* columnChunk;
     UpdateInfo* updateInfo;
     idx_t vectorIdx;
     VectorUpdateInfo* vectorUpdateInfo;
@@ -135,13 +137,14 @@ void UndoBuffer::createVersionInfo(const UndoRecordType recordType, row_idx_t st
         VersionRecord{startRow, numRows, nodeGroupIdx, versionRecordHandler};
 }
 
-void UndoBuffer::createVectorUpdateInfo(UpdateInfo* updateInfo, const idx_t vectorIdx,
-    VectorUpdateInfo* vectorUpdateInfo, transaction_t version) {
+void UndoBuffer::createVectorUpdateInfo(ColumnChunk* columnChunk, UpdateInfo* updateInfo,
+    const idx_t vectorIdx, VectorUpdateInfo* vectorUpdateInfo, transaction_t version) {
     auto buffer = createUndoRecord(sizeof(UndoRecordHeader) + sizeof(VectorUpdateRecord));
     const UndoRecordHeader recordHeader{UndoRecordType::UPDATE_INFO, sizeof(VectorUpdateRecord)};
     *reinterpret_cast<UndoRecordHeader*>(buffer) = recordHeader;
     buffer += sizeof(UndoRecordHeader);
-    const VectorUpdateRecord vectorUpdateRecord{updateInfo, vectorIdx, vectorUpdateInfo, version};
+    const VectorUpdateRecord vectorUpdateRecord{columnChunk, updateInfo, vectorIdx,
+        vectorUpdateInfo, version};
     *reinterpret_cast<VectorUpdateRecord*>(buffer) = vectorUpdateRecord;
 }
 
@@ -168,6 +171,13 @@ void UndoBuffer::commit(transaction_t commitTS) const {
     });
 }
 
+void UndoBuffer::collapseCommittedVersions() const {
+    UndoBufferIterator iterator{*this};
+    iterator.iterate([&](UndoRecordType entryType, uint8_t const* entry) {
+        collapseRecord(entryType, entry);
+    });
+}
+
 void UndoBuffer::rollback(ClientContext* context) const {
     UndoBufferIterator iterator{*this};
     iterator.reverseIterate([&](UndoRecordType entryType, uint8_t const* entry) {
@@ -196,6 +206,28 @@ void UndoBuffer::commitRecord(UndoRecordType recordType, const uint8_t* record,
     }
 }
 
+void UndoBuffer::collapseRecord(UndoRecordType recordType, const uint8_t* record) {
+    switch (recordType) {
+    case UndoRecordType::INSERT_INFO: {
+        const auto& undoRecord = *reinterpret_cast<VersionRecord const*>(record);
+        undoRecord.versionRecordHandler->applyFuncToChunkedGroups(
+            &ChunkedNodeGroup::collapseInsertVersions, undoRecord.nodeGroupIdx,
+            undoRecord.startRow, undoRecord.numRows, INVALID_TRANSACTION);
+    } break;
+    case UndoRecordType::UPDATE_INFO: {
+        // Several records may point to the same vector. The first one collapses its chain, which
+        // invalidates `vectorUpdateInfo` of the others, so only the owning chunk is used here.
+        const auto& undoRecord = *reinterpret_cast<VectorUpdateRecord const*>(record);
+        KU_ASSERT(undoRecord.columnChunk);
+        undoRecord.columnChunk->collapseUpdates(undoRecord.vectorIdx);
+    } break;
+    default: {
+        // Deletions must stay visible as tombstones, and catalog and sequence entries have no
+        // per-row versions.
+    } break;
+    }
+}
+
 void UndoBuffer::commitCatalogEntryRecord(const uint8_t* record, const transaction_t commitTS) {
     const auto& [_, catalogEntry] = *reinterpret_cast<CatalogEntryRecord const*>(record);
     const auto newCatalogEntry = catalogEntry->getNext();
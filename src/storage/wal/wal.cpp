@@ -2,6 +2,7 @@
 
 #include "common/file_system/file_info.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/serializer/buffer_writer.h"
 #include "common/serializer/buffered_file.h"
 #include "common/serializer/in_mem_file_writer.h"
 #include "main/client_context.h"
@@ -32,6 +33,19 @@ void WAL::logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context) {
     }
     std::unique_lock lck{mtx};
     initWriter(context);
+    if (context->getDBConfig()->enableWALCompression &&
+        localWAL.getSize() >= StorageConstants::WAL_COMPRESSION_THRESHOLD) {
+        // Compress the records of the transaction together, so that the compression also exploits
+        // the redundancy across records, e.g. of the many single row insertions of a bulk CREATE.
+        BufferWriter bufferWriter{localWAL.getSize()};
+        localWAL.inMemWriter->flush(bufferWriter);
+        CompressedTransactionRecord walRecord{bufferWriter.getBlobData(), bufferWriter.getSize()};
+        if (walRecord.compressedData.size() < bufferWriter.getSize()) {
+            addNewWALRecordNoLock(walRecord);
+            flushAndSyncNoLock();
+            return;
+        }
+    }
     localWAL.inMemWriter->flush(*serializer->getWriter());
     flushAndSyncNoLock();
 }
@@ -2,10 +2,14 @@
 
 #include "catalog/catalog_entry/catalog_entry.h"
 #include "common/exception/runtime.h"
+#include "common/serializer/buffer_reader.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "main/client_context.h"
+#include "main/db_config.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/wal/checksum_reader.h"
+#include "zstd.h"
 
 using namespace lbug::common;
 using namespace lbug::binder;
@@ -33,6 +37,9 @@ std::unique_ptr<WALRecord> WALRecord::deserialize(Deserializer& deserializer,
     case WALRecordType::COMMIT_RECORD: {
         walRecord = CommitRecord::deserialize(deserializer);
     } break;
+    case WALRecordType::COMPRESSED_TRANSACTION_RECORD: {
+        walRecord = CompressedTransactionRecord::deserialize(deserializer, clientContext);
+    } break;
     case WALRecordType::CREATE_CATALOG_ENTRY_RECORD: {
         walRecord = CreateCatalogEntryRecord::deserialize(deserializer);
     } break;
@@ -100,6 +107,60 @@ std::unique_ptr<CommitRecord> CommitRecord::deserialize(Deserializer&) {
     return std::make_unique<CommitRecord>();
 }
 
+CompressedTransactionRecord::CompressedTransactionRecord(const uint8_t* data, uint64_t size)
+    : WALRecord{WALRecordType::COMPRESSED_TRANSACTION_RECORD}, uncompressedSize{size} {
+    compressedData.resize(lbug_zstd::ZSTD_compressBound(size));
+    const auto compressedSize = lbug_zstd::ZSTD_compress(compressedData.data(),
+        compressedData.size(), data, size, ZSTD_CLEVEL_DEFAULT);
+    if (lbug_zstd::ZSTD_isError(compressedSize)) {
+        throw RuntimeException("Failed to compress WAL records.");
+    }
+    compressedData.resize(compressedSize);
+}
+
+void CompressedTransactionRecord::serialize(Serializer& serializer) const {
+    WALRecord::serialize(serializer);
+    serializer.writeDebuggingInfo("uncompressed_size");
+    serializer.write<uint64_t>(uncompressedSize);
+    serializer.writeDebuggingInfo("compressed_size");
+    serializer.write<uint64_t>(compressedData.size());
+    serializer.write(compressedData.data(), compressedData.size());
+}
+
+std::unique_ptr<CompressedTransactionRecord> CompressedTransactionRecord::deserialize(
+    Deserializer& deserializer, const main::ClientContext& clientContext) {
+    std::string key;
+    auto retVal = std::make_unique<CompressedTransactionRecord>();
+    uint64_t compressedSize = 0;
+    deserializer.validateDebuggingInfo(key, "uncompressed_size");
+    deserializer.deserializeValue<uint64_t>(retVal->uncompressedSize);
+    deserializer.validateDebuggingInfo(key, "compressed_size");
+    deserializer.deserializeValue<uint64_t>(compressedSize);
+    retVal->compressedData.resize(compressedSize);
+    deserializer.read(retVal->compressedData.data(), compressedSize);
+    auto uncompressedData = std::make_unique<uint8_t[]>(retVal->uncompressedSize);
+    const auto decompressedSize = lbug_zstd::ZSTD_decompress(uncompressedData.get(),
+        retVal->uncompressedSize, retVal->compressedData.data(), compressedSize);
+    if (lbug_zstd::ZSTD_isError(decompressedSize) ||
+        decompressedSize != retVal->uncompressedSize) {
+        throw RuntimeException("Corrupted wal file. Failed to decompress WAL records.");
+    }
+    // The records were serialized by the local WAL of the transaction, so they carry their own
+    // checksums if checksums are enabled.
+    std::unique_ptr<Reader> reader =
+        std::make_unique<BufferReader>(uncompressedData.get(), retVal->uncompressedSize);
+    if (clientContext.getDBConfig()->enableChecksums) {
+        reader = std::make_unique<ChecksumReader>(std::move(reader),
+            *MemoryManager::Get(clientContext),
+            "Checksum verification failed, the WAL file is corrupted.");
+    }
+    Deserializer recordDeserializer{std::move(reader)};
+    while (!recordDeserializer.finished()) {
+        retVal->records.push_back(WALRecord::deserialize(recordDeserializer, clientContext));
+    }
+    return retVal;
+}
+
 void CheckpointRecord::serialize(Serializer& serializer) const {
     WALRecord::serialize(serializer);
 }
@@ -1,5 +1,11 @@
 #include "storage/wal/wal_replayer.h"
 
+#include <deque>
+#ifndef __SINGLE_THREADED__
+#include <condition_variable>
+#include <thread>
+#endif
+
 #include "binder/binder.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
@@ -82,6 +88,103 @@ static uint64_t getReadOffset(Deserializer& deSer, bool enableChecksums) {
     }
 }
 
+// Decodes WAL records, including checksum verification, ahead of the replay loop so that reading the
+// WAL overlaps with applying its records. At most MAX_NUM_PREFETCHED_RECORDS decoded records are
+// buffered at any time to bound memory usage.
+class WALRecordPrefetcher {
+    static constexpr uint64_t MAX_NUM_PREFETCHED_RECORDS = 16;
+
+public:
+    WALRecordPrefetcher(Deserializer& deserializer, main::ClientContext& clientContext,
+        bool enableChecksums, uint64_t endOffset)
+        : deserializer{deserializer}, clientContext{clientContext},
+          enableChecksums{enableChecksums}, endOffset{endOffset} {
+#ifndef __SINGLE_THREADED__
+        readerThread = std::thread([this] { readRecords(); });
+#endif
+    }
+    DELETE_COPY_AND_MOVE(WALRecordPrefetcher);
+
+    ~WALRecordPrefetcher() {
+#ifndef __SINGLE_THREADED__
+        {
+            std::unique_lock lck{mtx};
+            stopped = true;
+        }
+        cv.notify_all();
+        readerThread.join();
+#endif
+    }
+
+    // Returns nullptr once all records up to the end offset have been returned.
+    std::unique_ptr<WALRecord> next() {
+#ifndef __SINGLE_THREADED__
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return !records.empty() || finished; });
+        if (records.empty()) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return nullptr;
+        }
+        auto record = std::move(records.front());
+        records.pop_front();
+        lck.unlock();
+        cv.notify_all();
+        return record;
+#else
+        if (getReadOffset(deserializer, enableChecksums) >= endOffset) {
+            return nullptr;
+        }
+        return WALRecord::deserialize(deserializer, clientContext);
+#endif
+    }
+
+private:
+#ifndef __SINGLE_THREADED__
+    void readRecords() {
+        try {
+            while (getReadOffset(deserializer, enableChecksums) < endOffset) {
+                KU_ASSERT(!deserializer.finished());
+                auto record = WALRecord::deserialize(deserializer, clientContext);
+                std::unique_lock lck{mtx};
+                cv.wait(lck,
+                    [&] { return records.size() < MAX_NUM_PREFETCHED_RECORDS || stopped; });
+                if (stopped) {
+                    return;
+                }
+                records.push_back(std::move(record));
+                lck.unlock();
+                cv.notify_all();
+            }
+        } catch (...) {
+            std::unique_lock lck{mtx};
+            exception = std::current_exception();
+        }
+        {
+            std::unique_lock lck{mtx};
+            finished = true;
+        }
+        cv.notify_all();
+    }
+#endif
+
+private:
+    Deserializer& deserializer;
+    main::ClientContext& clientContext;
+    bool enableChecksums;
+    uint64_t endOffset;
+#ifndef __SINGLE_THREADED__
+    std::thread readerThread;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<WALRecord>> records;
+    bool finished = false;
+    bool stopped = false;
+    std::exception_ptr exception = nullptr;
+#endif
+};
+
 void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) const {
     auto vfs = VirtualFileSystem::GetUnsafe(clientContext);
     Checkpointer checkpointer(clientContext);
@@ -135,9 +238,9 @@ void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) con
                 deserializer.getReader()->onObjectEnd();
             }
 
-            while (getReadOffset(deserializer, enableChecksums) < offsetDeserialized) {
-                KU_ASSERT(!deserializer.finished());
-                auto walRecord = WALRecord::deserialize(deserializer, clientContext);
+            WALRecordPrefetcher prefetcher{deserializer, clientContext, enableChecksums,
+                offsetDeserialized};
+            while (auto walRecord = prefetcher.next()) {
                 replayWALRecord(*walRecord);
             }
             // After replaying all the records, we should truncate the WAL file to the last
@@ -182,7 +285,8 @@ WALReplayer::WALReplayInfo WALReplayer::dryReplay(FileInfo& fileInfo, bool throw
                 finishedDeserializing = true;
                 offsetDeserialized = getReadOffset(deserializer, enableChecksums);
             } break;
-            case WALRecordType::COMMIT_RECORD: {
+            case WALRecordType::COMMIT_RECORD:
+            case WALRecordType::COMPRESSED_TRANSACTION_RECORD: {
                 // Update the offset to the end of the last commit record.
                 offsetDeserialized = getReadOffset(deserializer, enableChecksums);
             } break;
@@ -209,6 +313,11 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord) const {
     case WALRecordType::COMMIT_RECORD: {
         TransactionContext::Get(clientContext)->commit();
     } break;
+    case WALRecordType::COMPRESSED_TRANSACTION_RECORD: {
+        for (auto& record : walRecord.cast<CompressedTransactionRecord>().records) {
+            replayWALRecord(*record);
+        }
+    } break;
     case WALRecordType::CREATE_CATALOG_ENTRY_RECORD: {
         replayCreateCatalogEntryRecord(walRecord);
     } break;
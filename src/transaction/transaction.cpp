@@ -1,5 +1,7 @@
 #include "transaction/transaction.h"
 
+#include <algorithm>
+
 #include "catalog/catalog.h"
 #include "common/exception/runtime.h"
 #include "main/client_context.h"
@@ -27,6 +29,70 @@ bool LocalCacheManager::put(std::unique_ptr<LocalCacheObject> object) {
     return true;
 }
 
+void WriteSet::insert(common::table_id_t tableID, common::offset_t offset) {
+    std::unique_lock lck{mtx};
+    insertNoLock(tableID, offset);
+}
+
+void WriteSet::insert(common::table_id_t tableID, std::span<const common::offset_t> offsets) {
+    std::unique_lock lck{mtx};
+    for (const auto offset : offsets) {
+        insertNoLock(tableID, offset);
+    }
+}
+
+void WriteSet::insertNoLock(common::table_id_t tableID, common::offset_t offset) {
+    auto& tableRanges = ranges[tableID];
+    if (!tableRanges.empty()) {
+        auto& lastRange = tableRanges.back();
+        if (offset == lastRange.end) {
+            lastRange.end++;
+            return;
+        }
+        if (offset >= lastRange.start && offset < lastRange.end) {
+            return;
+        }
+    }
+    tableRanges.push_back({offset, offset + 1});
+}
+
+void WriteSet::finalize() {
+    for (auto& [tableID, tableRanges] : ranges) {
+        std::ranges::sort(tableRanges, {}, &OffsetRange::start);
+        auto numMergedRanges = 0u;
+        for (const auto& range : tableRanges) {
+            if (numMergedRanges > 0 && range.start <= tableRanges[numMergedRanges - 1].end) {
+                auto& lastRange = tableRanges[numMergedRanges - 1];
+                lastRange.end = std::max(lastRange.end, range.end);
+            } else {
+                tableRanges[numMergedRanges++] = range;
+            }
+        }
+        tableRanges.resize(numMergedRanges);
+    }
+}
+
+bool WriteSet::overlaps(const WriteSet& other) const {
+    for (const auto& [tableID, tableRanges] : ranges) {
+        if (!other.ranges.contains(tableID)) {
+            continue;
+        }
+        // Both lists of ranges are sorted and disjoint, so a single merge pass finds any overlap.
+        const auto& otherRanges = other.ranges.at(tableID);
+        auto i = 0u, j = 0u;
+        while (i < tableRanges.size() && j < otherRanges.size()) {
+            if (tableRanges[i].end <= otherRanges[j].start) {
+                i++;
+            } else if (otherRanges[j].end <= tableRanges[i].start) {
+                j++;
+            } else {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 Transaction::Transaction(main::ClientContext& clientContext, TransactionType transactionType,
     common::transaction_t transactionID, common::transaction_t startTS)
     : type{transactionType}, ID{transactionID}, startTS{startTS},
@@ -37,6 +103,9 @@ Transaction::Transaction(main::ClientContext& clientContext, TransactionType tra
     currentTS = common::Timestamp::getCurrentTimestamp().value;
     localWAL = std::make_unique<storage::LocalWAL>(*storage::MemoryManager::Get(clientContext),
         clientContext.getDBConfig()->enableChecksums);
+    if (clientContext.getDBConfig()->enableMultiWrites) {
+        writeSet = std::make_unique<WriteSet>();
+    }
 }
 
 Transaction::Transaction(TransactionType transactionType) noexcept
@@ -195,10 +264,16 @@ void Transaction::pushDeleteInfo(common::node_group_idx_t nodeGroupIdx, common::
     undoBuffer->createDeleteInfo(nodeGroupIdx, startRow, numRows, versionRecordHandler);
 }
 
-void Transaction::pushVectorUpdateInfo(storage::UpdateInfo& updateInfo,
-    const common::idx_t vectorIdx, storage::VectorUpdateInfo& vectorUpdateInfo,
-    common::transaction_t version) const {
-    undoBuffer->createVectorUpdateInfo(&updateInfo, vectorIdx, &vectorUpdateInfo, version);
+void Transaction::pushVectorUpdateInfo(storage::ColumnChunk& columnChunk,
+    storage::UpdateInfo& updateInfo, const common::idx_t vectorIdx,
+    storage::VectorUpdateInfo& vectorUpdateInfo, common::transaction_t version) const {
+    undoBuffer->createVectorUpdateInfo(&columnChunk, &updateInfo, vectorIdx, &vectorUpdateInfo,
+        version);
+}
+
+void Transaction::collapseCommittedVersions() const {
+    KU_ASSERT(commitTS != common::INVALID_TRANSACTION);
+    undoBuffer->collapseCommittedVersions();
 }
 
 Transaction::~Transaction() = default;
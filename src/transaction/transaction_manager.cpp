@@ -19,6 +19,11 @@ namespace transaction {
 
 Transaction* TransactionManager::beginTransaction(main::ClientContext& clientContext,
     TransactionType type) {
+    if (type == TransactionType::WRITE) {
+        // Readers never wait for a deferred checkpoint. They cannot add to the work it has to do,
+        // and holding them back would let one long-running transaction block every read query.
+        waitForDeferredCheckpoint();
+    }
     // We acquire the lock for starting new transactions. In case this cannot be acquired, this
     // ensures calls to other public functions are not restricted.
     std::unique_lock publicFunctionLck{mtxForSerializingPublicFunctionCalls};
@@ -59,17 +64,36 @@ void TransactionManager::commit(main::ClientContext& clientContext, Transaction*
     switch (transaction->getType()) {
     case TransactionType::READ_ONLY: {
         clearTransactionNoLock(transaction->getID());
+        tryCheckpointIfPendingNoLock(clientContext);
     } break;
     case TransactionType::RECOVERY:
     case TransactionType::WRITE: {
+        validateWriteSetNoLock(*transaction);
         lastTimestamp++;
         transaction->commitTS = lastTimestamp;
         transaction->commit(&wal);
-        auto shouldCheckpoint = transaction->shouldForceCheckpoint() ||
-                                Checkpointer::canAutoCheckpoint(clientContext, *transaction);
+        if (activeTransactions.size() == 1) {
+            // New transactions cannot start while we hold the lock, so no transaction will ever
+            // read the versions this one replaced.
+            transaction->collapseCommittedVersions();
+        }
+        auto shouldForceCheckpoint = transaction->shouldForceCheckpoint();
+        auto shouldAutoCheckpoint = !shouldForceCheckpoint &&
+                                    Checkpointer::canAutoCheckpoint(clientContext, *transaction);
+        addCommittedWriteSetNoLock(*transaction);
         clearTransactionNoLock(transaction->getID());
-        if (shouldCheckpoint) {
+        if (shouldForceCheckpoint) {
             checkpointNoLock(clientContext);
+        } else if (shouldAutoCheckpoint || hasPendingAutoCheckpoint) {
+            // Auto checkpoints never wait for other transactions to leave. If any are active, the
+            // checkpoint is deferred to the last of them instead of stalling the whole system.
+            // A pending checkpoint that failed when a reader left is retried here, so that its
+            // failure is reported to a transaction that wrote data.
+            hasPendingAutoCheckpoint = true;
+            if (shouldAutoCheckpoint && !hasNoActiveTransactions()) {
+                numDeferredAutoCheckpoints++;
+            }
+            checkpointIfPendingNoLock(clientContext);
         }
     } break;
         // LCOV_EXCL_START
@@ -99,6 +123,8 @@ void TransactionManager::rollback(main::ClientContext& clientContext, Transactio
         throw TransactionManagerException("Invalid transaction type to rollback.");
     }
     }
+    // The last transaction to leave runs a deferred checkpoint, whether it commits or not.
+    tryCheckpointIfPendingNoLock(clientContext);
 }
 
 void TransactionManager::checkpoint(main::ClientContext& clientContext) {
@@ -137,6 +163,29 @@ UniqLock TransactionManager::stopNewTransactionsAndWaitUntilAllTransactionsLeave
     return startTransactionLock;
 }
 
+void TransactionManager::waitForDeferredCheckpoint() {
+    uint64_t numTimesWaited = 0;
+    while (true) {
+        {
+            std::unique_lock lck{mtxForSerializingPublicFunctionCalls};
+            if (!hasPendingAutoCheckpoint ||
+                numDeferredAutoCheckpoints < MAX_DEFERRED_AUTO_CHECKPOINTS) {
+                return;
+            }
+        }
+        numTimesWaited++;
+        if (numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
+            checkpointWaitTimeoutInMicros) {
+            throw TransactionManagerException(
+                "Timeout waiting for active transactions to leave the system before running a "
+                "deferred checkpoint. If you have an open transaction, please close it and try "
+                "again.");
+        }
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+    }
+}
+
 bool TransactionManager::hasNoActiveTransactions() const {
     return activeTransactions.empty();
 }
@@ -146,6 +195,51 @@ bool TransactionManager::hasActiveWriteTransactionNoLock() const {
         [](const auto& transaction) { return transaction->isWriteTransaction(); });
 }
 
+void TransactionManager::validateWriteSetNoLock(Transaction& transaction) const {
+    if (!transaction.writeSet || transaction.writeSet->empty()) {
+        return;
+    }
+    // The write set is complete once the transaction commits. A committed write set is only kept
+    // if the transaction passes validation, so it is finalized exactly once as well.
+    transaction.writeSet->finalize();
+    for (const auto& [commitTS, committedWriteSet] : committedWriteSets) {
+        if (commitTS > transaction.getStartTS() &&
+            transaction.writeSet->overlaps(*committedWriteSet)) {
+            throw TransactionManagerException(
+                "Write-write conflict: the transaction updated or deleted rows that were also "
+                "updated or deleted by a concurrent transaction which committed first. The "
+                "transaction is rolled back.");
+        }
+    }
+}
+
+void TransactionManager::addCommittedWriteSetNoLock(Transaction& transaction) {
+    if (!transaction.writeSet || transaction.writeSet->empty() ||
+        !std::ranges::any_of(activeTransactions, [&](const auto& activeTransaction) {
+            return activeTransaction.get() != &transaction &&
+                   activeTransaction->isWriteTransaction();
+        })) {
+        return;
+    }
+    committedWriteSets.emplace_back(transaction.getCommitTS(), std::move(transaction.writeSet));
+}
+
+void TransactionManager::pruneCommittedWriteSetsNoLock() {
+    if (committedWriteSets.empty()) {
+        return;
+    }
+    // A committed write set is only needed to validate write transactions that started before it
+    // committed.
+    auto minStartTS = INVALID_TRANSACTION;
+    for (const auto& activeTransaction : activeTransactions) {
+        if (activeTransaction->isWriteTransaction()) {
+            minStartTS = std::min(minStartTS, activeTransaction->getStartTS());
+        }
+    }
+    std::erase_if(committedWriteSets,
+        [minStartTS](const auto& entry) { return entry.first <= minStartTS; });
+}
+
 void TransactionManager::clearTransactionNoLock(transaction_t transactionID) {
     KU_ASSERT(std::ranges::any_of(activeTransactions.begin(), activeTransactions.end(),
         [transactionID](const auto& activeTransaction) {
@@ -154,6 +248,7 @@ void TransactionManager::clearTransactionNoLock(transaction_t transactionID) {
     std::erase_if(activeTransactions, [transactionID](const auto& activeTransaction) {
         return activeTransaction->getID() == transactionID;
     });
+    pruneCommittedWriteSetsNoLock();
 }
 
 std::unique_ptr<Checkpointer> TransactionManager::initCheckpointer(
@@ -161,6 +256,26 @@ std::unique_ptr<Checkpointer> TransactionManager::initCheckpointer(
     return std::make_unique<Checkpointer>(clientContext);
 }
 
+void TransactionManager::checkpointIfPendingNoLock(main::ClientContext& clientContext) {
+    if (!hasPendingAutoCheckpoint || !hasNoActiveTransactions()) {
+        return;
+    }
+    checkpointNoLock(clientContext);
+}
+
+void TransactionManager::tryCheckpointIfPendingNoLock(main::ClientContext& clientContext) {
+    try {
+        checkpointIfPendingNoLock(clientContext);
+    } catch (CheckpointException&) {
+        // The transaction leaving wrote nothing, so the failure is not its error to report. The
+        // checkpoint stays pending and is retried by the next write transaction to commit, which
+        // gets the error if it fails again. The deferral count starts over so that new write
+        // transactions are not held back by a checkpoint that cannot run.
+        hasPendingAutoCheckpoint = true;
+        numDeferredAutoCheckpoints = 0;
+    }
+}
+
 void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     // Note: It is enough to stop and wait for transactions to leave the system instead of, for
     // example, checking on the query processor's task scheduler. This is because the
@@ -174,6 +289,10 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     } catch (std::exception& e) {
         throw CheckpointException{e};
     }
+    // Any deferred auto checkpoint is covered by this one. If this checkpoint fails, the next
+    // commit that crosses the threshold will request a new one.
+    hasPendingAutoCheckpoint = false;
+    numDeferredAutoCheckpoints = 0;
     auto checkpointer = initCheckpointerFunc(clientContext);
     try {
         checkpointer->writeCheckpoint();
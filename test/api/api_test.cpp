@@ -564,3 +564,73 @@ TEST_F(ApiTest, DBFileUnderNonExistingDir) {
     // Attempt to open the database with the empty file.
     ASSERT_THROW(std::make_unique<Database>(databasePath, *systemConfig), IOException);
 }
+
+#ifndef __SINGLE_THREADED__
+TEST_F(ApiTest, StreamQueryResult) {
+    auto query = "UNWIND RANGE(1, 10000) AS x RETURN x, x * 2";
+    auto expected = conn->query(query);
+    auto result = conn->queryAsStream(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getType(), QueryResultType::STREAMING);
+    ASSERT_EQ(result->getNumColumns(), 2);
+    auto numTuples = 0u;
+    int64_t sum = 0;
+    while (result->hasNext()) {
+        auto tuple = result->getNext();
+        sum += tuple->getValue(0)->getValue<int64_t>();
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(),
+            2 * tuple->getValue(0)->getValue<int64_t>());
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, expected->getNumTuples());
+    ASSERT_EQ(sum, 10000 * 10001 / 2);
+    ASSERT_THROW(result->getNumTuples(), Exception);
+    assertMatchPersonCountStar(conn.get());
+}
+
+TEST_F(ApiTest, StreamQueryResultClosedByNextQuery) {
+    auto result = conn->queryAsStream("UNWIND RANGE(1, 100000) AS x RETURN x");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    // The producer is blocked on the full queue. The next query stops it.
+    assertMatchPersonCountStar(conn.get());
+    ASSERT_THROW(result->hasNext(), Exception);
+}
+
+TEST_F(ApiTest, StreamQueryResultDropped) {
+    for (auto i = 0u; i < 10; ++i) {
+        auto result = conn->queryAsStream("UNWIND RANGE(1, 100000) AS x RETURN x");
+        ASSERT_TRUE(result->hasNext());
+    }
+    assertMatchPersonCountStar(conn.get());
+}
+
+TEST_F(ApiTest, StreamQueryResultDoesNotHoldWorkers) {
+    auto query = "MATCH (a:person), (b:person), (c:person), (d:person), (e:person) RETURN a.ID, "
+                 "b.ID, c.ID, d.ID, e.ID";
+    ASSERT_TRUE(conn->query("CALL threads=8")->isSuccess());
+    auto expected = conn->query(query);
+    auto result = conn->queryAsStream(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_TRUE(result->hasNext());
+    // The root pipeline blocks on the full queue without holding on to the scheduler's workers.
+    auto otherConn = std::make_unique<Connection>(database.get());
+    for (auto i = 0u; i < 10; ++i) {
+        assertMatchPersonCountStar(otherConn.get());
+    }
+    auto numTuples = 0u;
+    while (result->hasNext()) {
+        result->getNext();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, expected->getNumTuples());
+}
+
+TEST_F(ApiTest, StreamWriteQueryIsMaterialized) {
+    auto result = conn->queryAsStream("CREATE (:person {ID: 100}) RETURN 1");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getType(), QueryResultType::FTABLE);
+    ASSERT_EQ(result->getNumTuples(), 1);
+}
+#endif
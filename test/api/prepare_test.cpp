@@ -1,3 +1,5 @@
+#include <thread>
+
 #include "api_test/api_test.h"
 
 using namespace lbug::common;
@@ -7,6 +9,15 @@ static void checkTuple(lbug::processor::FlatTuple* tuple, const std::string& gro
     ASSERT_STREQ(tuple->toString().c_str(), groundTruth.c_str());
 }
 
+// Returns the plan cache hits and misses reported by query_cache_info(). Table function calls are
+// never cached, so each call also counts as a miss itself.
+static std::pair<uint64_t, uint64_t> getPlanCacheHitsAndMisses(lbug::main::Connection& conn) {
+    auto result = conn.query("CALL query_cache_info() RETURN num_hits, num_misses");
+    EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    auto tuple = result->getNext();
+    return {tuple->getValue(0)->getValue<uint64_t>(), tuple->getValue(1)->getValue<uint64_t>()};
+}
+
 TEST_F(ApiTest, issueTest1) {
     conn->query("CREATE NODE TABLE T(id SERIAL, name STRING, PRIMARY KEY(id));");
     conn->query("CREATE (t:T {name: \"foo\"});");
@@ -258,3 +269,143 @@ TEST_F(ApiTest, ParameterWith) {
     auto groupTruth = std::vector<std::string>{"abc"};
     ASSERT_EQ(groupTruth, TestHelper::convertResultToString(*result));
 }
+
+TEST_F(ApiTest, ReusePlanWithDifferentParameters) {
+    auto preparedStatement =
+        conn->prepare("MATCH (a:person) WHERE a.ID = $id RETURN a.fName ORDER BY a.ID LIMIT $k");
+    auto result = conn->execute(preparedStatement.get(),
+        std::make_pair(std::string("id"), (int64_t)0), std::make_pair(std::string("k"), 1));
+    ASSERT_EQ(std::vector<std::string>{"Alice"}, TestHelper::convertResultToString(*result));
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), (int64_t)2),
+        std::make_pair(std::string("k"), 1));
+    ASSERT_EQ(std::vector<std::string>{"Bob"}, TestHelper::convertResultToString(*result));
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), (int64_t)3),
+        std::make_pair(std::string("k"), 0));
+    ASSERT_TRUE(TestHelper::convertResultToString(*result).empty());
+}
+
+TEST_F(ApiTest, ReusePlanInvalidatedByCatalogChange) {
+    auto preparedStatement = conn->prepare("MATCH (a:person) WHERE a.ID = $id RETURN a.fName");
+    auto result =
+        conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), (int64_t)0));
+    ASSERT_EQ(std::vector<std::string>{"Alice"}, TestHelper::convertResultToString(*result));
+    ASSERT_TRUE(conn->query("ALTER TABLE person DROP fName")->isSuccess());
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), (int64_t)0));
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_TRUE(conn->query("ALTER TABLE person ADD fName STRING DEFAULT 'x'")->isSuccess());
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), (int64_t)2));
+    ASSERT_EQ(std::vector<std::string>{"x"}, TestHelper::convertResultToString(*result));
+}
+
+TEST_F(ApiTest, ReusePlanReadsCurrentTransaction) {
+    ASSERT_TRUE(conn->query("CREATE SEQUENCE seq")->isSuccess());
+    ASSERT_TRUE(conn->query("RETURN nextval('seq')")->isSuccess());
+    auto preparedStatement = conn->prepare("RETURN currval('seq'), current_timestamp()");
+    ASSERT_TRUE(preparedStatement->isSuccess());
+    auto result = conn->execute(preparedStatement.get());
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 1);
+    auto timestamp = tuple->getValue(1)->getValue<timestamp_tz_t>();
+    // Each execution runs in its own transaction, so the reused plan must not return the values
+    // seen when the statement was compiled.
+    ASSERT_TRUE(conn->query("RETURN nextval('seq')")->isSuccess());
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    result = conn->execute(preparedStatement.get());
+    tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 2);
+    ASSERT_GT(tuple->getValue(1)->getValue<timestamp_tz_t>().value, timestamp.value);
+}
+
+TEST_F(ApiTest, ReusePlanCountsPlanCacheHits) {
+    auto preparedStatement = conn->prepare("MATCH (a:person) WHERE a.age > $age RETURN COUNT(*)");
+    auto [numHits, numMisses] = getPlanCacheHitsAndMisses(*conn);
+    // The parameter type is unknown when preparing, so the first execution plans the statement.
+    // Later executions substitute their parameter values into that plan.
+    auto expectedCounts =
+        std::vector<std::pair<int64_t, std::string>>{{30, "4"}, {40, "2"}, {80, "1"}};
+    for (auto& [age, count] : expectedCounts) {
+        auto result =
+            conn->execute(preparedStatement.get(), std::make_pair(std::string("age"), age));
+        ASSERT_EQ(std::vector<std::string>{count}, TestHelper::convertResultToString(*result));
+    }
+    auto [newNumHits, newNumMisses] = getPlanCacheHitsAndMisses(*conn);
+    ASSERT_EQ(newNumHits, numHits + 2);
+    ASSERT_EQ(newNumMisses, numMisses + 2);
+    // A catalog change invalidates the plan, so the next execution re-plans the statement.
+    ASSERT_TRUE(conn->query("ALTER TABLE person ADD extra INT64")->isSuccess());
+    auto result = conn->execute(preparedStatement.get(),
+        std::make_pair(std::string("age"), static_cast<int64_t>(30)));
+    ASSERT_EQ(std::vector<std::string>{"4"}, TestHelper::convertResultToString(*result));
+    std::tie(numHits, numMisses) = getPlanCacheHitsAndMisses(*conn);
+    ASSERT_EQ(numHits, newNumHits);
+    ASSERT_EQ(numMisses, newNumMisses + 3);
+}
+
+TEST_F(ApiTest, QueryCacheCountsRepeatedQueries) {
+    auto query = "MATCH (a:person) WHERE a.age > 30 RETURN COUNT(*)";
+    auto [numHits, numMisses] = getPlanCacheHitsAndMisses(*conn);
+    // The first run compiles and caches the query. Repeated runs of the same text reuse its plan.
+    for (auto i = 0u; i < 3; i++) {
+        auto result = conn->query(query);
+        ASSERT_EQ(std::vector<std::string>{"4"}, TestHelper::convertResultToString(*result));
+    }
+    auto [newNumHits, newNumMisses] = getPlanCacheHitsAndMisses(*conn);
+    ASSERT_EQ(newNumHits, numHits + 2);
+    ASSERT_EQ(newNumMisses, numMisses + 2);
+    // A catalog change makes the cached plan stale, so the next run compiles the query again.
+    ASSERT_TRUE(conn->query("ALTER TABLE person ADD extra INT64")->isSuccess());
+    for (auto i = 0u; i < 2; i++) {
+        auto result = conn->query(query);
+        ASSERT_EQ(std::vector<std::string>{"4"}, TestHelper::convertResultToString(*result));
+    }
+    std::tie(numHits, numMisses) = getPlanCacheHitsAndMisses(*conn);
+    ASSERT_EQ(numHits, newNumHits + 1);
+    ASSERT_EQ(numMisses, newNumMisses + 3);
+}
+
+TEST_F(ApiTest, QueryCacheSharesPlansAcrossPredicateLiterals) {
+    auto [numHits, numMisses] = getPlanCacheHitsAndMisses(*conn);
+    // The literals of the WHERE clause are replaced by parameters, so all three queries run the
+    // plan compiled for the first one.
+    auto expectedCounts = std::vector<std::pair<std::string, std::string>>{
+        {"30", "4"}, {"40", "2"}, {"80", "1"}};
+    for (auto& [age, count] : expectedCounts) {
+        auto result =
+            conn->query("MATCH (a:person) WHERE a.age > " + age + " RETURN COUNT(*)");
+        ASSERT_EQ(std::vector<std::string>{count}, TestHelper::convertResultToString(*result));
+    }
+    auto result = conn->query("MATCH (a:person) WHERE a.fName = 'Alice' RETURN a.ID");
+    ASSERT_EQ(std::vector<std::string>{"0"}, TestHelper::convertResultToString(*result));
+    result = conn->query("MATCH (a:person) WHERE a.fName = 'Bob' RETURN a.ID");
+    ASSERT_EQ(std::vector<std::string>{"2"}, TestHelper::convertResultToString(*result));
+    // Literals outside WHERE can name result columns, so they stay part of the cached text.
+    result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.age + 1");
+    ASSERT_EQ(std::vector<std::string>{"36"}, TestHelper::convertResultToString(*result));
+    result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.age + 2");
+    ASSERT_EQ(std::vector<std::string>{"37"}, TestHelper::convertResultToString(*result));
+    auto [newNumHits, newNumMisses] = getPlanCacheHitsAndMisses(*conn);
+    ASSERT_EQ(newNumHits, numHits + 3);
+    ASSERT_EQ(newNumMisses, numMisses + 5);
+}
+
+TEST_F(ApiTest, QueryCacheReadsCurrentTransaction) {
+    auto query = "RETURN current_timestamp()";
+    auto result = conn->query(query);
+    auto timestamp = result->getNext()->getValue(0)->getValue<timestamp_tz_t>();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    // The second run reuses the cached plan, which must still read its own transaction.
+    result = conn->query(query);
+    ASSERT_GT(result->getNext()->getValue(0)->getValue<timestamp_tz_t>().value, timestamp.value);
+}
+
+TEST_F(ApiTest, QueryCacheSizeChangeKeepsPlans) {
+    auto query = "MATCH (a:person) RETURN COUNT(*)";
+    ASSERT_TRUE(conn->query(query)->isSuccess());
+    ASSERT_TRUE(conn->query("CALL query_cache_size=16")->isSuccess());
+    auto [numHits, numMisses] = getPlanCacheHitsAndMisses(*conn);
+    // The cache size is not part of the configuration a plan is compiled against.
+    ASSERT_TRUE(conn->query(query)->isSuccess());
+    auto [newNumHits, newNumMisses] = getPlanCacheHitsAndMisses(*conn);
+    ASSERT_EQ(newNumHits, numHits + 1);
+    ASSERT_EQ(newNumMisses, numMisses + 1);
+}
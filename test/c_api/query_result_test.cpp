@@ -274,3 +274,52 @@ TEST_F(CApiQueryResultTest, MultipleQuery) {
 
     lbug_query_result_destroy(&result);
 }
+
+#ifndef __SINGLE_THREADED__
+// Streaming results are materialized in single-threaded mode.
+TEST_F(CApiQueryResultTest, StreamQueryResult) {
+    lbug_query_result result;
+    auto connection = getConnection();
+    auto state = lbug_connection_query_as_stream(connection,
+        "UNWIND RANGE(1, 10000) AS x RETURN x", &result);
+    ASSERT_EQ(state, LbugSuccess);
+    int64_t sum = 0;
+    while (lbug_query_result_has_next(&result)) {
+        lbug_flat_tuple tuple;
+        ASSERT_EQ(lbug_query_result_get_next(&result, &tuple), LbugSuccess);
+        lbug_value value;
+        ASSERT_EQ(lbug_flat_tuple_get_value(&tuple, 0, &value), LbugSuccess);
+        int64_t x = 0;
+        ASSERT_EQ(lbug_value_get_int64(&value, &x), LbugSuccess);
+        sum += x;
+        lbug_value_destroy(&value);
+        lbug_flat_tuple_destroy(&tuple);
+    }
+    ASSERT_TRUE(lbug_query_result_is_success(&result));
+    ASSERT_EQ(sum, 10000 * 10001 / 2);
+    lbug_query_result_destroy(&result);
+}
+
+TEST_F(CApiQueryResultTest, StreamQueryResultError) {
+    lbug_query_result result;
+    auto connection = getConnection();
+    // The error is raised only after the first tuples have been streamed.
+    auto state = lbug_connection_query_as_stream(connection,
+        "UNWIND RANGE(1, 100000) AS x RETURN 1 / (x - 50000)", &result);
+    ASSERT_EQ(state, LbugSuccess);
+    ASSERT_TRUE(lbug_query_result_is_success(&result));
+    auto numTuples = 0u;
+    while (lbug_query_result_has_next(&result)) {
+        lbug_flat_tuple tuple;
+        ASSERT_EQ(lbug_query_result_get_next(&result, &tuple), LbugSuccess);
+        lbug_flat_tuple_destroy(&tuple);
+        numTuples++;
+    }
+    ASSERT_LT(numTuples, 50000u);
+    ASSERT_FALSE(lbug_query_result_is_success(&result));
+    auto errorMessage = lbug_query_result_get_error_message(&result);
+    ASSERT_EQ(std::string(errorMessage), "Runtime exception: Divide by zero.");
+    lbug_destroy_string(errorMessage);
+    lbug_query_result_destroy(&result);
+}
+#endif
@@ -0,0 +1,75 @@
+#include "common/task_system/task.h"
+#include "gtest/gtest.h"
+
+using namespace lbug::common;
+
+class CountingTask final : public Task {
+public:
+    explicit CountingTask(uint64_t maxNumThreads) : Task{maxNumThreads} {}
+
+    void run() override {}
+    void finalize() override { numFinalized++; }
+
+    uint64_t numFinalized = 0;
+};
+
+TEST(TaskTests, FinishedThreadStopsRegistration) {
+    CountingTask task{4};
+    ASSERT_TRUE(task.registerThread());
+    ASSERT_TRUE(task.registerThread());
+    ASSERT_FALSE(task.deRegisterThreadAndFinalizeTask());
+    // The work of the task is drained once a thread finished.
+    ASSERT_FALSE(task.registerThread());
+    ASSERT_TRUE(task.deRegisterThreadAndFinalizeTask());
+    ASSERT_TRUE(task.isCompletedSuccessfully());
+    ASSERT_EQ(task.numFinalized, 1u);
+}
+
+TEST(TaskTests, YieldedThreadCanRegisterAgain) {
+    CountingTask task{4};
+    ASSERT_TRUE(task.registerThread());
+    ASSERT_TRUE(task.registerThread());
+    ASSERT_TRUE(task.tryYieldThread());
+    // The other thread is the last one working on the task.
+    ASSERT_FALSE(task.tryYieldThread());
+    ASSERT_FALSE(task.deRegisterThreadAndFinalizeTask(true /* yielded */));
+    ASSERT_FALSE(task.tryYieldThread());
+    ASSERT_TRUE(task.registerThread());
+    ASSERT_FALSE(task.deRegisterThreadAndFinalizeTask());
+    ASSERT_TRUE(task.deRegisterThreadAndFinalizeTask());
+    ASSERT_TRUE(task.isCompletedSuccessfully());
+    ASSERT_EQ(task.numFinalized, 1u);
+}
+
+TEST(TaskTests, YieldedThreadCompletesTask) {
+    CountingTask task{4};
+    ASSERT_TRUE(task.registerThread());
+    ASSERT_TRUE(task.registerThread());
+    ASSERT_TRUE(task.tryYieldThread());
+    ASSERT_FALSE(task.deRegisterThreadAndFinalizeTask());
+    ASSERT_EQ(task.numFinalized, 0u);
+    ASSERT_TRUE(task.deRegisterThreadAndFinalizeTask(true /* yielded */));
+    ASSERT_TRUE(task.isCompletedSuccessfully());
+    ASSERT_EQ(task.numFinalized, 1u);
+}
+
+TEST(TaskTests, ThreadLimitIsSharedByTasks) {
+    ThreadLimit limit{2};
+    CountingTask first{4};
+    CountingTask second{4};
+    first.setThreadLimit(&limit);
+    second.setThreadLimit(&limit);
+    ASSERT_TRUE(first.registerThread());
+    ASSERT_TRUE(second.registerThread());
+    ASSERT_TRUE(second.isThreadLimitReached());
+    ASSERT_FALSE(first.registerThread());
+    ASSERT_FALSE(second.registerThread());
+    // A thread that finished its task gives its share of the limit back.
+    ASSERT_TRUE(first.deRegisterThreadAndFinalizeTask());
+    ASSERT_FALSE(second.isThreadLimitReached());
+    ASSERT_FALSE(first.registerThread());
+    ASSERT_TRUE(second.registerThread());
+    ASSERT_FALSE(second.deRegisterThreadAndFinalizeTask());
+    ASSERT_TRUE(second.deRegisterThreadAndFinalizeTask());
+    ASSERT_TRUE(second.isCompletedSuccessfully());
+}
@@ -1,3 +1,7 @@
+#include <optional>
+#include <sstream>
+
+#include "common/system_config.h"
 #include "graph_test/private_graph_test.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/operator/scan/logical_count_rel_table.h"
@@ -19,6 +23,48 @@ public:
         return TestRunner::getLogicalPlan(query, *conn);
     }
 
+    // Returns the number of tuples output by the scan of `alias` in the PROFILE output of `query`.
+    // Operator boxes are centered in their column, so the attribute of the scan is the first one
+    // below its alias that is centered at the same position.
+    uint64_t getNumScannedTuples(const std::string& query, const std::string& alias) {
+        auto result = conn->query("PROFILE " + query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        std::istringstream profile{result->getNext()->getValue(0)->getValue<std::string>()};
+        const auto aliasText = " Alias: " + alias + " ";
+        const std::string attributeName = "NumOutputTuples: ";
+        std::optional<uint64_t> aliasCenter;
+        std::string line;
+        while (std::getline(profile, line)) {
+            if (!aliasCenter) {
+                if (const auto pos = line.find(aliasText); pos != std::string::npos) {
+                    aliasCenter = getDoubledCenter(line, pos + 1, aliasText.size() - 2);
+                }
+                continue;
+            }
+            for (auto pos = line.find(attributeName); pos != std::string::npos;
+                 pos = line.find(attributeName, pos + 1)) {
+                const auto end = line.find(' ', pos + attributeName.size());
+                const auto center = getDoubledCenter(line, pos, end - pos);
+                if (center + 2 >= *aliasCenter && center <= *aliasCenter + 2) {
+                    return std::stoull(line.substr(pos + attributeName.size(),
+                        end - pos - attributeName.size()));
+                }
+            }
+        }
+        ADD_FAILURE() << "No scan of " << alias << " in the profile of " << query;
+        return 0;
+    }
+
+    // Twice the center of `length` ASCII characters starting at byte `pos` of `line`. Positions are
+    // counted in code points since box frames are multi-byte characters.
+    static uint64_t getDoubledCenter(const std::string& line, size_t pos, size_t length) {
+        uint64_t start = 0;
+        for (auto i = 0u; i < pos; i++) {
+            start += (static_cast<uint8_t>(line[i]) & 0xC0) != 0x80;
+        }
+        return 2 * start + length;
+    }
+
     // Helper to check if a specific operator type exists in the plan
     static bool hasOperatorType(planner::LogicalOperator* op, planner::LogicalOperatorType type) {
         if (op->getOperatorType() == type) {
@@ -257,5 +303,38 @@ TEST_F(OptimizerTest, CountRelTableOptimizer) {
         planner::LogicalOperatorType::COUNT_REL_TABLE));
 }
 
+TEST_F(OptimizerTest, BloomFilterGenericHashJoin) {
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE T(id INT64, v INT64, PRIMARY KEY(id));")->isSuccess());
+    ASSERT_TRUE(
+        conn->query("COPY T FROM (UNWIND range(0, 99999) AS i RETURN i, i % 1000);")->isSuccess());
+    // Only 1% of the tuples of `a` match one of the 1000 build keys. The Bloom filter of the build
+    // keys drops most of the others in the scan of `a`, up to false positives.
+    auto query = "MATCH (a:T), (b:T) WHERE a.v = b.id AND b.id % 100 = 7 RETURN COUNT(*)";
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1000);
+    ASSERT_LT(getNumScannedTuples(query, "a"), 10000u);
+}
+
+TEST_F(OptimizerTest, TopKDynamicZoneMapFilter) {
+    // A single thread scans the node groups in order, so the bound is set before the later ones.
+    ASSERT_TRUE(conn->query("CALL threads=1")->isSuccess());
+    const auto numRows = 3 * common::StorageConfig::NODE_GROUP_SIZE;
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE TopKTs(id INT64, ts INT64, PRIMARY KEY(id));")->isSuccess());
+    ASSERT_TRUE(conn->query("COPY TopKTs FROM (UNWIND range(0, " + std::to_string(numRows - 1) +
+                            ") AS i RETURN i, CASE WHEN i = 5 THEN NULL ELSE " +
+                            std::to_string(numRows - 1) + " - i END);")
+                    ->isSuccess());
+    // The first node group holds the largest values and the only null. Once the heap is reduced,
+    // the other node groups are below the bound of the descending order and are skipped.
+    auto query = "MATCH (t:TopKTs) RETURN t.id, t.ts ORDER BY t.ts DESC LIMIT 5";
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNumTuples(), 5u);
+    ASSERT_LT(getNumScannedTuples(query, "t"), numRows);
+}
+
 } // namespace testing
 } // namespace lbug
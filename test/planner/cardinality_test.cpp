@@ -1,4 +1,7 @@
 #include "graph_test/private_graph_test.h"
+#include "main/client_context.h"
+#include "main/prepared_statement.h"
+#include "main/prepared_statement_manager.h"
 #include "planner/operator/logical_plan_util.h"
 #include "test_runner/test_runner.h"
 #include <format>
@@ -35,6 +38,22 @@ public:
         }
         return getOpWithType(op->getChild(0).get(), type);
     }
+
+    // The predicates y.a = 0 AND y.b = 0 AND y.c = 0 are correlated, so the planner underestimates
+    // their matches by a factor of 100. All rels end in these matches.
+    void createMisestimatedGraph() {
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE RN(id INT64, a INT64, b INT64, c INT64, "
+                                "PRIMARY KEY(id));")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE RE(FROM RN TO RN);")->isSuccess());
+        ASSERT_TRUE(conn->query("COPY RN FROM (UNWIND range(0, 199999) AS i RETURN i, i % 10, "
+                                "i % 10, i % 10);")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("COPY RE FROM (UNWIND range(0, 199999) AS i RETURN i, "
+                                "(i % 20000) * 10);")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("CALL reoptimization_threshold=10")->isSuccess());
+    }
 };
 
 TEST_F(CardinalityTest, TestOperators) {
@@ -151,5 +170,51 @@ TEST_F(CardinalityTest, TestPopulatedAfterOptimizations) {
     checkFunc(plan->getLastOperator().get());
 }
 
+TEST_F(CardinalityTest, TestReoptimizeWithObservedCardinality) {
+    createMisestimatedGraph();
+    auto preparedStatement =
+        conn->prepare("MATCH (x:RN)-[:RE]->(y:RN) WHERE y.a = 0 AND y.b = 0 AND y.c = 0 "
+                      "RETURN COUNT(*), SUM(x.id)");
+    ASSERT_TRUE(preparedStatement->isSuccess());
+    auto cachedStatement =
+        conn->getClientContext()->getCachedPreparedStatementManager().getCachedStatement(
+            preparedStatement->getName());
+    auto planBefore = planner::LogicalPlanUtil::encodeJoin(*cachedStatement->logicalPlan);
+    auto result = conn->execute(preparedStatement.get());
+    ASSERT_TRUE(result->isSuccess());
+    auto tuple = result->getNext();
+    EXPECT_EQ(200000, tuple->getValue(0)->getValue<int64_t>());
+    EXPECT_EQ(19999900000, tuple->getValue(1)->getValue<int64_t>());
+    // The matches of y are underestimated by a factor of 100, so the executed plan differs from the
+    // one chosen when the statement was prepared, and is kept for later executions.
+    auto planAfter = planner::LogicalPlanUtil::encodeJoin(*cachedStatement->logicalPlan);
+    EXPECT_NE(planBefore, planAfter);
+}
+
+TEST_F(CardinalityTest, TestReoptimizeParameterizedStatement) {
+    createMisestimatedGraph();
+    auto preparedStatement =
+        conn->prepare("MATCH (x:RN)-[:RE]->(y:RN) WHERE y.a = $v AND y.b = $v AND y.c = $v "
+                      "RETURN COUNT(*), SUM(x.id)");
+    ASSERT_TRUE(preparedStatement->isSuccess());
+    auto cachedStatement =
+        conn->getClientContext()->getCachedPreparedStatementManager().getCachedStatement(
+            preparedStatement->getName());
+    auto planBefore = planner::LogicalPlanUtil::encodeJoin(*cachedStatement->logicalPlan);
+    auto result =
+        conn->execute(preparedStatement.get(), std::make_pair(std::string{"v"}, int64_t{0}));
+    ASSERT_TRUE(result->isSuccess());
+    auto tuple = result->getNext();
+    EXPECT_EQ(200000, tuple->getValue(0)->getValue<int64_t>());
+    EXPECT_EQ(19999900000, tuple->getValue(1)->getValue<int64_t>());
+    // The re-plan was based on the matches of the value 0, so the prepared plan is kept for other
+    // values.
+    auto planAfter = planner::LogicalPlanUtil::encodeJoin(*cachedStatement->logicalPlan);
+    EXPECT_EQ(planBefore, planAfter);
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string{"v"}, int64_t{1}));
+    ASSERT_TRUE(result->isSuccess());
+    EXPECT_EQ(0, result->getNext()->getValue(0)->getValue<int64_t>());
+}
+
 } // namespace testing
 } // namespace lbug
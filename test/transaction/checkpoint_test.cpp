@@ -74,6 +74,37 @@ TEST_F(FlakyCheckpointerTest, RecoverFromCheckpointStorageFailure) {
     runTest(flakyCheckpointer);
 }
 
+// A deferred auto checkpoint that fails when a read-only transaction leaves is not reported to that
+// transaction. It stays pending and is reported to the next write transaction that commits.
+TEST_F(FlakyCheckpointerTest, ReportDeferredCheckpointFailureToNextWriter) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    conn->query("CALL force_checkpoint_on_close=false;");
+    ASSERT_TRUE(conn->query("CALL auto_checkpoint=true")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL checkpoint_threshold=0")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY);")->isSuccess());
+    auto readConn = std::make_unique<main::Connection>(database.get());
+    ASSERT_TRUE(readConn->query("BEGIN TRANSACTION READ ONLY;")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (a:test {id: 0});")->isSuccess());
+    FlakyCheckpointer flakyCheckpointer([](main::ClientContext& context) {
+        return std::make_unique<FlakyCheckpointerFailsOnCheckpointStorage>(context);
+    });
+    flakyCheckpointer.setCheckpointer(*getClientContext(*conn));
+    ASSERT_TRUE(readConn->query("COMMIT;")->isSuccess());
+    auto res = conn->query("CREATE (a:test {id: 1});");
+    ASSERT_FALSE(res->isSuccess());
+    ASSERT_EQ(res->getErrorMessage(), "Runtime exception: checkpoint failed.");
+    FlakyCheckpointer checkpointer([](main::ClientContext& context) {
+        return std::make_unique<Checkpointer>(context);
+    });
+    checkpointer.setCheckpointer(*getClientContext(*conn));
+    ASSERT_TRUE(conn->query("CREATE (a:test {id: 2});")->isSuccess());
+    res = conn->query("MATCH (a:test) RETURN COUNT(a);");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<int64_t>(), 3);
+}
+
 class FlakyCheckpointerFailsOnSerialization final : public Checkpointer {
 public:
     explicit FlakyCheckpointerFailsOnSerialization(main::ClientContext& context)
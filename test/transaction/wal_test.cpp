@@ -21,6 +21,7 @@ protected:
 
     void testStrayWALFile(const std::function<void()>& setupNewDBFunc);
     void setupChecksumMismatchTest(std::function<void(std::ofstream&)> corruptFunc);
+    void logManyTransactions();
 };
 
 TEST_F(WalTest, NoWALFile) {
@@ -587,3 +588,90 @@ TEST_F(WalTest, ReadOnlyRecoveryNoWALFile) {
     ASSERT_TRUE(res->isSuccess());
     ASSERT_EQ(res->getNumTuples(), 0);
 }
+
+// Logs 100 transactions that each insert a node and then set the value of node 0 to its own index.
+void WalTest::logManyTransactions() {
+    conn->query("CALL force_checkpoint_on_close=false");
+    conn->query("CALL auto_checkpoint=false");
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY, val INT64);")->isSuccess());
+    for (auto i = 0; i < 100; i++) {
+        ASSERT_TRUE(
+            conn->query(std::format("CREATE (:test {{id: {}, val: {}}});", i, i))->isSuccess());
+        ASSERT_TRUE(conn->query(std::format("MATCH (t:test) WHERE t.id = 0 SET t.val = {};", i))
+                        ->isSuccess());
+    }
+}
+
+// Replay decodes records ahead of applying them, with a bounded number of records in flight. Each
+// transaction logs several records, so this WAL holds many more records than are buffered at once.
+// Every transaction updates the same node, so the final value shows that records are applied in
+// WAL order.
+TEST_F(WalTest, ReplayManyTransactionsInOrder) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    logManyTransactions();
+    createDBAndConn();
+    auto res = conn->query("MATCH (t:test) RETURN COUNT(*), SUM(t.id);");
+    ASSERT_TRUE(res->isSuccess());
+    auto tuple = res->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 100);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 4950);
+    res = conn->query("MATCH (t:test) WHERE t.id = 0 RETURN t.val;");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<int64_t>(), 99);
+}
+
+// Same as above, but the commit record of the last transaction is cut off. Records are decoded
+// ahead only up to the last complete commit, so the last update is dropped and all others are kept.
+TEST_F(WalTest, ReplayManyTransactionsWithTruncatedTail) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    logManyTransactions();
+    auto walFilePath = lbug::storage::StorageUtils::getWALFilePath(databasePath);
+    ASSERT_TRUE(std::filesystem::file_size(walFilePath) > 10);
+    std::filesystem::resize_file(walFilePath, std::filesystem::file_size(walFilePath) - 10);
+    createDBAndConn();
+    auto res = conn->query("MATCH (t:test) RETURN COUNT(*);");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<int64_t>(), 100);
+    res = conn->query("MATCH (t:test) WHERE t.id = 0 RETURN t.val;");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<int64_t>(), 98);
+}
+
+// With WAL compression enabled, the records of a large transaction are compressed together. The
+// same bulk insertion must take up much less of the WAL and still be replayed.
+TEST_F(WalTest, CompressLargeTransactions) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    conn->query("CALL force_checkpoint_on_close=false");
+    conn->query("CALL auto_checkpoint=false");
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY, name STRING);")->isSuccess());
+    auto walFilePath = lbug::storage::StorageUtils::getWALFilePath(databasePath);
+    auto insertAndGetWALGrowth = [&](int64_t startID) {
+        const auto sizeBefore = std::filesystem::file_size(walFilePath);
+        EXPECT_TRUE(conn->query(std::format("UNWIND range({}, {}) AS i CREATE (:test {{id: i, "
+                                            "name: 'name' + CAST(i AS STRING)}});",
+                                    startID, startID + 999))
+                        ->isSuccess());
+        return std::filesystem::file_size(walFilePath) - sizeBefore;
+    };
+    const auto uncompressedGrowth = insertAndGetWALGrowth(0);
+    ASSERT_TRUE(conn->query("CALL wal_compression=true")->isSuccess());
+    const auto compressedGrowth = insertAndGetWALGrowth(1000);
+    ASSERT_LT(compressedGrowth * 2, uncompressedGrowth);
+    createDBAndConn();
+    auto res = conn->query("MATCH (t:test) RETURN COUNT(*), SUM(t.id);");
+    ASSERT_TRUE(res->isSuccess());
+    auto tuple = res->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 2000);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 1999000);
+    res = conn->query("MATCH (t:test) WHERE t.id = 1234 RETURN t.name;");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<std::string>(), "name1234");
+}
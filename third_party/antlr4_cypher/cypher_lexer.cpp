@@ -86,7 +86,7 @@ void cypherlexerLexerInitialize() {
       "SP", "WHITESPACE", "CypherComment", "FF", "EscapedSymbolicName_0", 
       "RS", "ID_Continue", "Comment_1", "StringLiteral_1", "Comment_3", 
       "Comment_2", "GS", "FS", "CR", "Sc", "SPACE", "Pc", "TAB", "StringLiteral_0", 
-      "LF", "VT", "US", "ID_Start", "Unknown"
+      "LF", "VT", "US", "ID_Start", "Unknown", "CACHE"
     },
     std::vector<std::string>{
       "DEFAULT_TOKEN_CHANNEL", "HIDDEN"
@@ -135,11 +135,11 @@ void cypherlexerLexerInitialize() {
       "DecimalInteger", "HexLetter", "HexDigit", "Digit", "NonZeroDigit", 
       "NonZeroOctDigit", "ZeroDigit", "ExponentDecimalReal", "RegularDecimalReal", 
       "UnescapedSymbolicName", "IdentifierStart", "IdentifierPart", "EscapedSymbolicName", 
-      "SP", "WHITESPACE", "CypherComment", "Unknown"
+      "SP", "WHITESPACE", "CypherComment", "Unknown", "CACHE"
     }
   );
   static const int32_t serializedATNSegment[] = {
-  	4,0,188,1545,6,-1,2,0,7,0,2,1,7,1,2,2,7,2,2,3,7,3,2,4,7,4,2,5,7,5,2,6,
+  	4,0,189,1553,6,-1,2,0,7,0,2,1,7,1,2,2,7,2,2,3,7,3,2,4,7,4,2,5,7,5,2,6,
   	7,6,2,7,7,7,2,8,7,8,2,9,7,9,2,10,7,10,2,11,7,11,2,12,7,12,2,13,7,13,2,
   	14,7,14,2,15,7,15,2,16,7,16,2,17,7,17,2,18,7,18,2,19,7,19,2,20,7,20,2,
   	21,7,21,2,22,7,22,2,23,7,23,2,24,7,24,2,25,7,25,2,26,7,26,2,27,7,27,2,
@@ -263,497 +263,498 @@ void cypherlexerLexerInitialize() {
   	186,1502,8,186,1,187,1,187,1,188,1,188,1,189,1,189,1,190,1,190,1,191,
   	1,191,1,192,1,192,1,193,1,193,1,194,1,194,1,195,1,195,1,196,1,196,1,197,
   	1,197,1,198,1,198,1,199,1,199,1,200,1,200,1,201,1,201,1,202,1,202,1,203,
-  	1,203,1,204,1,204,1,205,1,205,1,206,1,206,1,207,1,207,0,0,208,1,1,3,2,
-  	5,3,7,4,9,5,11,6,13,7,15,8,17,9,19,10,21,11,23,12,25,13,27,14,29,15,31,
-  	16,33,17,35,18,37,19,39,20,41,21,43,22,45,23,47,24,49,25,51,26,53,27,
-  	55,28,57,29,59,30,61,31,63,32,65,33,67,34,69,35,71,36,73,37,75,38,77,
-  	39,79,40,81,41,83,42,85,43,87,44,89,45,91,46,93,47,95,48,97,49,99,50,
-  	101,51,103,52,105,53,107,54,109,55,111,56,113,57,115,58,117,59,119,60,
-  	121,61,123,62,125,63,127,64,129,65,131,66,133,67,135,68,137,69,139,70,
-  	141,71,143,72,145,73,147,74,149,75,151,76,153,77,155,78,157,79,159,80,
-  	161,81,163,82,165,83,167,84,169,85,171,86,173,87,175,88,177,89,179,90,
-  	181,91,183,92,185,93,187,94,189,95,191,96,193,97,195,98,197,99,199,100,
-  	201,101,203,102,205,103,207,104,209,105,211,106,213,107,215,108,217,109,
-  	219,110,221,111,223,112,225,113,227,114,229,115,231,116,233,117,235,118,
-  	237,119,239,120,241,121,243,122,245,123,247,124,249,125,251,126,253,127,
-  	255,128,257,129,259,130,261,131,263,132,265,133,267,134,269,135,271,136,
-  	273,137,275,138,277,139,279,140,281,141,283,142,285,143,287,144,289,145,
-  	291,146,293,147,295,148,297,149,299,150,301,151,303,152,305,153,307,154,
-  	309,155,311,156,313,157,315,158,317,159,319,160,321,161,323,162,325,163,
-  	327,164,329,165,331,166,333,167,335,168,337,169,339,170,341,171,343,172,
-  	345,173,347,174,349,175,351,176,353,177,355,178,357,179,359,180,361,181,
-  	363,182,365,183,367,184,369,185,371,186,373,187,375,0,377,0,379,0,381,
-  	0,383,0,385,0,387,0,389,0,391,0,393,0,395,0,397,0,399,0,401,0,403,0,405,
-  	0,407,0,409,0,411,0,413,0,415,188,1,0,48,2,0,65,65,97,97,2,0,67,67,99,
-  	99,2,0,89,89,121,121,2,0,76,76,108,108,2,0,73,73,105,105,2,0,78,78,110,
-  	110,2,0,68,68,100,100,2,0,84,84,116,116,2,0,69,69,101,101,2,0,82,82,114,
-  	114,2,0,83,83,115,115,2,0,71,71,103,103,2,0,72,72,104,104,2,0,66,66,98,
-  	98,2,0,75,75,107,107,2,0,80,80,112,112,2,0,79,79,111,111,2,0,85,85,117,
-  	117,2,0,77,77,109,109,2,0,70,70,102,102,2,0,88,88,120,120,2,0,74,74,106,
-  	106,2,0,86,86,118,118,2,0,81,81,113,113,2,0,87,87,119,119,13,0,34,34,
-  	39,39,66,66,70,70,78,78,82,82,84,84,92,92,98,98,102,102,110,110,114,114,
-  	116,116,2,0,65,70,97,102,8,0,160,160,5760,5760,6158,6158,8192,8202,8232,
-  	8233,8239,8239,8287,8287,12288,12288,1,0,12,12,1,0,96,96,1,0,30,30,768,
-  	0,48,57,65,90,95,95,97,122,170,170,181,181,183,183,186,186,192,214,216,
-  	246,248,705,710,721,736,740,748,748,750,750,768,884,886,887,890,893,895,
-  	895,902,906,908,908,910,929,931,1013,1015,1153,1155,1159,1162,1327,1329,
-  	1366,1369,1369,1376,1416,1425,1469,1471,1471,1473,1474,1476,1477,1479,
-  	1479,1488,1514,1519,1522,1552,1562,1568,1641,1646,1747,1749,1756,1759,
-  	1768,1770,1788,1791,1791,1808,1866,1869,1969,1984,2037,2042,2042,2045,
-  	2045,2048,2093,2112,2139,2144,2154,2160,2183,2185,2190,2200,2273,2275,
-  	2403,2406,2415,2417,2435,2437,2444,2447,2448,2451,2472,2474,2480,2482,
-  	2482,2486,2489,2492,2500,2503,2504,2507,2510,2519,2519,2524,2525,2527,
-  	2531,2534,2545,2556,2556,2558,2558,2561,2563,2565,2570,2575,2576,2579,
-  	2600,2602,2608,2610,2611,2613,2614,2616,2617,2620,2620,2622,2626,2631,
-  	2632,2635,2637,2641,2641,2649,2652,2654,2654,2662,2677,2689,2691,2693,
-  	2701,2703,2705,2707,2728,2730,2736,2738,2739,2741,2745,2748,2757,2759,
-  	2761,2763,2765,2768,2768,2784,2787,2790,2799,2809,2815,2817,2819,2821,
-  	2828,2831,2832,2835,2856,2858,2864,2866,2867,2869,2873,2876,2884,2887,
-  	2888,2891,2893,2901,2903,2908,2909,2911,2915,2918,2927,2929,2929,2946,
-  	2947,2949,2954,2958,2960,2962,2965,2969,2970,2972,2972,2974,2975,2979,
-  	2980,2984,2986,2990,3001,3006,3010,3014,3016,3018,3021,3024,3024,3031,
-  	3031,3046,3055,3072,3084,3086,3088,3090,3112,3114,3129,3132,3140,3142,
-  	3144,3146,3149,3157,3158,3160,3162,3165,3165,3168,3171,3174,3183,3200,
-  	3203,3205,3212,3214,3216,3218,3240,3242,3251,3253,3257,3260,3268,3270,
-  	3272,3274,3277,3285,3286,3293,3294,3296,3299,3302,3311,3313,3315,3328,
-  	3340,3342,3344,3346,3396,3398,3400,3402,3406,3412,3415,3423,3427,3430,
-  	3439,3450,3455,3457,3459,3461,3478,3482,3505,3507,3515,3517,3517,3520,
-  	3526,3530,3530,3535,3540,3542,3542,3544,3551,3558,3567,3570,3571,3585,
-  	3642,3648,3662,3664,3673,3713,3714,3716,3716,3718,3722,3724,3747,3749,
-  	3749,3751,3773,3776,3780,3782,3782,3784,3790,3792,3801,3804,3807,3840,
-  	3840,3864,3865,3872,3881,3893,3893,3895,3895,3897,3897,3902,3911,3913,
-  	3948,3953,3972,3974,3991,3993,4028,4038,4038,4096,4169,4176,4253,4256,
-  	4293,4295,4295,4301,4301,4304,4346,4348,4680,4682,4685,4688,4694,4696,
-  	4696,4698,4701,4704,4744,4746,4749,4752,4784,4786,4789,4792,4798,4800,
-  	4800,4802,4805,4808,4822,4824,4880,4882,4885,4888,4954,4957,4959,4969,
-  	4977,4992,5007,5024,5109,5112,5117,5121,5740,5743,5759,5761,5786,5792,
-  	5866,5870,5880,5888,5909,5919,5940,5952,5971,5984,5996,5998,6000,6002,
-  	6003,6016,6099,6103,6103,6108,6109,6112,6121,6155,6157,6159,6169,6176,
-  	6264,6272,6314,6320,6389,6400,6430,6432,6443,6448,6459,6470,6509,6512,
-  	6516,6528,6571,6576,6601,6608,6618,6656,6683,6688,6750,6752,6780,6783,
-  	6793,6800,6809,6823,6823,6832,6845,6847,6862,6912,6988,6992,7001,7019,
-  	7027,7040,7155,7168,7223,7232,7241,7245,7293,7296,7304,7312,7354,7357,
-  	7359,7376,7378,7380,7418,7424,7957,7960,7965,7968,8005,8008,8013,8016,
-  	8023,8025,8025,8027,8027,8029,8029,8031,8061,8064,8116,8118,8124,8126,
-  	8126,8130,8132,8134,8140,8144,8147,8150,8155,8160,8172,8178,8180,8182,
-  	8188,8255,8256,8276,8276,8305,8305,8319,8319,8336,8348,8400,8412,8417,
-  	8417,8421,8432,8450,8450,8455,8455,8458,8467,8469,8469,8472,8477,8484,
-  	8484,8486,8486,8488,8488,8490,8505,8508,8511,8517,8521,8526,8526,8544,
-  	8584,11264,11492,11499,11507,11520,11557,11559,11559,11565,11565,11568,
-  	11623,11631,11631,11647,11670,11680,11686,11688,11694,11696,11702,11704,
-  	11710,11712,11718,11720,11726,11728,11734,11736,11742,11744,11775,12293,
-  	12295,12321,12335,12337,12341,12344,12348,12353,12438,12441,12447,12449,
-  	12538,12540,12543,12549,12591,12593,12686,12704,12735,12784,12799,13312,
-  	19903,19968,42124,42192,42237,42240,42508,42512,42539,42560,42607,42612,
-  	42621,42623,42737,42775,42783,42786,42888,42891,42954,42960,42961,42963,
-  	42963,42965,42969,42994,43047,43052,43052,43072,43123,43136,43205,43216,
-  	43225,43232,43255,43259,43259,43261,43309,43312,43347,43360,43388,43392,
-  	43456,43471,43481,43488,43518,43520,43574,43584,43597,43600,43609,43616,
-  	43638,43642,43714,43739,43741,43744,43759,43762,43766,43777,43782,43785,
-  	43790,43793,43798,43808,43814,43816,43822,43824,43866,43868,43881,43888,
-  	44010,44012,44013,44016,44025,44032,55203,55216,55238,55243,55291,63744,
-  	64109,64112,64217,64256,64262,64275,64279,64285,64296,64298,64310,64312,
-  	64316,64318,64318,64320,64321,64323,64324,64326,64433,64467,64829,64848,
-  	64911,64914,64967,65008,65019,65024,65039,65056,65071,65075,65076,65101,
-  	65103,65136,65140,65142,65276,65296,65305,65313,65338,65343,65343,65345,
-  	65370,65382,65470,65474,65479,65482,65487,65490,65495,65498,65500,65536,
-  	65547,65549,65574,65576,65594,65596,65597,65599,65613,65616,65629,65664,
-  	65786,65856,65908,66045,66045,66176,66204,66208,66256,66272,66272,66304,
-  	66335,66349,66378,66384,66426,66432,66461,66464,66499,66504,66511,66513,
-  	66517,66560,66717,66720,66729,66736,66771,66776,66811,66816,66855,66864,
-  	66915,66928,66938,66940,66954,66956,66962,66964,66965,66967,66977,66979,
-  	66993,66995,67001,67003,67004,67072,67382,67392,67413,67424,67431,67456,
-  	67461,67463,67504,67506,67514,67584,67589,67592,67592,67594,67637,67639,
-  	67640,67644,67644,67647,67669,67680,67702,67712,67742,67808,67826,67828,
-  	67829,67840,67861,67872,67897,67968,68023,68030,68031,68096,68099,68101,
-  	68102,68108,68115,68117,68119,68121,68149,68152,68154,68159,68159,68192,
-  	68220,68224,68252,68288,68295,68297,68326,68352,68405,68416,68437,68448,
-  	68466,68480,68497,68608,68680,68736,68786,68800,68850,68864,68903,68912,
-  	68921,69248,69289,69291,69292,69296,69297,69373,69404,69415,69415,69424,
-  	69456,69488,69509,69552,69572,69600,69622,69632,69702,69734,69749,69759,
-  	69818,69826,69826,69840,69864,69872,69881,69888,69940,69942,69951,69956,
-  	69959,69968,70003,70006,70006,70016,70084,70089,70092,70094,70106,70108,
-  	70108,70144,70161,70163,70199,70206,70209,70272,70278,70280,70280,70282,
-  	70285,70287,70301,70303,70312,70320,70378,70384,70393,70400,70403,70405,
-  	70412,70415,70416,70419,70440,70442,70448,70450,70451,70453,70457,70459,
-  	70468,70471,70472,70475,70477,70480,70480,70487,70487,70493,70499,70502,
-  	70508,70512,70516,70656,70730,70736,70745,70750,70753,70784,70853,70855,
-  	70855,70864,70873,71040,71093,71096,71104,71128,71133,71168,71232,71236,
-  	71236,71248,71257,71296,71352,71360,71369,71424,71450,71453,71467,71472,
-  	71481,71488,71494,71680,71738,71840,71913,71935,71942,71945,71945,71948,
-  	71955,71957,71958,71960,71989,71991,71992,71995,72003,72016,72025,72096,
-  	72103,72106,72151,72154,72161,72163,72164,72192,72254,72263,72263,72272,
-  	72345,72349,72349,72368,72440,72704,72712,72714,72758,72760,72768,72784,
-  	72793,72818,72847,72850,72871,72873,72886,72960,72966,72968,72969,72971,
-  	73014,73018,73018,73020,73021,73023,73031,73040,73049,73056,73061,73063,
-  	73064,73066,73102,73104,73105,73107,73112,73120,73129,73440,73462,73472,
-  	73488,73490,73530,73534,73538,73552,73561,73648,73648,73728,74649,74752,
-  	74862,74880,75075,77712,77808,77824,78895,78912,78933,82944,83526,92160,
-  	92728,92736,92766,92768,92777,92784,92862,92864,92873,92880,92909,92912,
-  	92916,92928,92982,92992,92995,93008,93017,93027,93047,93053,93071,93760,
-  	93823,93952,94026,94031,94087,94095,94111,94176,94177,94179,94180,94192,
-  	94193,94208,100343,100352,101589,101632,101640,110576,110579,110581,110587,
-  	110589,110590,110592,110882,110898,110898,110928,110930,110933,110933,
-  	110948,110951,110960,111355,113664,113770,113776,113788,113792,113800,
-  	113808,113817,113821,113822,118528,118573,118576,118598,119141,119145,
-  	119149,119154,119163,119170,119173,119179,119210,119213,119362,119364,
-  	119808,119892,119894,119964,119966,119967,119970,119970,119973,119974,
-  	119977,119980,119982,119993,119995,119995,119997,120003,120005,120069,
-  	120071,120074,120077,120084,120086,120092,120094,120121,120123,120126,
-  	120128,120132,120134,120134,120138,120144,120146,120485,120488,120512,
-  	120514,120538,120540,120570,120572,120596,120598,120628,120630,120654,
-  	120656,120686,120688,120712,120714,120744,120746,120770,120772,120779,
-  	120782,120831,121344,121398,121403,121452,121461,121461,121476,121476,
-  	121499,121503,121505,121519,122624,122654,122661,122666,122880,122886,
-  	122888,122904,122907,122913,122915,122916,122918,122922,122928,122989,
-  	123023,123023,123136,123180,123184,123197,123200,123209,123214,123214,
-  	123536,123566,123584,123641,124112,124153,124896,124902,124904,124907,
-  	124909,124910,124912,124926,124928,125124,125136,125142,125184,125259,
-  	125264,125273,126464,126467,126469,126495,126497,126498,126500,126500,
-  	126503,126503,126505,126514,126516,126519,126521,126521,126523,126523,
-  	126530,126530,126535,126535,126537,126537,126539,126539,126541,126543,
-  	126545,126546,126548,126548,126551,126551,126553,126553,126555,126555,
-  	126557,126557,126559,126559,126561,126562,126564,126564,126567,126570,
-  	126572,126578,126580,126583,126585,126588,126590,126590,126592,126601,
-  	126603,126619,126625,126627,126629,126633,126635,126651,130032,130041,
-  	131072,173791,173824,177977,177984,178205,178208,183969,183984,191456,
-  	194560,195101,196608,201546,201552,205743,917760,917999,1,0,42,42,2,0,
-  	39,39,92,92,2,0,10,10,13,13,1,0,47,47,1,0,29,29,1,0,28,28,1,0,13,13,21,
-  	0,36,36,162,165,1423,1423,1547,1547,2046,2047,2546,2547,2555,2555,2801,
-  	2801,3065,3065,3647,3647,6107,6107,8352,8384,43064,43064,65020,65020,
-  	65129,65129,65284,65284,65504,65505,65509,65510,73693,73696,123647,123647,
-  	126128,126128,1,0,32,32,6,0,95,95,8255,8256,8276,8276,65075,65076,65101,
-  	65103,65343,65343,1,0,9,9,2,0,34,34,92,92,1,0,10,10,1,0,11,11,1,0,31,
-  	31,659,0,65,90,97,122,170,170,181,181,186,186,192,214,216,246,248,705,
-  	710,721,736,740,748,748,750,750,880,884,886,887,890,893,895,895,902,902,
-  	904,906,908,908,910,929,931,1013,1015,1153,1162,1327,1329,1366,1369,1369,
-  	1376,1416,1488,1514,1519,1522,1568,1610,1646,1647,1649,1747,1749,1749,
-  	1765,1766,1774,1775,1786,1788,1791,1791,1808,1808,1810,1839,1869,1957,
-  	1969,1969,1994,2026,2036,2037,2042,2042,2048,2069,2074,2074,2084,2084,
-  	2088,2088,2112,2136,2144,2154,2160,2183,2185,2190,2208,2249,2308,2361,
-  	2365,2365,2384,2384,2392,2401,2417,2432,2437,2444,2447,2448,2451,2472,
-  	2474,2480,2482,2482,2486,2489,2493,2493,2510,2510,2524,2525,2527,2529,
-  	2544,2545,2556,2556,2565,2570,2575,2576,2579,2600,2602,2608,2610,2611,
-  	2613,2614,2616,2617,2649,2652,2654,2654,2674,2676,2693,2701,2703,2705,
-  	2707,2728,2730,2736,2738,2739,2741,2745,2749,2749,2768,2768,2784,2785,
-  	2809,2809,2821,2828,2831,2832,2835,2856,2858,2864,2866,2867,2869,2873,
-  	2877,2877,2908,2909,2911,2913,2929,2929,2947,2947,2949,2954,2958,2960,
-  	2962,2965,2969,2970,2972,2972,2974,2975,2979,2980,2984,2986,2990,3001,
-  	3024,3024,3077,3084,3086,3088,3090,3112,3114,3129,3133,3133,3160,3162,
-  	3165,3165,3168,3169,3200,3200,3205,3212,3214,3216,3218,3240,3242,3251,
-  	3253,3257,3261,3261,3293,3294,3296,3297,3313,3314,3332,3340,3342,3344,
-  	3346,3386,3389,3389,3406,3406,3412,3414,3423,3425,3450,3455,3461,3478,
-  	3482,3505,3507,3515,3517,3517,3520,3526,3585,3632,3634,3635,3648,3654,
-  	3713,3714,3716,3716,3718,3722,3724,3747,3749,3749,3751,3760,3762,3763,
-  	3773,3773,3776,3780,3782,3782,3804,3807,3840,3840,3904,3911,3913,3948,
-  	3976,3980,4096,4138,4159,4159,4176,4181,4186,4189,4193,4193,4197,4198,
-  	4206,4208,4213,4225,4238,4238,4256,4293,4295,4295,4301,4301,4304,4346,
-  	4348,4680,4682,4685,4688,4694,4696,4696,4698,4701,4704,4744,4746,4749,
-  	4752,4784,4786,4789,4792,4798,4800,4800,4802,4805,4808,4822,4824,4880,
-  	4882,4885,4888,4954,4992,5007,5024,5109,5112,5117,5121,5740,5743,5759,
-  	5761,5786,5792,5866,5870,5880,5888,5905,5919,5937,5952,5969,5984,5996,
-  	5998,6000,6016,6067,6103,6103,6108,6108,6176,6264,6272,6312,6314,6314,
-  	6320,6389,6400,6430,6480,6509,6512,6516,6528,6571,6576,6601,6656,6678,
-  	6688,6740,6823,6823,6917,6963,6981,6988,7043,7072,7086,7087,7098,7141,
-  	7168,7203,7245,7247,7258,7293,7296,7304,7312,7354,7357,7359,7401,7404,
-  	7406,7411,7413,7414,7418,7418,7424,7615,7680,7957,7960,7965,7968,8005,
-  	8008,8013,8016,8023,8025,8025,8027,8027,8029,8029,8031,8061,8064,8116,
-  	8118,8124,8126,8126,8130,8132,8134,8140,8144,8147,8150,8155,8160,8172,
-  	8178,8180,8182,8188,8305,8305,8319,8319,8336,8348,8450,8450,8455,8455,
-  	8458,8467,8469,8469,8472,8477,8484,8484,8486,8486,8488,8488,8490,8505,
-  	8508,8511,8517,8521,8526,8526,8544,8584,11264,11492,11499,11502,11506,
-  	11507,11520,11557,11559,11559,11565,11565,11568,11623,11631,11631,11648,
-  	11670,11680,11686,11688,11694,11696,11702,11704,11710,11712,11718,11720,
-  	11726,11728,11734,11736,11742,12293,12295,12321,12329,12337,12341,12344,
-  	12348,12353,12438,12443,12447,12449,12538,12540,12543,12549,12591,12593,
-  	12686,12704,12735,12784,12799,13312,19903,19968,42124,42192,42237,42240,
-  	42508,42512,42527,42538,42539,42560,42606,42623,42653,42656,42735,42775,
-  	42783,42786,42888,42891,42954,42960,42961,42963,42963,42965,42969,42994,
-  	43009,43011,43013,43015,43018,43020,43042,43072,43123,43138,43187,43250,
-  	43255,43259,43259,43261,43262,43274,43301,43312,43334,43360,43388,43396,
-  	43442,43471,43471,43488,43492,43494,43503,43514,43518,43520,43560,43584,
-  	43586,43588,43595,43616,43638,43642,43642,43646,43695,43697,43697,43701,
-  	43702,43705,43709,43712,43712,43714,43714,43739,43741,43744,43754,43762,
-  	43764,43777,43782,43785,43790,43793,43798,43808,43814,43816,43822,43824,
-  	43866,43868,43881,43888,44002,44032,55203,55216,55238,55243,55291,63744,
-  	64109,64112,64217,64256,64262,64275,64279,64285,64285,64287,64296,64298,
-  	64310,64312,64316,64318,64318,64320,64321,64323,64324,64326,64433,64467,
-  	64829,64848,64911,64914,64967,65008,65019,65136,65140,65142,65276,65313,
-  	65338,65345,65370,65382,65470,65474,65479,65482,65487,65490,65495,65498,
-  	65500,65536,65547,65549,65574,65576,65594,65596,65597,65599,65613,65616,
-  	65629,65664,65786,65856,65908,66176,66204,66208,66256,66304,66335,66349,
-  	66378,66384,66421,66432,66461,66464,66499,66504,66511,66513,66517,66560,
-  	66717,66736,66771,66776,66811,66816,66855,66864,66915,66928,66938,66940,
-  	66954,66956,66962,66964,66965,66967,66977,66979,66993,66995,67001,67003,
-  	67004,67072,67382,67392,67413,67424,67431,67456,67461,67463,67504,67506,
-  	67514,67584,67589,67592,67592,67594,67637,67639,67640,67644,67644,67647,
-  	67669,67680,67702,67712,67742,67808,67826,67828,67829,67840,67861,67872,
-  	67897,67968,68023,68030,68031,68096,68096,68112,68115,68117,68119,68121,
-  	68149,68192,68220,68224,68252,68288,68295,68297,68324,68352,68405,68416,
-  	68437,68448,68466,68480,68497,68608,68680,68736,68786,68800,68850,68864,
-  	68899,69248,69289,69296,69297,69376,69404,69415,69415,69424,69445,69488,
-  	69505,69552,69572,69600,69622,69635,69687,69745,69746,69749,69749,69763,
-  	69807,69840,69864,69891,69926,69956,69956,69959,69959,69968,70002,70006,
-  	70006,70019,70066,70081,70084,70106,70106,70108,70108,70144,70161,70163,
-  	70187,70207,70208,70272,70278,70280,70280,70282,70285,70287,70301,70303,
-  	70312,70320,70366,70405,70412,70415,70416,70419,70440,70442,70448,70450,
-  	70451,70453,70457,70461,70461,70480,70480,70493,70497,70656,70708,70727,
-  	70730,70751,70753,70784,70831,70852,70853,70855,70855,71040,71086,71128,
-  	71131,71168,71215,71236,71236,71296,71338,71352,71352,71424,71450,71488,
-  	71494,71680,71723,71840,71903,71935,71942,71945,71945,71948,71955,71957,
-  	71958,71960,71983,71999,71999,72001,72001,72096,72103,72106,72144,72161,
-  	72161,72163,72163,72192,72192,72203,72242,72250,72250,72272,72272,72284,
-  	72329,72349,72349,72368,72440,72704,72712,72714,72750,72768,72768,72818,
-  	72847,72960,72966,72968,72969,72971,73008,73030,73030,73056,73061,73063,
-  	73064,73066,73097,73112,73112,73440,73458,73474,73474,73476,73488,73490,
-  	73523,73648,73648,73728,74649,74752,74862,74880,75075,77712,77808,77824,
-  	78895,78913,78918,82944,83526,92160,92728,92736,92766,92784,92862,92880,
-  	92909,92928,92975,92992,92995,93027,93047,93053,93071,93760,93823,93952,
-  	94026,94032,94032,94099,94111,94176,94177,94179,94179,94208,100343,100352,
-  	101589,101632,101640,110576,110579,110581,110587,110589,110590,110592,
-  	110882,110898,110898,110928,110930,110933,110933,110948,110951,110960,
-  	111355,113664,113770,113776,113788,113792,113800,113808,113817,119808,
+  	1,203,1,204,1,204,1,205,1,205,1,206,1,206,1,207,1,207,2,208,7,208,1,208,
+  	1,208,1,208,1,208,1,208,1,208,0,0,209,1,1,3,2,5,3,7,4,9,5,11,6,13,7,15,
+  	8,17,9,19,10,21,11,23,12,25,13,27,14,29,15,31,16,33,17,35,18,37,19,39,
+  	20,41,21,43,22,45,23,47,24,49,25,51,26,53,27,55,28,57,29,59,30,61,31,
+  	63,32,65,33,67,34,69,35,71,36,73,37,75,38,77,39,79,40,81,41,83,42,85,
+  	43,87,44,89,45,91,46,93,47,95,48,97,49,99,50,101,51,103,52,105,53,107,
+  	54,109,55,111,56,113,57,115,58,117,59,119,60,121,61,123,62,125,63,127,
+  	64,129,65,131,66,133,67,135,68,137,69,139,70,141,71,143,72,145,73,147,
+  	74,149,75,151,76,153,77,155,78,157,79,159,80,161,81,163,82,165,83,167,
+  	84,169,85,171,86,173,87,175,88,177,89,179,90,181,91,183,92,185,93,187,
+  	94,189,95,191,96,193,97,195,98,197,99,199,100,201,101,203,102,205,103,
+  	207,104,209,105,211,106,213,107,215,108,217,109,219,110,221,111,223,112,
+  	225,113,227,114,229,115,231,116,233,117,235,118,237,119,239,120,241,121,
+  	243,122,245,123,247,124,249,125,251,126,253,127,255,128,257,129,259,130,
+  	261,131,263,132,265,133,267,134,269,135,271,136,273,137,275,138,277,139,
+  	279,140,281,141,283,142,285,143,287,144,289,145,291,146,293,147,295,148,
+  	297,149,299,150,301,151,303,152,305,153,307,154,309,155,311,156,313,157,
+  	315,158,317,159,319,160,321,161,323,162,325,163,327,164,329,165,331,166,
+  	333,167,335,168,337,169,339,170,341,171,343,172,345,173,347,174,349,175,
+  	351,176,353,177,355,178,357,179,359,180,361,181,363,182,365,183,367,184,
+  	369,185,371,186,373,187,375,0,377,0,379,0,381,0,383,0,385,0,387,0,389,
+  	0,391,0,393,0,395,0,397,0,399,0,401,0,403,0,405,0,407,0,409,0,411,0,413,
+  	0,415,188,1545,189,1,0,48,2,0,65,65,97,97,2,0,67,67,99,99,2,0,89,89,121,
+  	121,2,0,76,76,108,108,2,0,73,73,105,105,2,0,78,78,110,110,2,0,68,68,100,
+  	100,2,0,84,84,116,116,2,0,69,69,101,101,2,0,82,82,114,114,2,0,83,83,115,
+  	115,2,0,71,71,103,103,2,0,72,72,104,104,2,0,66,66,98,98,2,0,75,75,107,
+  	107,2,0,80,80,112,112,2,0,79,79,111,111,2,0,85,85,117,117,2,0,77,77,109,
+  	109,2,0,70,70,102,102,2,0,88,88,120,120,2,0,74,74,106,106,2,0,86,86,118,
+  	118,2,0,81,81,113,113,2,0,87,87,119,119,13,0,34,34,39,39,66,66,70,70,
+  	78,78,82,82,84,84,92,92,98,98,102,102,110,110,114,114,116,116,2,0,65,
+  	70,97,102,8,0,160,160,5760,5760,6158,6158,8192,8202,8232,8233,8239,8239,
+  	8287,8287,12288,12288,1,0,12,12,1,0,96,96,1,0,30,30,768,0,48,57,65,90,
+  	95,95,97,122,170,170,181,181,183,183,186,186,192,214,216,246,248,705,
+  	710,721,736,740,748,748,750,750,768,884,886,887,890,893,895,895,902,906,
+  	908,908,910,929,931,1013,1015,1153,1155,1159,1162,1327,1329,1366,1369,
+  	1369,1376,1416,1425,1469,1471,1471,1473,1474,1476,1477,1479,1479,1488,
+  	1514,1519,1522,1552,1562,1568,1641,1646,1747,1749,1756,1759,1768,1770,
+  	1788,1791,1791,1808,1866,1869,1969,1984,2037,2042,2042,2045,2045,2048,
+  	2093,2112,2139,2144,2154,2160,2183,2185,2190,2200,2273,2275,2403,2406,
+  	2415,2417,2435,2437,2444,2447,2448,2451,2472,2474,2480,2482,2482,2486,
+  	2489,2492,2500,2503,2504,2507,2510,2519,2519,2524,2525,2527,2531,2534,
+  	2545,2556,2556,2558,2558,2561,2563,2565,2570,2575,2576,2579,2600,2602,
+  	2608,2610,2611,2613,2614,2616,2617,2620,2620,2622,2626,2631,2632,2635,
+  	2637,2641,2641,2649,2652,2654,2654,2662,2677,2689,2691,2693,2701,2703,
+  	2705,2707,2728,2730,2736,2738,2739,2741,2745,2748,2757,2759,2761,2763,
+  	2765,2768,2768,2784,2787,2790,2799,2809,2815,2817,2819,2821,2828,2831,
+  	2832,2835,2856,2858,2864,2866,2867,2869,2873,2876,2884,2887,2888,2891,
+  	2893,2901,2903,2908,2909,2911,2915,2918,2927,2929,2929,2946,2947,2949,
+  	2954,2958,2960,2962,2965,2969,2970,2972,2972,2974,2975,2979,2980,2984,
+  	2986,2990,3001,3006,3010,3014,3016,3018,3021,3024,3024,3031,3031,3046,
+  	3055,3072,3084,3086,3088,3090,3112,3114,3129,3132,3140,3142,3144,3146,
+  	3149,3157,3158,3160,3162,3165,3165,3168,3171,3174,3183,3200,3203,3205,
+  	3212,3214,3216,3218,3240,3242,3251,3253,3257,3260,3268,3270,3272,3274,
+  	3277,3285,3286,3293,3294,3296,3299,3302,3311,3313,3315,3328,3340,3342,
+  	3344,3346,3396,3398,3400,3402,3406,3412,3415,3423,3427,3430,3439,3450,
+  	3455,3457,3459,3461,3478,3482,3505,3507,3515,3517,3517,3520,3526,3530,
+  	3530,3535,3540,3542,3542,3544,3551,3558,3567,3570,3571,3585,3642,3648,
+  	3662,3664,3673,3713,3714,3716,3716,3718,3722,3724,3747,3749,3749,3751,
+  	3773,3776,3780,3782,3782,3784,3790,3792,3801,3804,3807,3840,3840,3864,
+  	3865,3872,3881,3893,3893,3895,3895,3897,3897,3902,3911,3913,3948,3953,
+  	3972,3974,3991,3993,4028,4038,4038,4096,4169,4176,4253,4256,4293,4295,
+  	4295,4301,4301,4304,4346,4348,4680,4682,4685,4688,4694,4696,4696,4698,
+  	4701,4704,4744,4746,4749,4752,4784,4786,4789,4792,4798,4800,4800,4802,
+  	4805,4808,4822,4824,4880,4882,4885,4888,4954,4957,4959,4969,4977,4992,
+  	5007,5024,5109,5112,5117,5121,5740,5743,5759,5761,5786,5792,5866,5870,
+  	5880,5888,5909,5919,5940,5952,5971,5984,5996,5998,6000,6002,6003,6016,
+  	6099,6103,6103,6108,6109,6112,6121,6155,6157,6159,6169,6176,6264,6272,
+  	6314,6320,6389,6400,6430,6432,6443,6448,6459,6470,6509,6512,6516,6528,
+  	6571,6576,6601,6608,6618,6656,6683,6688,6750,6752,6780,6783,6793,6800,
+  	6809,6823,6823,6832,6845,6847,6862,6912,6988,6992,7001,7019,7027,7040,
+  	7155,7168,7223,7232,7241,7245,7293,7296,7304,7312,7354,7357,7359,7376,
+  	7378,7380,7418,7424,7957,7960,7965,7968,8005,8008,8013,8016,8023,8025,
+  	8025,8027,8027,8029,8029,8031,8061,8064,8116,8118,8124,8126,8126,8130,
+  	8132,8134,8140,8144,8147,8150,8155,8160,8172,8178,8180,8182,8188,8255,
+  	8256,8276,8276,8305,8305,8319,8319,8336,8348,8400,8412,8417,8417,8421,
+  	8432,8450,8450,8455,8455,8458,8467,8469,8469,8472,8477,8484,8484,8486,
+  	8486,8488,8488,8490,8505,8508,8511,8517,8521,8526,8526,8544,8584,11264,
+  	11492,11499,11507,11520,11557,11559,11559,11565,11565,11568,11623,11631,
+  	11631,11647,11670,11680,11686,11688,11694,11696,11702,11704,11710,11712,
+  	11718,11720,11726,11728,11734,11736,11742,11744,11775,12293,12295,12321,
+  	12335,12337,12341,12344,12348,12353,12438,12441,12447,12449,12538,12540,
+  	12543,12549,12591,12593,12686,12704,12735,12784,12799,13312,19903,19968,
+  	42124,42192,42237,42240,42508,42512,42539,42560,42607,42612,42621,42623,
+  	42737,42775,42783,42786,42888,42891,42954,42960,42961,42963,42963,42965,
+  	42969,42994,43047,43052,43052,43072,43123,43136,43205,43216,43225,43232,
+  	43255,43259,43259,43261,43309,43312,43347,43360,43388,43392,43456,43471,
+  	43481,43488,43518,43520,43574,43584,43597,43600,43609,43616,43638,43642,
+  	43714,43739,43741,43744,43759,43762,43766,43777,43782,43785,43790,43793,
+  	43798,43808,43814,43816,43822,43824,43866,43868,43881,43888,44010,44012,
+  	44013,44016,44025,44032,55203,55216,55238,55243,55291,63744,64109,64112,
+  	64217,64256,64262,64275,64279,64285,64296,64298,64310,64312,64316,64318,
+  	64318,64320,64321,64323,64324,64326,64433,64467,64829,64848,64911,64914,
+  	64967,65008,65019,65024,65039,65056,65071,65075,65076,65101,65103,65136,
+  	65140,65142,65276,65296,65305,65313,65338,65343,65343,65345,65370,65382,
+  	65470,65474,65479,65482,65487,65490,65495,65498,65500,65536,65547,65549,
+  	65574,65576,65594,65596,65597,65599,65613,65616,65629,65664,65786,65856,
+  	65908,66045,66045,66176,66204,66208,66256,66272,66272,66304,66335,66349,
+  	66378,66384,66426,66432,66461,66464,66499,66504,66511,66513,66517,66560,
+  	66717,66720,66729,66736,66771,66776,66811,66816,66855,66864,66915,66928,
+  	66938,66940,66954,66956,66962,66964,66965,66967,66977,66979,66993,66995,
+  	67001,67003,67004,67072,67382,67392,67413,67424,67431,67456,67461,67463,
+  	67504,67506,67514,67584,67589,67592,67592,67594,67637,67639,67640,67644,
+  	67644,67647,67669,67680,67702,67712,67742,67808,67826,67828,67829,67840,
+  	67861,67872,67897,67968,68023,68030,68031,68096,68099,68101,68102,68108,
+  	68115,68117,68119,68121,68149,68152,68154,68159,68159,68192,68220,68224,
+  	68252,68288,68295,68297,68326,68352,68405,68416,68437,68448,68466,68480,
+  	68497,68608,68680,68736,68786,68800,68850,68864,68903,68912,68921,69248,
+  	69289,69291,69292,69296,69297,69373,69404,69415,69415,69424,69456,69488,
+  	69509,69552,69572,69600,69622,69632,69702,69734,69749,69759,69818,69826,
+  	69826,69840,69864,69872,69881,69888,69940,69942,69951,69956,69959,69968,
+  	70003,70006,70006,70016,70084,70089,70092,70094,70106,70108,70108,70144,
+  	70161,70163,70199,70206,70209,70272,70278,70280,70280,70282,70285,70287,
+  	70301,70303,70312,70320,70378,70384,70393,70400,70403,70405,70412,70415,
+  	70416,70419,70440,70442,70448,70450,70451,70453,70457,70459,70468,70471,
+  	70472,70475,70477,70480,70480,70487,70487,70493,70499,70502,70508,70512,
+  	70516,70656,70730,70736,70745,70750,70753,70784,70853,70855,70855,70864,
+  	70873,71040,71093,71096,71104,71128,71133,71168,71232,71236,71236,71248,
+  	71257,71296,71352,71360,71369,71424,71450,71453,71467,71472,71481,71488,
+  	71494,71680,71738,71840,71913,71935,71942,71945,71945,71948,71955,71957,
+  	71958,71960,71989,71991,71992,71995,72003,72016,72025,72096,72103,72106,
+  	72151,72154,72161,72163,72164,72192,72254,72263,72263,72272,72345,72349,
+  	72349,72368,72440,72704,72712,72714,72758,72760,72768,72784,72793,72818,
+  	72847,72850,72871,72873,72886,72960,72966,72968,72969,72971,73014,73018,
+  	73018,73020,73021,73023,73031,73040,73049,73056,73061,73063,73064,73066,
+  	73102,73104,73105,73107,73112,73120,73129,73440,73462,73472,73488,73490,
+  	73530,73534,73538,73552,73561,73648,73648,73728,74649,74752,74862,74880,
+  	75075,77712,77808,77824,78895,78912,78933,82944,83526,92160,92728,92736,
+  	92766,92768,92777,92784,92862,92864,92873,92880,92909,92912,92916,92928,
+  	92982,92992,92995,93008,93017,93027,93047,93053,93071,93760,93823,93952,
+  	94026,94031,94087,94095,94111,94176,94177,94179,94180,94192,94193,94208,
+  	100343,100352,101589,101632,101640,110576,110579,110581,110587,110589,
+  	110590,110592,110882,110898,110898,110928,110930,110933,110933,110948,
+  	110951,110960,111355,113664,113770,113776,113788,113792,113800,113808,
+  	113817,113821,113822,118528,118573,118576,118598,119141,119145,119149,
+  	119154,119163,119170,119173,119179,119210,119213,119362,119364,119808,
   	119892,119894,119964,119966,119967,119970,119970,119973,119974,119977,
   	119980,119982,119993,119995,119995,119997,120003,120005,120069,120071,
   	120074,120077,120084,120086,120092,120094,120121,120123,120126,120128,
   	120132,120134,120134,120138,120144,120146,120485,120488,120512,120514,
   	120538,120540,120570,120572,120596,120598,120628,120630,120654,120656,
-  	120686,120688,120712,120714,120744,120746,120770,120772,120779,122624,
-  	122654,122661,122666,122928,122989,123136,123180,123191,123197,123214,
-  	123214,123536,123565,123584,123627,124112,124139,124896,124902,124904,
-  	124907,124909,124910,124912,124926,124928,125124,125184,125251,125259,
-  	125259,126464,126467,126469,126495,126497,126498,126500,126500,126503,
+  	120686,120688,120712,120714,120744,120746,120770,120772,120779,120782,
+  	120831,121344,121398,121403,121452,121461,121461,121476,121476,121499,
+  	121503,121505,121519,122624,122654,122661,122666,122880,122886,122888,
+  	122904,122907,122913,122915,122916,122918,122922,122928,122989,123023,
+  	123023,123136,123180,123184,123197,123200,123209,123214,123214,123536,
+  	123566,123584,123641,124112,124153,124896,124902,124904,124907,124909,
+  	124910,124912,124926,124928,125124,125136,125142,125184,125259,125264,
+  	125273,126464,126467,126469,126495,126497,126498,126500,126500,126503,
   	126503,126505,126514,126516,126519,126521,126521,126523,126523,126530,
   	126530,126535,126535,126537,126537,126539,126539,126541,126543,126545,
   	126546,126548,126548,126551,126551,126553,126553,126555,126555,126557,
   	126557,126559,126559,126561,126562,126564,126564,126567,126570,126572,
   	126578,126580,126583,126585,126588,126590,126590,126592,126601,126603,
-  	126619,126625,126627,126629,126633,126635,126651,131072,173791,173824,
-  	177977,177984,178205,178208,183969,183984,191456,194560,195101,196608,
-  	201546,201552,205743,1570,0,1,1,0,0,0,0,3,1,0,0,0,0,5,1,0,0,0,0,7,1,0,
-  	0,0,0,9,1,0,0,0,0,11,1,0,0,0,0,13,1,0,0,0,0,15,1,0,0,0,0,17,1,0,0,0,0,
-  	19,1,0,0,0,0,21,1,0,0,0,0,23,1,0,0,0,0,25,1,0,0,0,0,27,1,0,0,0,0,29,1,
-  	0,0,0,0,31,1,0,0,0,0,33,1,0,0,0,0,35,1,0,0,0,0,37,1,0,0,0,0,39,1,0,0,
-  	0,0,41,1,0,0,0,0,43,1,0,0,0,0,45,1,0,0,0,0,47,1,0,0,0,0,49,1,0,0,0,0,
-  	51,1,0,0,0,0,53,1,0,0,0,0,55,1,0,0,0,0,57,1,0,0,0,0,59,1,0,0,0,0,61,1,
-  	0,0,0,0,63,1,0,0,0,0,65,1,0,0,0,0,67,1,0,0,0,0,69,1,0,0,0,0,71,1,0,0,
-  	0,0,73,1,0,0,0,0,75,1,0,0,0,0,77,1,0,0,0,0,79,1,0,0,0,0,81,1,0,0,0,0,
-  	83,1,0,0,0,0,85,1,0,0,0,0,87,1,0,0,0,0,89,1,0,0,0,0,91,1,0,0,0,0,93,1,
-  	0,0,0,0,95,1,0,0,0,0,97,1,0,0,0,0,99,1,0,0,0,0,101,1,0,0,0,0,103,1,0,
-  	0,0,0,105,1,0,0,0,0,107,1,0,0,0,0,109,1,0,0,0,0,111,1,0,0,0,0,113,1,0,
-  	0,0,0,115,1,0,0,0,0,117,1,0,0,0,0,119,1,0,0,0,0,121,1,0,0,0,0,123,1,0,
-  	0,0,0,125,1,0,0,0,0,127,1,0,0,0,0,129,1,0,0,0,0,131,1,0,0,0,0,133,1,0,
-  	0,0,0,135,1,0,0,0,0,137,1,0,0,0,0,139,1,0,0,0,0,141,1,0,0,0,0,143,1,0,
-  	0,0,0,145,1,0,0,0,0,147,1,0,0,0,0,149,1,0,0,0,0,151,1,0,0,0,0,153,1,0,
-  	0,0,0,155,1,0,0,0,0,157,1,0,0,0,0,159,1,0,0,0,0,161,1,0,0,0,0,163,1,0,
-  	0,0,0,165,1,0,0,0,0,167,1,0,0,0,0,169,1,0,0,0,0,171,1,0,0,0,0,173,1,0,
-  	0,0,0,175,1,0,0,0,0,177,1,0,0,0,0,179,1,0,0,0,0,181,1,0,0,0,0,183,1,0,
-  	0,0,0,185,1,0,0,0,0,187,1,0,0,0,0,189,1,0,0,0,0,191,1,0,0,0,0,193,1,0,
-  	0,0,0,195,1,0,0,0,0,197,1,0,0,0,0,199,1,0,0,0,0,201,1,0,0,0,0,203,1,0,
-  	0,0,0,205,1,0,0,0,0,207,1,0,0,0,0,209,1,0,0,0,0,211,1,0,0,0,0,213,1,0,
-  	0,0,0,215,1,0,0,0,0,217,1,0,0,0,0,219,1,0,0,0,0,221,1,0,0,0,0,223,1,0,
-  	0,0,0,225,1,0,0,0,0,227,1,0,0,0,0,229,1,0,0,0,0,231,1,0,0,0,0,233,1,0,
-  	0,0,0,235,1,0,0,0,0,237,1,0,0,0,0,239,1,0,0,0,0,241,1,0,0,0,0,243,1,0,
-  	0,0,0,245,1,0,0,0,0,247,1,0,0,0,0,249,1,0,0,0,0,251,1,0,0,0,0,253,1,0,
-  	0,0,0,255,1,0,0,0,0,257,1,0,0,0,0,259,1,0,0,0,0,261,1,0,0,0,0,263,1,0,
-  	0,0,0,265,1,0,0,0,0,267,1,0,0,0,0,269,1,0,0,0,0,271,1,0,0,0,0,273,1,0,
-  	0,0,0,275,1,0,0,0,0,277,1,0,0,0,0,279,1,0,0,0,0,281,1,0,0,0,0,283,1,0,
-  	0,0,0,285,1,0,0,0,0,287,1,0,0,0,0,289,1,0,0,0,0,291,1,0,0,0,0,293,1,0,
-  	0,0,0,295,1,0,0,0,0,297,1,0,0,0,0,299,1,0,0,0,0,301,1,0,0,0,0,303,1,0,
-  	0,0,0,305,1,0,0,0,0,307,1,0,0,0,0,309,1,0,0,0,0,311,1,0,0,0,0,313,1,0,
-  	0,0,0,315,1,0,0,0,0,317,1,0,0,0,0,319,1,0,0,0,0,321,1,0,0,0,0,323,1,0,
-  	0,0,0,325,1,0,0,0,0,327,1,0,0,0,0,329,1,0,0,0,0,331,1,0,0,0,0,333,1,0,
-  	0,0,0,335,1,0,0,0,0,337,1,0,0,0,0,339,1,0,0,0,0,341,1,0,0,0,0,343,1,0,
-  	0,0,0,345,1,0,0,0,0,347,1,0,0,0,0,349,1,0,0,0,0,351,1,0,0,0,0,353,1,0,
-  	0,0,0,355,1,0,0,0,0,357,1,0,0,0,0,359,1,0,0,0,0,361,1,0,0,0,0,363,1,0,
-  	0,0,0,365,1,0,0,0,0,367,1,0,0,0,0,369,1,0,0,0,0,371,1,0,0,0,0,373,1,0,
-  	0,0,0,415,1,0,0,0,1,417,1,0,0,0,3,419,1,0,0,0,5,421,1,0,0,0,7,423,1,0,
-  	0,0,9,425,1,0,0,0,11,427,1,0,0,0,13,429,1,0,0,0,15,431,1,0,0,0,17,433,
-  	1,0,0,0,19,435,1,0,0,0,21,437,1,0,0,0,23,439,1,0,0,0,25,442,1,0,0,0,27,
-  	444,1,0,0,0,29,447,1,0,0,0,31,449,1,0,0,0,33,452,1,0,0,0,35,454,1,0,0,
-  	0,37,457,1,0,0,0,39,460,1,0,0,0,41,462,1,0,0,0,43,464,1,0,0,0,45,466,
-  	1,0,0,0,47,468,1,0,0,0,49,471,1,0,0,0,51,473,1,0,0,0,53,475,1,0,0,0,55,
-  	477,1,0,0,0,57,479,1,0,0,0,59,481,1,0,0,0,61,483,1,0,0,0,63,485,1,0,0,
-  	0,65,487,1,0,0,0,67,489,1,0,0,0,69,491,1,0,0,0,71,493,1,0,0,0,73,495,
-  	1,0,0,0,75,497,1,0,0,0,77,499,1,0,0,0,79,501,1,0,0,0,81,503,1,0,0,0,83,
-  	505,1,0,0,0,85,507,1,0,0,0,87,509,1,0,0,0,89,511,1,0,0,0,91,519,1,0,0,
-  	0,93,523,1,0,0,0,95,527,1,0,0,0,97,531,1,0,0,0,99,537,1,0,0,0,101,541,
-  	1,0,0,0,103,544,1,0,0,0,105,548,1,0,0,0,107,558,1,0,0,0,109,565,1,0,0,
-  	0,111,571,1,0,0,0,113,574,1,0,0,0,115,579,1,0,0,0,117,584,1,0,0,0,119,
-  	589,1,0,0,0,121,600,1,0,0,0,123,607,1,0,0,0,125,615,1,0,0,0,127,622,1,
-  	0,0,0,129,645,1,0,0,0,131,654,1,0,0,0,133,659,1,0,0,0,135,665,1,0,0,0,
-  	137,672,1,0,0,0,139,678,1,0,0,0,141,687,1,0,0,0,143,694,1,0,0,0,145,702,
-  	1,0,0,0,147,709,1,0,0,0,149,714,1,0,0,0,151,725,1,0,0,0,153,732,1,0,0,
-  	0,155,741,1,0,0,0,157,746,1,0,0,0,159,751,1,0,0,0,161,755,1,0,0,0,163,
-  	760,1,0,0,0,165,767,1,0,0,0,167,775,1,0,0,0,169,782,1,0,0,0,171,792,1,
-  	0,0,0,173,798,1,0,0,0,175,803,1,0,0,0,177,809,1,0,0,0,179,814,1,0,0,0,
-  	181,820,1,0,0,0,183,826,1,0,0,0,185,834,1,0,0,0,187,839,1,0,0,0,189,846,
-  	1,0,0,0,191,849,1,0,0,0,193,852,1,0,0,0,195,862,1,0,0,0,197,870,1,0,0,
-  	0,199,873,1,0,0,0,201,878,1,0,0,0,203,882,1,0,0,0,205,888,1,0,0,0,207,
-  	893,1,0,0,0,209,901,1,0,0,0,211,907,1,0,0,0,213,913,1,0,0,0,215,922,1,
-  	0,0,0,217,928,1,0,0,0,219,937,1,0,0,0,221,948,1,0,0,0,223,951,1,0,0,0,
-  	225,956,1,0,0,0,227,960,1,0,0,0,229,965,1,0,0,0,231,970,1,0,0,0,233,973,
-  	1,0,0,0,235,978,1,0,0,0,237,987,1,0,0,0,239,990,1,0,0,0,241,996,1,0,0,
-  	0,243,1004,1,0,0,0,245,1012,1,0,0,0,247,1020,1,0,0,0,249,1025,1,0,0,0,
-  	251,1029,1,0,0,0,253,1036,1,0,0,0,255,1043,1,0,0,0,257,1052,1,0,0,0,259,
-  	1077,1,0,0,0,261,1086,1,0,0,0,263,1090,1,0,0,0,265,1099,1,0,0,0,267,1105,
-  	1,0,0,0,269,1112,1,0,0,0,271,1119,1,0,0,0,273,1125,1,0,0,0,275,1130,1,
-  	0,0,0,277,1133,1,0,0,0,279,1139,1,0,0,0,281,1151,1,0,0,0,283,1156,1,0,
-  	0,0,285,1161,1,0,0,0,287,1167,1,0,0,0,289,1174,1,0,0,0,291,1184,1,0,0,
-  	0,293,1191,1,0,0,0,295,1195,1,0,0,0,297,1202,1,0,0,0,299,1207,1,0,0,0,
-  	301,1213,1,0,0,0,303,1218,1,0,0,0,305,1224,1,0,0,0,307,1234,1,0,0,0,309,
-  	1238,1,0,0,0,311,1245,1,0,0,0,313,1251,1,0,0,0,315,1256,1,0,0,0,317,1265,
-  	1,0,0,0,319,1270,1,0,0,0,321,1274,1,0,0,0,323,1281,1,0,0,0,325,1289,1,
-  	0,0,0,327,1291,1,0,0,0,329,1296,1,0,0,0,331,1299,1,0,0,0,333,1301,1,0,
-  	0,0,335,1304,1,0,0,0,337,1306,1,0,0,0,339,1326,1,0,0,0,341,1328,1,0,0,
-  	0,343,1360,1,0,0,0,345,1363,1,0,0,0,347,1367,1,0,0,0,349,1371,1,0,0,0,
-  	351,1375,1,0,0,0,353,1377,1,0,0,0,355,1379,1,0,0,0,357,1403,1,0,0,0,359,
-  	1417,1,0,0,0,361,1426,1,0,0,0,363,1435,1,0,0,0,365,1439,1,0,0,0,367,1449,
-  	1,0,0,0,369,1454,1,0,0,0,371,1470,1,0,0,0,373,1501,1,0,0,0,375,1503,1,
-  	0,0,0,377,1505,1,0,0,0,379,1507,1,0,0,0,381,1509,1,0,0,0,383,1511,1,0,
-  	0,0,385,1513,1,0,0,0,387,1515,1,0,0,0,389,1517,1,0,0,0,391,1519,1,0,0,
-  	0,393,1521,1,0,0,0,395,1523,1,0,0,0,397,1525,1,0,0,0,399,1527,1,0,0,0,
-  	401,1529,1,0,0,0,403,1531,1,0,0,0,405,1533,1,0,0,0,407,1535,1,0,0,0,409,
-  	1537,1,0,0,0,411,1539,1,0,0,0,413,1541,1,0,0,0,415,1543,1,0,0,0,417,418,
-  	5,59,0,0,418,2,1,0,0,0,419,420,5,40,0,0,420,4,1,0,0,0,421,422,5,41,0,
-  	0,422,6,1,0,0,0,423,424,5,44,0,0,424,8,1,0,0,0,425,426,5,46,0,0,426,10,
-  	1,0,0,0,427,428,5,61,0,0,428,12,1,0,0,0,429,430,5,91,0,0,430,14,1,0,0,
-  	0,431,432,5,93,0,0,432,16,1,0,0,0,433,434,5,123,0,0,434,18,1,0,0,0,435,
-  	436,5,125,0,0,436,20,1,0,0,0,437,438,5,124,0,0,438,22,1,0,0,0,439,440,
-  	5,60,0,0,440,441,5,62,0,0,441,24,1,0,0,0,442,443,5,60,0,0,443,26,1,0,
-  	0,0,444,445,5,60,0,0,445,446,5,61,0,0,446,28,1,0,0,0,447,448,5,62,0,0,
-  	448,30,1,0,0,0,449,450,5,62,0,0,450,451,5,61,0,0,451,32,1,0,0,0,452,453,
-  	5,38,0,0,453,34,1,0,0,0,454,455,5,62,0,0,455,456,5,62,0,0,456,36,1,0,
-  	0,0,457,458,5,60,0,0,458,459,5,60,0,0,459,38,1,0,0,0,460,461,5,43,0,0,
-  	461,40,1,0,0,0,462,463,5,47,0,0,463,42,1,0,0,0,464,465,5,37,0,0,465,44,
-  	1,0,0,0,466,467,5,94,0,0,467,46,1,0,0,0,468,469,5,61,0,0,469,470,5,126,
-  	0,0,470,48,1,0,0,0,471,472,5,36,0,0,472,50,1,0,0,0,473,474,5,10216,0,
-  	0,474,52,1,0,0,0,475,476,5,12296,0,0,476,54,1,0,0,0,477,478,5,65124,0,
-  	0,478,56,1,0,0,0,479,480,5,65308,0,0,480,58,1,0,0,0,481,482,5,10217,0,
-  	0,482,60,1,0,0,0,483,484,5,12297,0,0,484,62,1,0,0,0,485,486,5,65125,0,
-  	0,486,64,1,0,0,0,487,488,5,65310,0,0,488,66,1,0,0,0,489,490,5,173,0,0,
-  	490,68,1,0,0,0,491,492,5,8208,0,0,492,70,1,0,0,0,493,494,5,8209,0,0,494,
-  	72,1,0,0,0,495,496,5,8210,0,0,496,74,1,0,0,0,497,498,5,8211,0,0,498,76,
-  	1,0,0,0,499,500,5,8212,0,0,500,78,1,0,0,0,501,502,5,8213,0,0,502,80,1,
-  	0,0,0,503,504,5,8722,0,0,504,82,1,0,0,0,505,506,5,65112,0,0,506,84,1,
-  	0,0,0,507,508,5,65123,0,0,508,86,1,0,0,0,509,510,5,65293,0,0,510,88,1,
-  	0,0,0,511,512,7,0,0,0,512,513,7,1,0,0,513,514,7,2,0,0,514,515,7,1,0,0,
-  	515,516,7,3,0,0,516,517,7,4,0,0,517,518,7,1,0,0,518,90,1,0,0,0,519,520,
-  	7,0,0,0,520,521,7,5,0,0,521,522,7,2,0,0,522,92,1,0,0,0,523,524,7,0,0,
-  	0,524,525,7,6,0,0,525,526,7,6,0,0,526,94,1,0,0,0,527,528,7,0,0,0,528,
-  	529,7,3,0,0,529,530,7,3,0,0,530,96,1,0,0,0,531,532,7,0,0,0,532,533,7,
-  	3,0,0,533,534,7,7,0,0,534,535,7,8,0,0,535,536,7,9,0,0,536,98,1,0,0,0,
-  	537,538,7,0,0,0,538,539,7,5,0,0,539,540,7,6,0,0,540,100,1,0,0,0,541,542,
-  	7,0,0,0,542,543,7,10,0,0,543,102,1,0,0,0,544,545,7,0,0,0,545,546,7,10,
-  	0,0,546,547,7,1,0,0,547,104,1,0,0,0,548,549,7,0,0,0,549,550,7,10,0,0,
-  	550,551,7,1,0,0,551,552,7,8,0,0,552,553,7,5,0,0,553,554,7,6,0,0,554,555,
-  	7,4,0,0,555,556,7,5,0,0,556,557,7,11,0,0,557,106,1,0,0,0,558,559,7,0,
-  	0,0,559,560,7,7,0,0,560,561,7,7,0,0,561,562,7,0,0,0,562,563,7,1,0,0,563,
-  	564,7,12,0,0,564,108,1,0,0,0,565,566,7,13,0,0,566,567,7,8,0,0,567,568,
-  	7,11,0,0,568,569,7,4,0,0,569,570,7,5,0,0,570,110,1,0,0,0,571,572,7,13,
-  	0,0,572,573,7,2,0,0,573,112,1,0,0,0,574,575,7,1,0,0,575,576,7,0,0,0,576,
-  	577,7,3,0,0,577,578,7,3,0,0,578,114,1,0,0,0,579,580,7,1,0,0,580,581,7,
-  	0,0,0,581,582,7,10,0,0,582,583,7,8,0,0,583,116,1,0,0,0,584,585,7,1,0,
-  	0,585,586,7,0,0,0,586,587,7,10,0,0,587,588,7,7,0,0,588,118,1,0,0,0,589,
-  	590,7,1,0,0,590,591,7,12,0,0,591,592,7,8,0,0,592,593,7,1,0,0,593,594,
-  	7,14,0,0,594,595,7,15,0,0,595,596,7,16,0,0,596,597,7,4,0,0,597,598,7,
-  	5,0,0,598,599,7,7,0,0,599,120,1,0,0,0,600,601,7,1,0,0,601,602,7,16,0,
-  	0,602,603,7,3,0,0,603,604,7,17,0,0,604,605,7,18,0,0,605,606,7,5,0,0,606,
-  	122,1,0,0,0,607,608,7,1,0,0,608,609,7,16,0,0,609,610,7,18,0,0,610,611,
-  	7,18,0,0,611,612,7,8,0,0,612,613,7,5,0,0,613,614,7,7,0,0,614,124,1,0,
-  	0,0,615,616,7,1,0,0,616,617,7,16,0,0,617,618,7,18,0,0,618,619,7,18,0,
-  	0,619,620,7,4,0,0,620,621,7,7,0,0,621,126,1,0,0,0,622,623,7,1,0,0,623,
-  	624,7,16,0,0,624,625,7,18,0,0,625,626,7,18,0,0,626,627,7,4,0,0,627,628,
-  	7,7,0,0,628,629,5,95,0,0,629,630,7,10,0,0,630,631,7,14,0,0,631,632,7,
-  	4,0,0,632,633,7,15,0,0,633,634,5,95,0,0,634,635,7,1,0,0,635,636,7,12,
-  	0,0,636,637,7,8,0,0,637,638,7,1,0,0,638,639,7,14,0,0,639,640,7,15,0,0,
-  	640,641,7,16,0,0,641,642,7,4,0,0,642,643,7,5,0,0,643,644,7,7,0,0,644,
-  	128,1,0,0,0,645,646,7,1,0,0,646,647,7,16,0,0,647,648,7,5,0,0,648,649,
-  	7,7,0,0,649,650,7,0,0,0,650,651,7,4,0,0,651,652,7,5,0,0,652,653,7,10,
-  	0,0,653,130,1,0,0,0,654,655,7,1,0,0,655,656,7,16,0,0,656,657,7,15,0,0,
-  	657,658,7,2,0,0,658,132,1,0,0,0,659,660,7,1,0,0,660,661,7,16,0,0,661,
-  	662,7,17,0,0,662,663,7,5,0,0,663,664,7,7,0,0,664,134,1,0,0,0,665,666,
-  	7,1,0,0,666,667,7,9,0,0,667,668,7,8,0,0,668,669,7,0,0,0,669,670,7,7,0,
-  	0,670,671,7,8,0,0,671,136,1,0,0,0,672,673,7,1,0,0,673,674,7,2,0,0,674,
-  	675,7,1,0,0,675,676,7,3,0,0,676,677,7,8,0,0,677,138,1,0,0,0,678,679,7,
-  	6,0,0,679,680,7,0,0,0,680,681,7,7,0,0,681,682,7,0,0,0,682,683,7,13,0,
-  	0,683,684,7,0,0,0,684,685,7,10,0,0,685,686,7,8,0,0,686,140,1,0,0,0,687,
-  	688,7,6,0,0,688,689,7,13,0,0,689,690,7,7,0,0,690,691,7,2,0,0,691,692,
-  	7,15,0,0,692,693,7,8,0,0,693,142,1,0,0,0,694,695,7,6,0,0,695,696,7,8,
-  	0,0,696,697,7,19,0,0,697,698,7,0,0,0,698,699,7,17,0,0,699,700,7,3,0,0,
-  	700,701,7,7,0,0,701,144,1,0,0,0,702,703,7,6,0,0,703,704,7,8,0,0,704,705,
-  	7,3,0,0,705,706,7,8,0,0,706,707,7,7,0,0,707,708,7,8,0,0,708,146,1,0,0,
-  	0,709,710,7,6,0,0,710,711,7,8,0,0,711,712,7,10,0,0,712,713,7,1,0,0,713,
-  	148,1,0,0,0,714,715,7,6,0,0,715,716,7,8,0,0,716,717,7,10,0,0,717,718,
-  	7,1,0,0,718,719,7,8,0,0,719,720,7,5,0,0,720,721,7,6,0,0,721,722,7,4,0,
-  	0,722,723,7,5,0,0,723,724,7,11,0,0,724,150,1,0,0,0,725,726,7,6,0,0,726,
-  	727,7,8,0,0,727,728,7,7,0,0,728,729,7,0,0,0,729,730,7,1,0,0,730,731,7,
-  	12,0,0,731,152,1,0,0,0,732,733,7,6,0,0,733,734,7,4,0,0,734,735,7,10,0,
-  	0,735,736,7,7,0,0,736,737,7,4,0,0,737,738,7,5,0,0,738,739,7,1,0,0,739,
-  	740,7,7,0,0,740,154,1,0,0,0,741,742,7,6,0,0,742,743,7,9,0,0,743,744,7,
-  	16,0,0,744,745,7,15,0,0,745,156,1,0,0,0,746,747,7,8,0,0,747,748,7,3,0,
-  	0,748,749,7,10,0,0,749,750,7,8,0,0,750,158,1,0,0,0,751,752,7,8,0,0,752,
-  	753,7,5,0,0,753,754,7,6,0,0,754,160,1,0,0,0,755,756,7,8,0,0,756,757,7,
-  	5,0,0,757,758,7,6,0,0,758,759,7,10,0,0,759,162,1,0,0,0,760,761,7,8,0,
-  	0,761,762,7,20,0,0,762,763,7,4,0,0,763,764,7,10,0,0,764,765,7,7,0,0,765,
-  	766,7,10,0,0,766,164,1,0,0,0,767,768,7,8,0,0,768,769,7,20,0,0,769,770,
-  	7,15,0,0,770,771,7,3,0,0,771,772,7,0,0,0,772,773,7,4,0,0,773,774,7,5,
-  	0,0,774,166,1,0,0,0,775,776,7,8,0,0,776,777,7,20,0,0,777,778,7,15,0,0,
-  	778,779,7,16,0,0,779,780,7,9,0,0,780,781,7,7,0,0,781,168,1,0,0,0,782,
-  	783,7,8,0,0,783,784,7,20,0,0,784,785,7,7,0,0,785,786,7,8,0,0,786,787,
-  	7,5,0,0,787,788,7,10,0,0,788,789,7,4,0,0,789,790,7,16,0,0,790,791,7,5,
-  	0,0,791,170,1,0,0,0,792,793,7,19,0,0,793,794,7,0,0,0,794,795,7,3,0,0,
-  	795,796,7,10,0,0,796,797,7,8,0,0,797,172,1,0,0,0,798,799,7,19,0,0,799,
-  	800,7,9,0,0,800,801,7,16,0,0,801,802,7,18,0,0,802,174,1,0,0,0,803,804,
-  	7,19,0,0,804,805,7,16,0,0,805,806,7,9,0,0,806,807,7,1,0,0,807,808,7,8,
-  	0,0,808,176,1,0,0,0,809,810,7,11,0,0,810,811,7,3,0,0,811,812,7,16,0,0,
-  	812,813,7,13,0,0,813,178,1,0,0,0,814,815,7,11,0,0,815,816,7,9,0,0,816,
-  	817,7,0,0,0,817,818,7,15,0,0,818,819,7,12,0,0,819,180,1,0,0,0,820,821,
-  	7,11,0,0,821,822,7,9,0,0,822,823,7,16,0,0,823,824,7,17,0,0,824,825,7,
-  	15,0,0,825,182,1,0,0,0,826,827,7,12,0,0,827,828,7,8,0,0,828,829,7,0,0,
-  	0,829,830,7,6,0,0,830,831,7,8,0,0,831,832,7,9,0,0,832,833,7,10,0,0,833,
-  	184,1,0,0,0,834,835,7,12,0,0,835,836,7,4,0,0,836,837,7,5,0,0,837,838,
-  	7,7,0,0,838,186,1,0,0,0,839,840,7,4,0,0,840,841,7,18,0,0,841,842,7,15,
-  	0,0,842,843,7,16,0,0,843,844,7,9,0,0,844,845,7,7,0,0,845,188,1,0,0,0,
-  	846,847,7,4,0,0,847,848,7,19,0,0,848,190,1,0,0,0,849,850,7,4,0,0,850,
-  	851,7,5,0,0,851,192,1,0,0,0,852,853,7,4,0,0,853,854,7,5,0,0,854,855,7,
-  	1,0,0,855,856,7,9,0,0,856,857,7,8,0,0,857,858,7,18,0,0,858,859,7,8,0,
-  	0,859,860,7,5,0,0,860,861,7,7,0,0,861,194,1,0,0,0,862,863,7,4,0,0,863,
-  	864,7,5,0,0,864,865,7,10,0,0,865,866,7,7,0,0,866,867,7,0,0,0,867,868,
-  	7,3,0,0,868,869,7,3,0,0,869,196,1,0,0,0,870,871,7,4,0,0,871,872,7,10,
-  	0,0,872,198,1,0,0,0,873,874,7,21,0,0,874,875,7,16,0,0,875,876,7,4,0,0,
-  	876,877,7,5,0,0,877,200,1,0,0,0,878,879,7,14,0,0,879,880,7,8,0,0,880,
-  	881,7,2,0,0,881,202,1,0,0,0,882,883,7,3,0,0,883,884,7,4,0,0,884,885,7,
-  	18,0,0,885,886,7,4,0,0,886,887,7,7,0,0,887,204,1,0,0,0,888,889,7,3,0,
-  	0,889,890,7,16,0,0,890,891,7,0,0,0,891,892,7,6,0,0,892,206,1,0,0,0,893,
-  	894,7,3,0,0,894,895,7,16,0,0,895,896,7,11,0,0,896,897,7,4,0,0,897,898,
-  	7,1,0,0,898,899,7,0,0,0,899,900,7,3,0,0,900,208,1,0,0,0,901,902,7,18,
-  	0,0,902,903,7,0,0,0,903,904,7,1,0,0,904,905,7,9,0,0,905,906,7,16,0,0,
-  	906,210,1,0,0,0,907,908,7,18,0,0,908,909,7,0,0,0,909,910,7,7,0,0,910,
-  	911,7,1,0,0,911,912,7,12,0,0,912,212,1,0,0,0,913,914,7,18,0,0,914,915,
-  	7,0,0,0,915,916,7,20,0,0,916,917,7,22,0,0,917,918,7,0,0,0,918,919,7,3,
-  	0,0,919,920,7,17,0,0,920,921,7,8,0,0,921,214,1,0,0,0,922,923,7,18,0,0,
-  	923,924,7,8,0,0,924,925,7,9,0,0,925,926,7,11,0,0,926,927,7,8,0,0,927,
-  	216,1,0,0,0,928,929,7,18,0,0,929,930,7,4,0,0,930,931,7,5,0,0,931,932,
-  	7,22,0,0,932,933,7,0,0,0,933,934,7,3,0,0,934,935,7,17,0,0,935,936,7,8,
-  	0,0,936,218,1,0,0,0,937,938,7,18,0,0,938,939,7,17,0,0,939,940,7,3,0,0,
-  	940,941,7,7,0,0,941,942,7,4,0,0,942,943,5,95,0,0,943,944,7,21,0,0,944,
-  	945,7,16,0,0,945,946,7,4,0,0,946,947,7,5,0,0,947,220,1,0,0,0,948,949,
-  	7,5,0,0,949,950,7,16,0,0,950,222,1,0,0,0,951,952,7,5,0,0,952,953,7,16,
-  	0,0,953,954,7,6,0,0,954,955,7,8,0,0,955,224,1,0,0,0,956,957,7,5,0,0,957,
-  	958,7,16,0,0,958,959,7,7,0,0,959,226,1,0,0,0,960,961,7,5,0,0,961,962,
-  	7,16,0,0,962,963,7,5,0,0,963,964,7,8,0,0,964,228,1,0,0,0,965,966,7,5,
-  	0,0,966,967,7,17,0,0,967,968,7,3,0,0,968,969,7,3,0,0,969,230,1,0,0,0,
-  	970,971,7,16,0,0,971,972,7,5,0,0,972,232,1,0,0,0,973,974,7,16,0,0,974,
-  	975,7,5,0,0,975,976,7,3,0,0,976,977,7,2,0,0,977,234,1,0,0,0,978,979,7,
-  	16,0,0,979,980,7,15,0,0,980,981,7,7,0,0,981,982,7,4,0,0,982,983,7,16,
-  	0,0,983,984,7,5,0,0,984,985,7,0,0,0,985,986,7,3,0,0,986,236,1,0,0,0,987,
-  	988,7,16,0,0,988,989,7,9,0,0,989,238,1,0,0,0,990,991,7,16,0,0,991,992,
-  	7,9,0,0,992,993,7,6,0,0,993,994,7,8,0,0,994,995,7,9,0,0,995,240,1,0,0,
-  	0,996,997,7,15,0,0,997,998,7,9,0,0,998,999,7,4,0,0,999,1000,7,18,0,0,
-  	1000,1001,7,0,0,0,1001,1002,7,9,0,0,1002,1003,7,2,0,0,1003,242,1,0,0,
-  	0,1004,1005,7,15,0,0,1005,1006,7,9,0,0,1006,1007,7,16,0,0,1007,1008,7,
-  	19,0,0,1008,1009,7,4,0,0,1009,1010,7,3,0,0,1010,1011,7,8,0,0,1011,244,
+  	126619,126625,126627,126629,126633,126635,126651,130032,130041,131072,
+  	173791,173824,177977,177984,178205,178208,183969,183984,191456,194560,
+  	195101,196608,201546,201552,205743,917760,917999,1,0,42,42,2,0,39,39,
+  	92,92,2,0,10,10,13,13,1,0,47,47,1,0,29,29,1,0,28,28,1,0,13,13,21,0,36,
+  	36,162,165,1423,1423,1547,1547,2046,2047,2546,2547,2555,2555,2801,2801,
+  	3065,3065,3647,3647,6107,6107,8352,8384,43064,43064,65020,65020,65129,
+  	65129,65284,65284,65504,65505,65509,65510,73693,73696,123647,123647,126128,
+  	126128,1,0,32,32,6,0,95,95,8255,8256,8276,8276,65075,65076,65101,65103,
+  	65343,65343,1,0,9,9,2,0,34,34,92,92,1,0,10,10,1,0,11,11,1,0,31,31,659,
+  	0,65,90,97,122,170,170,181,181,186,186,192,214,216,246,248,705,710,721,
+  	736,740,748,748,750,750,880,884,886,887,890,893,895,895,902,902,904,906,
+  	908,908,910,929,931,1013,1015,1153,1162,1327,1329,1366,1369,1369,1376,
+  	1416,1488,1514,1519,1522,1568,1610,1646,1647,1649,1747,1749,1749,1765,
+  	1766,1774,1775,1786,1788,1791,1791,1808,1808,1810,1839,1869,1957,1969,
+  	1969,1994,2026,2036,2037,2042,2042,2048,2069,2074,2074,2084,2084,2088,
+  	2088,2112,2136,2144,2154,2160,2183,2185,2190,2208,2249,2308,2361,2365,
+  	2365,2384,2384,2392,2401,2417,2432,2437,2444,2447,2448,2451,2472,2474,
+  	2480,2482,2482,2486,2489,2493,2493,2510,2510,2524,2525,2527,2529,2544,
+  	2545,2556,2556,2565,2570,2575,2576,2579,2600,2602,2608,2610,2611,2613,
+  	2614,2616,2617,2649,2652,2654,2654,2674,2676,2693,2701,2703,2705,2707,
+  	2728,2730,2736,2738,2739,2741,2745,2749,2749,2768,2768,2784,2785,2809,
+  	2809,2821,2828,2831,2832,2835,2856,2858,2864,2866,2867,2869,2873,2877,
+  	2877,2908,2909,2911,2913,2929,2929,2947,2947,2949,2954,2958,2960,2962,
+  	2965,2969,2970,2972,2972,2974,2975,2979,2980,2984,2986,2990,3001,3024,
+  	3024,3077,3084,3086,3088,3090,3112,3114,3129,3133,3133,3160,3162,3165,
+  	3165,3168,3169,3200,3200,3205,3212,3214,3216,3218,3240,3242,3251,3253,
+  	3257,3261,3261,3293,3294,3296,3297,3313,3314,3332,3340,3342,3344,3346,
+  	3386,3389,3389,3406,3406,3412,3414,3423,3425,3450,3455,3461,3478,3482,
+  	3505,3507,3515,3517,3517,3520,3526,3585,3632,3634,3635,3648,3654,3713,
+  	3714,3716,3716,3718,3722,3724,3747,3749,3749,3751,3760,3762,3763,3773,
+  	3773,3776,3780,3782,3782,3804,3807,3840,3840,3904,3911,3913,3948,3976,
+  	3980,4096,4138,4159,4159,4176,4181,4186,4189,4193,4193,4197,4198,4206,
+  	4208,4213,4225,4238,4238,4256,4293,4295,4295,4301,4301,4304,4346,4348,
+  	4680,4682,4685,4688,4694,4696,4696,4698,4701,4704,4744,4746,4749,4752,
+  	4784,4786,4789,4792,4798,4800,4800,4802,4805,4808,4822,4824,4880,4882,
+  	4885,4888,4954,4992,5007,5024,5109,5112,5117,5121,5740,5743,5759,5761,
+  	5786,5792,5866,5870,5880,5888,5905,5919,5937,5952,5969,5984,5996,5998,
+  	6000,6016,6067,6103,6103,6108,6108,6176,6264,6272,6312,6314,6314,6320,
+  	6389,6400,6430,6480,6509,6512,6516,6528,6571,6576,6601,6656,6678,6688,
+  	6740,6823,6823,6917,6963,6981,6988,7043,7072,7086,7087,7098,7141,7168,
+  	7203,7245,7247,7258,7293,7296,7304,7312,7354,7357,7359,7401,7404,7406,
+  	7411,7413,7414,7418,7418,7424,7615,7680,7957,7960,7965,7968,8005,8008,
+  	8013,8016,8023,8025,8025,8027,8027,8029,8029,8031,8061,8064,8116,8118,
+  	8124,8126,8126,8130,8132,8134,8140,8144,8147,8150,8155,8160,8172,8178,
+  	8180,8182,8188,8305,8305,8319,8319,8336,8348,8450,8450,8455,8455,8458,
+  	8467,8469,8469,8472,8477,8484,8484,8486,8486,8488,8488,8490,8505,8508,
+  	8511,8517,8521,8526,8526,8544,8584,11264,11492,11499,11502,11506,11507,
+  	11520,11557,11559,11559,11565,11565,11568,11623,11631,11631,11648,11670,
+  	11680,11686,11688,11694,11696,11702,11704,11710,11712,11718,11720,11726,
+  	11728,11734,11736,11742,12293,12295,12321,12329,12337,12341,12344,12348,
+  	12353,12438,12443,12447,12449,12538,12540,12543,12549,12591,12593,12686,
+  	12704,12735,12784,12799,13312,19903,19968,42124,42192,42237,42240,42508,
+  	42512,42527,42538,42539,42560,42606,42623,42653,42656,42735,42775,42783,
+  	42786,42888,42891,42954,42960,42961,42963,42963,42965,42969,42994,43009,
+  	43011,43013,43015,43018,43020,43042,43072,43123,43138,43187,43250,43255,
+  	43259,43259,43261,43262,43274,43301,43312,43334,43360,43388,43396,43442,
+  	43471,43471,43488,43492,43494,43503,43514,43518,43520,43560,43584,43586,
+  	43588,43595,43616,43638,43642,43642,43646,43695,43697,43697,43701,43702,
+  	43705,43709,43712,43712,43714,43714,43739,43741,43744,43754,43762,43764,
+  	43777,43782,43785,43790,43793,43798,43808,43814,43816,43822,43824,43866,
+  	43868,43881,43888,44002,44032,55203,55216,55238,55243,55291,63744,64109,
+  	64112,64217,64256,64262,64275,64279,64285,64285,64287,64296,64298,64310,
+  	64312,64316,64318,64318,64320,64321,64323,64324,64326,64433,64467,64829,
+  	64848,64911,64914,64967,65008,65019,65136,65140,65142,65276,65313,65338,
+  	65345,65370,65382,65470,65474,65479,65482,65487,65490,65495,65498,65500,
+  	65536,65547,65549,65574,65576,65594,65596,65597,65599,65613,65616,65629,
+  	65664,65786,65856,65908,66176,66204,66208,66256,66304,66335,66349,66378,
+  	66384,66421,66432,66461,66464,66499,66504,66511,66513,66517,66560,66717,
+  	66736,66771,66776,66811,66816,66855,66864,66915,66928,66938,66940,66954,
+  	66956,66962,66964,66965,66967,66977,66979,66993,66995,67001,67003,67004,
+  	67072,67382,67392,67413,67424,67431,67456,67461,67463,67504,67506,67514,
+  	67584,67589,67592,67592,67594,67637,67639,67640,67644,67644,67647,67669,
+  	67680,67702,67712,67742,67808,67826,67828,67829,67840,67861,67872,67897,
+  	67968,68023,68030,68031,68096,68096,68112,68115,68117,68119,68121,68149,
+  	68192,68220,68224,68252,68288,68295,68297,68324,68352,68405,68416,68437,
+  	68448,68466,68480,68497,68608,68680,68736,68786,68800,68850,68864,68899,
+  	69248,69289,69296,69297,69376,69404,69415,69415,69424,69445,69488,69505,
+  	69552,69572,69600,69622,69635,69687,69745,69746,69749,69749,69763,69807,
+  	69840,69864,69891,69926,69956,69956,69959,69959,69968,70002,70006,70006,
+  	70019,70066,70081,70084,70106,70106,70108,70108,70144,70161,70163,70187,
+  	70207,70208,70272,70278,70280,70280,70282,70285,70287,70301,70303,70312,
+  	70320,70366,70405,70412,70415,70416,70419,70440,70442,70448,70450,70451,
+  	70453,70457,70461,70461,70480,70480,70493,70497,70656,70708,70727,70730,
+  	70751,70753,70784,70831,70852,70853,70855,70855,71040,71086,71128,71131,
+  	71168,71215,71236,71236,71296,71338,71352,71352,71424,71450,71488,71494,
+  	71680,71723,71840,71903,71935,71942,71945,71945,71948,71955,71957,71958,
+  	71960,71983,71999,71999,72001,72001,72096,72103,72106,72144,72161,72161,
+  	72163,72163,72192,72192,72203,72242,72250,72250,72272,72272,72284,72329,
+  	72349,72349,72368,72440,72704,72712,72714,72750,72768,72768,72818,72847,
+  	72960,72966,72968,72969,72971,73008,73030,73030,73056,73061,73063,73064,
+  	73066,73097,73112,73112,73440,73458,73474,73474,73476,73488,73490,73523,
+  	73648,73648,73728,74649,74752,74862,74880,75075,77712,77808,77824,78895,
+  	78913,78918,82944,83526,92160,92728,92736,92766,92784,92862,92880,92909,
+  	92928,92975,92992,92995,93027,93047,93053,93071,93760,93823,93952,94026,
+  	94032,94032,94099,94111,94176,94177,94179,94179,94208,100343,100352,101589,
+  	101632,101640,110576,110579,110581,110587,110589,110590,110592,110882,
+  	110898,110898,110928,110930,110933,110933,110948,110951,110960,111355,
+  	113664,113770,113776,113788,113792,113800,113808,113817,119808,119892,
+  	119894,119964,119966,119967,119970,119970,119973,119974,119977,119980,
+  	119982,119993,119995,119995,119997,120003,120005,120069,120071,120074,
+  	120077,120084,120086,120092,120094,120121,120123,120126,120128,120132,
+  	120134,120134,120138,120144,120146,120485,120488,120512,120514,120538,
+  	120540,120570,120572,120596,120598,120628,120630,120654,120656,120686,
+  	120688,120712,120714,120744,120746,120770,120772,120779,122624,122654,
+  	122661,122666,122928,122989,123136,123180,123191,123197,123214,123214,
+  	123536,123565,123584,123627,124112,124139,124896,124902,124904,124907,
+  	124909,124910,124912,124926,124928,125124,125184,125251,125259,125259,
+  	126464,126467,126469,126495,126497,126498,126500,126500,126503,126503,
+  	126505,126514,126516,126519,126521,126521,126523,126523,126530,126530,
+  	126535,126535,126537,126537,126539,126539,126541,126543,126545,126546,
+  	126548,126548,126551,126551,126553,126553,126555,126555,126557,126557,
+  	126559,126559,126561,126562,126564,126564,126567,126570,126572,126578,
+  	126580,126583,126585,126588,126590,126590,126592,126601,126603,126619,
+  	126625,126627,126629,126633,126635,126651,131072,173791,173824,177977,
+  	177984,178205,178208,183969,183984,191456,194560,195101,196608,201546,
+  	201552,205743,1578,0,1,1,0,0,0,0,3,1,0,0,0,0,5,1,0,0,0,0,7,1,0,0,0,0,
+  	9,1,0,0,0,0,11,1,0,0,0,0,13,1,0,0,0,0,15,1,0,0,0,0,17,1,0,0,0,0,19,1,
+  	0,0,0,0,21,1,0,0,0,0,23,1,0,0,0,0,25,1,0,0,0,0,27,1,0,0,0,0,29,1,0,0,
+  	0,0,31,1,0,0,0,0,33,1,0,0,0,0,35,1,0,0,0,0,37,1,0,0,0,0,39,1,0,0,0,0,
+  	41,1,0,0,0,0,43,1,0,0,0,0,45,1,0,0,0,0,47,1,0,0,0,0,49,1,0,0,0,0,51,1,
+  	0,0,0,0,53,1,0,0,0,0,55,1,0,0,0,0,57,1,0,0,0,0,59,1,0,0,0,0,61,1,0,0,
+  	0,0,63,1,0,0,0,0,65,1,0,0,0,0,67,1,0,0,0,0,69,1,0,0,0,0,71,1,0,0,0,0,
+  	73,1,0,0,0,0,75,1,0,0,0,0,77,1,0,0,0,0,79,1,0,0,0,0,81,1,0,0,0,0,83,1,
+  	0,0,0,0,85,1,0,0,0,0,87,1,0,0,0,0,89,1,0,0,0,0,91,1,0,0,0,0,93,1,0,0,
+  	0,0,95,1,0,0,0,0,97,1,0,0,0,0,99,1,0,0,0,0,101,1,0,0,0,0,103,1,0,0,0,
+  	0,105,1,0,0,0,0,107,1,0,0,0,0,109,1,0,0,0,0,111,1,0,0,0,0,1545,1,0,0,
+  	0,0,113,1,0,0,0,0,115,1,0,0,0,0,117,1,0,0,0,0,119,1,0,0,0,0,121,1,0,0,
+  	0,0,123,1,0,0,0,0,125,1,0,0,0,0,127,1,0,0,0,0,129,1,0,0,0,0,131,1,0,0,
+  	0,0,133,1,0,0,0,0,135,1,0,0,0,0,137,1,0,0,0,0,139,1,0,0,0,0,141,1,0,0,
+  	0,0,143,1,0,0,0,0,145,1,0,0,0,0,147,1,0,0,0,0,149,1,0,0,0,0,151,1,0,0,
+  	0,0,153,1,0,0,0,0,155,1,0,0,0,0,157,1,0,0,0,0,159,1,0,0,0,0,161,1,0,0,
+  	0,0,163,1,0,0,0,0,165,1,0,0,0,0,167,1,0,0,0,0,169,1,0,0,0,0,171,1,0,0,
+  	0,0,173,1,0,0,0,0,175,1,0,0,0,0,177,1,0,0,0,0,179,1,0,0,0,0,181,1,0,0,
+  	0,0,183,1,0,0,0,0,185,1,0,0,0,0,187,1,0,0,0,0,189,1,0,0,0,0,191,1,0,0,
+  	0,0,193,1,0,0,0,0,195,1,0,0,0,0,197,1,0,0,0,0,199,1,0,0,0,0,201,1,0,0,
+  	0,0,203,1,0,0,0,0,205,1,0,0,0,0,207,1,0,0,0,0,209,1,0,0,0,0,211,1,0,0,
+  	0,0,213,1,0,0,0,0,215,1,0,0,0,0,217,1,0,0,0,0,219,1,0,0,0,0,221,1,0,0,
+  	0,0,223,1,0,0,0,0,225,1,0,0,0,0,227,1,0,0,0,0,229,1,0,0,0,0,231,1,0,0,
+  	0,0,233,1,0,0,0,0,235,1,0,0,0,0,237,1,0,0,0,0,239,1,0,0,0,0,241,1,0,0,
+  	0,0,243,1,0,0,0,0,245,1,0,0,0,0,247,1,0,0,0,0,249,1,0,0,0,0,251,1,0,0,
+  	0,0,253,1,0,0,0,0,255,1,0,0,0,0,257,1,0,0,0,0,259,1,0,0,0,0,261,1,0,0,
+  	0,0,263,1,0,0,0,0,265,1,0,0,0,0,267,1,0,0,0,0,269,1,0,0,0,0,271,1,0,0,
+  	0,0,273,1,0,0,0,0,275,1,0,0,0,0,277,1,0,0,0,0,279,1,0,0,0,0,281,1,0,0,
+  	0,0,283,1,0,0,0,0,285,1,0,0,0,0,287,1,0,0,0,0,289,1,0,0,0,0,291,1,0,0,
+  	0,0,293,1,0,0,0,0,295,1,0,0,0,0,297,1,0,0,0,0,299,1,0,0,0,0,301,1,0,0,
+  	0,0,303,1,0,0,0,0,305,1,0,0,0,0,307,1,0,0,0,0,309,1,0,0,0,0,311,1,0,0,
+  	0,0,313,1,0,0,0,0,315,1,0,0,0,0,317,1,0,0,0,0,319,1,0,0,0,0,321,1,0,0,
+  	0,0,323,1,0,0,0,0,325,1,0,0,0,0,327,1,0,0,0,0,329,1,0,0,0,0,331,1,0,0,
+  	0,0,333,1,0,0,0,0,335,1,0,0,0,0,337,1,0,0,0,0,339,1,0,0,0,0,341,1,0,0,
+  	0,0,343,1,0,0,0,0,345,1,0,0,0,0,347,1,0,0,0,0,349,1,0,0,0,0,351,1,0,0,
+  	0,0,353,1,0,0,0,0,355,1,0,0,0,0,357,1,0,0,0,0,359,1,0,0,0,0,361,1,0,0,
+  	0,0,363,1,0,0,0,0,365,1,0,0,0,0,367,1,0,0,0,0,369,1,0,0,0,0,371,1,0,0,
+  	0,0,373,1,0,0,0,0,415,1,0,0,0,1,417,1,0,0,0,3,419,1,0,0,0,5,421,1,0,0,
+  	0,7,423,1,0,0,0,9,425,1,0,0,0,11,427,1,0,0,0,13,429,1,0,0,0,15,431,1,
+  	0,0,0,17,433,1,0,0,0,19,435,1,0,0,0,21,437,1,0,0,0,23,439,1,0,0,0,25,
+  	442,1,0,0,0,27,444,1,0,0,0,29,447,1,0,0,0,31,449,1,0,0,0,33,452,1,0,0,
+  	0,35,454,1,0,0,0,37,457,1,0,0,0,39,460,1,0,0,0,41,462,1,0,0,0,43,464,
+  	1,0,0,0,45,466,1,0,0,0,47,468,1,0,0,0,49,471,1,0,0,0,51,473,1,0,0,0,53,
+  	475,1,0,0,0,55,477,1,0,0,0,57,479,1,0,0,0,59,481,1,0,0,0,61,483,1,0,0,
+  	0,63,485,1,0,0,0,65,487,1,0,0,0,67,489,1,0,0,0,69,491,1,0,0,0,71,493,
+  	1,0,0,0,73,495,1,0,0,0,75,497,1,0,0,0,77,499,1,0,0,0,79,501,1,0,0,0,81,
+  	503,1,0,0,0,83,505,1,0,0,0,85,507,1,0,0,0,87,509,1,0,0,0,89,511,1,0,0,
+  	0,91,519,1,0,0,0,93,523,1,0,0,0,95,527,1,0,0,0,97,531,1,0,0,0,99,537,
+  	1,0,0,0,101,541,1,0,0,0,103,544,1,0,0,0,105,548,1,0,0,0,107,558,1,0,0,
+  	0,109,565,1,0,0,0,111,571,1,0,0,0,113,574,1,0,0,0,115,579,1,0,0,0,117,
+  	584,1,0,0,0,119,589,1,0,0,0,121,600,1,0,0,0,123,607,1,0,0,0,125,615,1,
+  	0,0,0,127,622,1,0,0,0,129,645,1,0,0,0,131,654,1,0,0,0,133,659,1,0,0,0,
+  	135,665,1,0,0,0,137,672,1,0,0,0,139,678,1,0,0,0,141,687,1,0,0,0,143,694,
+  	1,0,0,0,145,702,1,0,0,0,147,709,1,0,0,0,149,714,1,0,0,0,151,725,1,0,0,
+  	0,153,732,1,0,0,0,155,741,1,0,0,0,157,746,1,0,0,0,159,751,1,0,0,0,161,
+  	755,1,0,0,0,163,760,1,0,0,0,165,767,1,0,0,0,167,775,1,0,0,0,169,782,1,
+  	0,0,0,171,792,1,0,0,0,173,798,1,0,0,0,175,803,1,0,0,0,177,809,1,0,0,0,
+  	179,814,1,0,0,0,181,820,1,0,0,0,183,826,1,0,0,0,185,834,1,0,0,0,187,839,
+  	1,0,0,0,189,846,1,0,0,0,191,849,1,0,0,0,193,852,1,0,0,0,195,862,1,0,0,
+  	0,197,870,1,0,0,0,199,873,1,0,0,0,201,878,1,0,0,0,203,882,1,0,0,0,205,
+  	888,1,0,0,0,207,893,1,0,0,0,209,901,1,0,0,0,211,907,1,0,0,0,213,913,1,
+  	0,0,0,215,922,1,0,0,0,217,928,1,0,0,0,219,937,1,0,0,0,221,948,1,0,0,0,
+  	223,951,1,0,0,0,225,956,1,0,0,0,227,960,1,0,0,0,229,965,1,0,0,0,231,970,
+  	1,0,0,0,233,973,1,0,0,0,235,978,1,0,0,0,237,987,1,0,0,0,239,990,1,0,0,
+  	0,241,996,1,0,0,0,243,1004,1,0,0,0,245,1012,1,0,0,0,247,1020,1,0,0,0,
+  	249,1025,1,0,0,0,251,1029,1,0,0,0,253,1036,1,0,0,0,255,1043,1,0,0,0,257,
+  	1052,1,0,0,0,259,1077,1,0,0,0,261,1086,1,0,0,0,263,1090,1,0,0,0,265,1099,
+  	1,0,0,0,267,1105,1,0,0,0,269,1112,1,0,0,0,271,1119,1,0,0,0,273,1125,1,
+  	0,0,0,275,1130,1,0,0,0,277,1133,1,0,0,0,279,1139,1,0,0,0,281,1151,1,0,
+  	0,0,283,1156,1,0,0,0,285,1161,1,0,0,0,287,1167,1,0,0,0,289,1174,1,0,0,
+  	0,291,1184,1,0,0,0,293,1191,1,0,0,0,295,1195,1,0,0,0,297,1202,1,0,0,0,
+  	299,1207,1,0,0,0,301,1213,1,0,0,0,303,1218,1,0,0,0,305,1224,1,0,0,0,307,
+  	1234,1,0,0,0,309,1238,1,0,0,0,311,1245,1,0,0,0,313,1251,1,0,0,0,315,1256,
+  	1,0,0,0,317,1265,1,0,0,0,319,1270,1,0,0,0,321,1274,1,0,0,0,323,1281,1,
+  	0,0,0,325,1289,1,0,0,0,327,1291,1,0,0,0,329,1296,1,0,0,0,331,1299,1,0,
+  	0,0,333,1301,1,0,0,0,335,1304,1,0,0,0,337,1306,1,0,0,0,339,1326,1,0,0,
+  	0,341,1328,1,0,0,0,343,1360,1,0,0,0,345,1363,1,0,0,0,347,1367,1,0,0,0,
+  	349,1371,1,0,0,0,351,1375,1,0,0,0,353,1377,1,0,0,0,355,1379,1,0,0,0,357,
+  	1403,1,0,0,0,359,1417,1,0,0,0,361,1426,1,0,0,0,363,1435,1,0,0,0,365,1439,
+  	1,0,0,0,367,1449,1,0,0,0,369,1454,1,0,0,0,371,1470,1,0,0,0,373,1501,1,
+  	0,0,0,375,1503,1,0,0,0,377,1505,1,0,0,0,379,1507,1,0,0,0,381,1509,1,0,
+  	0,0,383,1511,1,0,0,0,385,1513,1,0,0,0,387,1515,1,0,0,0,389,1517,1,0,0,
+  	0,391,1519,1,0,0,0,393,1521,1,0,0,0,395,1523,1,0,0,0,397,1525,1,0,0,0,
+  	399,1527,1,0,0,0,401,1529,1,0,0,0,403,1531,1,0,0,0,405,1533,1,0,0,0,407,
+  	1535,1,0,0,0,409,1537,1,0,0,0,411,1539,1,0,0,0,413,1541,1,0,0,0,415,1543,
+  	1,0,0,0,417,418,5,59,0,0,418,2,1,0,0,0,419,420,5,40,0,0,420,4,1,0,0,0,
+  	421,422,5,41,0,0,422,6,1,0,0,0,423,424,5,44,0,0,424,8,1,0,0,0,425,426,
+  	5,46,0,0,426,10,1,0,0,0,427,428,5,61,0,0,428,12,1,0,0,0,429,430,5,91,
+  	0,0,430,14,1,0,0,0,431,432,5,93,0,0,432,16,1,0,0,0,433,434,5,123,0,0,
+  	434,18,1,0,0,0,435,436,5,125,0,0,436,20,1,0,0,0,437,438,5,124,0,0,438,
+  	22,1,0,0,0,439,440,5,60,0,0,440,441,5,62,0,0,441,24,1,0,0,0,442,443,5,
+  	60,0,0,443,26,1,0,0,0,444,445,5,60,0,0,445,446,5,61,0,0,446,28,1,0,0,
+  	0,447,448,5,62,0,0,448,30,1,0,0,0,449,450,5,62,0,0,450,451,5,61,0,0,451,
+  	32,1,0,0,0,452,453,5,38,0,0,453,34,1,0,0,0,454,455,5,62,0,0,455,456,5,
+  	62,0,0,456,36,1,0,0,0,457,458,5,60,0,0,458,459,5,60,0,0,459,38,1,0,0,
+  	0,460,461,5,43,0,0,461,40,1,0,0,0,462,463,5,47,0,0,463,42,1,0,0,0,464,
+  	465,5,37,0,0,465,44,1,0,0,0,466,467,5,94,0,0,467,46,1,0,0,0,468,469,5,
+  	61,0,0,469,470,5,126,0,0,470,48,1,0,0,0,471,472,5,36,0,0,472,50,1,0,0,
+  	0,473,474,5,10216,0,0,474,52,1,0,0,0,475,476,5,12296,0,0,476,54,1,0,0,
+  	0,477,478,5,65124,0,0,478,56,1,0,0,0,479,480,5,65308,0,0,480,58,1,0,0,
+  	0,481,482,5,10217,0,0,482,60,1,0,0,0,483,484,5,12297,0,0,484,62,1,0,0,
+  	0,485,486,5,65125,0,0,486,64,1,0,0,0,487,488,5,65310,0,0,488,66,1,0,0,
+  	0,489,490,5,173,0,0,490,68,1,0,0,0,491,492,5,8208,0,0,492,70,1,0,0,0,
+  	493,494,5,8209,0,0,494,72,1,0,0,0,495,496,5,8210,0,0,496,74,1,0,0,0,497,
+  	498,5,8211,0,0,498,76,1,0,0,0,499,500,5,8212,0,0,500,78,1,0,0,0,501,502,
+  	5,8213,0,0,502,80,1,0,0,0,503,504,5,8722,0,0,504,82,1,0,0,0,505,506,5,
+  	65112,0,0,506,84,1,0,0,0,507,508,5,65123,0,0,508,86,1,0,0,0,509,510,5,
+  	65293,0,0,510,88,1,0,0,0,511,512,7,0,0,0,512,513,7,1,0,0,513,514,7,2,
+  	0,0,514,515,7,1,0,0,515,516,7,3,0,0,516,517,7,4,0,0,517,518,7,1,0,0,518,
+  	90,1,0,0,0,519,520,7,0,0,0,520,521,7,5,0,0,521,522,7,2,0,0,522,92,1,0,
+  	0,0,523,524,7,0,0,0,524,525,7,6,0,0,525,526,7,6,0,0,526,94,1,0,0,0,527,
+  	528,7,0,0,0,528,529,7,3,0,0,529,530,7,3,0,0,530,96,1,0,0,0,531,532,7,
+  	0,0,0,532,533,7,3,0,0,533,534,7,7,0,0,534,535,7,8,0,0,535,536,7,9,0,0,
+  	536,98,1,0,0,0,537,538,7,0,0,0,538,539,7,5,0,0,539,540,7,6,0,0,540,100,
+  	1,0,0,0,541,542,7,0,0,0,542,543,7,10,0,0,543,102,1,0,0,0,544,545,7,0,
+  	0,0,545,546,7,10,0,0,546,547,7,1,0,0,547,104,1,0,0,0,548,549,7,0,0,0,
+  	549,550,7,10,0,0,550,551,7,1,0,0,551,552,7,8,0,0,552,553,7,5,0,0,553,
+  	554,7,6,0,0,554,555,7,4,0,0,555,556,7,5,0,0,556,557,7,11,0,0,557,106,
+  	1,0,0,0,558,559,7,0,0,0,559,560,7,7,0,0,560,561,7,7,0,0,561,562,7,0,0,
+  	0,562,563,7,1,0,0,563,564,7,12,0,0,564,108,1,0,0,0,565,566,7,13,0,0,566,
+  	567,7,8,0,0,567,568,7,11,0,0,568,569,7,4,0,0,569,570,7,5,0,0,570,110,
+  	1,0,0,0,571,572,7,13,0,0,572,573,7,2,0,0,573,112,1,0,0,0,574,575,7,1,
+  	0,0,575,576,7,0,0,0,576,577,7,3,0,0,577,578,7,3,0,0,578,114,1,0,0,0,579,
+  	580,7,1,0,0,580,581,7,0,0,0,581,582,7,10,0,0,582,583,7,8,0,0,583,116,
+  	1,0,0,0,584,585,7,1,0,0,585,586,7,0,0,0,586,587,7,10,0,0,587,588,7,7,
+  	0,0,588,118,1,0,0,0,589,590,7,1,0,0,590,591,7,12,0,0,591,592,7,8,0,0,
+  	592,593,7,1,0,0,593,594,7,14,0,0,594,595,7,15,0,0,595,596,7,16,0,0,596,
+  	597,7,4,0,0,597,598,7,5,0,0,598,599,7,7,0,0,599,120,1,0,0,0,600,601,7,
+  	1,0,0,601,602,7,16,0,0,602,603,7,3,0,0,603,604,7,17,0,0,604,605,7,18,
+  	0,0,605,606,7,5,0,0,606,122,1,0,0,0,607,608,7,1,0,0,608,609,7,16,0,0,
+  	609,610,7,18,0,0,610,611,7,18,0,0,611,612,7,8,0,0,612,613,7,5,0,0,613,
+  	614,7,7,0,0,614,124,1,0,0,0,615,616,7,1,0,0,616,617,7,16,0,0,617,618,
+  	7,18,0,0,618,619,7,18,0,0,619,620,7,4,0,0,620,621,7,7,0,0,621,126,1,0,
+  	0,0,622,623,7,1,0,0,623,624,7,16,0,0,624,625,7,18,0,0,625,626,7,18,0,
+  	0,626,627,7,4,0,0,627,628,7,7,0,0,628,629,5,95,0,0,629,630,7,10,0,0,630,
+  	631,7,14,0,0,631,632,7,4,0,0,632,633,7,15,0,0,633,634,5,95,0,0,634,635,
+  	7,1,0,0,635,636,7,12,0,0,636,637,7,8,0,0,637,638,7,1,0,0,638,639,7,14,
+  	0,0,639,640,7,15,0,0,640,641,7,16,0,0,641,642,7,4,0,0,642,643,7,5,0,0,
+  	643,644,7,7,0,0,644,128,1,0,0,0,645,646,7,1,0,0,646,647,7,16,0,0,647,
+  	648,7,5,0,0,648,649,7,7,0,0,649,650,7,0,0,0,650,651,7,4,0,0,651,652,7,
+  	5,0,0,652,653,7,10,0,0,653,130,1,0,0,0,654,655,7,1,0,0,655,656,7,16,0,
+  	0,656,657,7,15,0,0,657,658,7,2,0,0,658,132,1,0,0,0,659,660,7,1,0,0,660,
+  	661,7,16,0,0,661,662,7,17,0,0,662,663,7,5,0,0,663,664,7,7,0,0,664,134,
+  	1,0,0,0,665,666,7,1,0,0,666,667,7,9,0,0,667,668,7,8,0,0,668,669,7,0,0,
+  	0,669,670,7,7,0,0,670,671,7,8,0,0,671,136,1,0,0,0,672,673,7,1,0,0,673,
+  	674,7,2,0,0,674,675,7,1,0,0,675,676,7,3,0,0,676,677,7,8,0,0,677,138,1,
+  	0,0,0,678,679,7,6,0,0,679,680,7,0,0,0,680,681,7,7,0,0,681,682,7,0,0,0,
+  	682,683,7,13,0,0,683,684,7,0,0,0,684,685,7,10,0,0,685,686,7,8,0,0,686,
+  	140,1,0,0,0,687,688,7,6,0,0,688,689,7,13,0,0,689,690,7,7,0,0,690,691,
+  	7,2,0,0,691,692,7,15,0,0,692,693,7,8,0,0,693,142,1,0,0,0,694,695,7,6,
+  	0,0,695,696,7,8,0,0,696,697,7,19,0,0,697,698,7,0,0,0,698,699,7,17,0,0,
+  	699,700,7,3,0,0,700,701,7,7,0,0,701,144,1,0,0,0,702,703,7,6,0,0,703,704,
+  	7,8,0,0,704,705,7,3,0,0,705,706,7,8,0,0,706,707,7,7,0,0,707,708,7,8,0,
+  	0,708,146,1,0,0,0,709,710,7,6,0,0,710,711,7,8,0,0,711,712,7,10,0,0,712,
+  	713,7,1,0,0,713,148,1,0,0,0,714,715,7,6,0,0,715,716,7,8,0,0,716,717,7,
+  	10,0,0,717,718,7,1,0,0,718,719,7,8,0,0,719,720,7,5,0,0,720,721,7,6,0,
+  	0,721,722,7,4,0,0,722,723,7,5,0,0,723,724,7,11,0,0,724,150,1,0,0,0,725,
+  	726,7,6,0,0,726,727,7,8,0,0,727,728,7,7,0,0,728,729,7,0,0,0,729,730,7,
+  	1,0,0,730,731,7,12,0,0,731,152,1,0,0,0,732,733,7,6,0,0,733,734,7,4,0,
+  	0,734,735,7,10,0,0,735,736,7,7,0,0,736,737,7,4,0,0,737,738,7,5,0,0,738,
+  	739,7,1,0,0,739,740,7,7,0,0,740,154,1,0,0,0,741,742,7,6,0,0,742,743,7,
+  	9,0,0,743,744,7,16,0,0,744,745,7,15,0,0,745,156,1,0,0,0,746,747,7,8,0,
+  	0,747,748,7,3,0,0,748,749,7,10,0,0,749,750,7,8,0,0,750,158,1,0,0,0,751,
+  	752,7,8,0,0,752,753,7,5,0,0,753,754,7,6,0,0,754,160,1,0,0,0,755,756,7,
+  	8,0,0,756,757,7,5,0,0,757,758,7,6,0,0,758,759,7,10,0,0,759,162,1,0,0,
+  	0,760,761,7,8,0,0,761,762,7,20,0,0,762,763,7,4,0,0,763,764,7,10,0,0,764,
+  	765,7,7,0,0,765,766,7,10,0,0,766,164,1,0,0,0,767,768,7,8,0,0,768,769,
+  	7,20,0,0,769,770,7,15,0,0,770,771,7,3,0,0,771,772,7,0,0,0,772,773,7,4,
+  	0,0,773,774,7,5,0,0,774,166,1,0,0,0,775,776,7,8,0,0,776,777,7,20,0,0,
+  	777,778,7,15,0,0,778,779,7,16,0,0,779,780,7,9,0,0,780,781,7,7,0,0,781,
+  	168,1,0,0,0,782,783,7,8,0,0,783,784,7,20,0,0,784,785,7,7,0,0,785,786,
+  	7,8,0,0,786,787,7,5,0,0,787,788,7,10,0,0,788,789,7,4,0,0,789,790,7,16,
+  	0,0,790,791,7,5,0,0,791,170,1,0,0,0,792,793,7,19,0,0,793,794,7,0,0,0,
+  	794,795,7,3,0,0,795,796,7,10,0,0,796,797,7,8,0,0,797,172,1,0,0,0,798,
+  	799,7,19,0,0,799,800,7,9,0,0,800,801,7,16,0,0,801,802,7,18,0,0,802,174,
+  	1,0,0,0,803,804,7,19,0,0,804,805,7,16,0,0,805,806,7,9,0,0,806,807,7,1,
+  	0,0,807,808,7,8,0,0,808,176,1,0,0,0,809,810,7,11,0,0,810,811,7,3,0,0,
+  	811,812,7,16,0,0,812,813,7,13,0,0,813,178,1,0,0,0,814,815,7,11,0,0,815,
+  	816,7,9,0,0,816,817,7,0,0,0,817,818,7,15,0,0,818,819,7,12,0,0,819,180,
+  	1,0,0,0,820,821,7,11,0,0,821,822,7,9,0,0,822,823,7,16,0,0,823,824,7,17,
+  	0,0,824,825,7,15,0,0,825,182,1,0,0,0,826,827,7,12,0,0,827,828,7,8,0,0,
+  	828,829,7,0,0,0,829,830,7,6,0,0,830,831,7,8,0,0,831,832,7,9,0,0,832,833,
+  	7,10,0,0,833,184,1,0,0,0,834,835,7,12,0,0,835,836,7,4,0,0,836,837,7,5,
+  	0,0,837,838,7,7,0,0,838,186,1,0,0,0,839,840,7,4,0,0,840,841,7,18,0,0,
+  	841,842,7,15,0,0,842,843,7,16,0,0,843,844,7,9,0,0,844,845,7,7,0,0,845,
+  	188,1,0,0,0,846,847,7,4,0,0,847,848,7,19,0,0,848,190,1,0,0,0,849,850,
+  	7,4,0,0,850,851,7,5,0,0,851,192,1,0,0,0,852,853,7,4,0,0,853,854,7,5,0,
+  	0,854,855,7,1,0,0,855,856,7,9,0,0,856,857,7,8,0,0,857,858,7,18,0,0,858,
+  	859,7,8,0,0,859,860,7,5,0,0,860,861,7,7,0,0,861,194,1,0,0,0,862,863,7,
+  	4,0,0,863,864,7,5,0,0,864,865,7,10,0,0,865,866,7,7,0,0,866,867,7,0,0,
+  	0,867,868,7,3,0,0,868,869,7,3,0,0,869,196,1,0,0,0,870,871,7,4,0,0,871,
+  	872,7,10,0,0,872,198,1,0,0,0,873,874,7,21,0,0,874,875,7,16,0,0,875,876,
+  	7,4,0,0,876,877,7,5,0,0,877,200,1,0,0,0,878,879,7,14,0,0,879,880,7,8,
+  	0,0,880,881,7,2,0,0,881,202,1,0,0,0,882,883,7,3,0,0,883,884,7,4,0,0,884,
+  	885,7,18,0,0,885,886,7,4,0,0,886,887,7,7,0,0,887,204,1,0,0,0,888,889,
+  	7,3,0,0,889,890,7,16,0,0,890,891,7,0,0,0,891,892,7,6,0,0,892,206,1,0,
+  	0,0,893,894,7,3,0,0,894,895,7,16,0,0,895,896,7,11,0,0,896,897,7,4,0,0,
+  	897,898,7,1,0,0,898,899,7,0,0,0,899,900,7,3,0,0,900,208,1,0,0,0,901,902,
+  	7,18,0,0,902,903,7,0,0,0,903,904,7,1,0,0,904,905,7,9,0,0,905,906,7,16,
+  	0,0,906,210,1,0,0,0,907,908,7,18,0,0,908,909,7,0,0,0,909,910,7,7,0,0,
+  	910,911,7,1,0,0,911,912,7,12,0,0,912,212,1,0,0,0,913,914,7,18,0,0,914,
+  	915,7,0,0,0,915,916,7,20,0,0,916,917,7,22,0,0,917,918,7,0,0,0,918,919,
+  	7,3,0,0,919,920,7,17,0,0,920,921,7,8,0,0,921,214,1,0,0,0,922,923,7,18,
+  	0,0,923,924,7,8,0,0,924,925,7,9,0,0,925,926,7,11,0,0,926,927,7,8,0,0,
+  	927,216,1,0,0,0,928,929,7,18,0,0,929,930,7,4,0,0,930,931,7,5,0,0,931,
+  	932,7,22,0,0,932,933,7,0,0,0,933,934,7,3,0,0,934,935,7,17,0,0,935,936,
+  	7,8,0,0,936,218,1,0,0,0,937,938,7,18,0,0,938,939,7,17,0,0,939,940,7,3,
+  	0,0,940,941,7,7,0,0,941,942,7,4,0,0,942,943,5,95,0,0,943,944,7,21,0,0,
+  	944,945,7,16,0,0,945,946,7,4,0,0,946,947,7,5,0,0,947,220,1,0,0,0,948,
+  	949,7,5,0,0,949,950,7,16,0,0,950,222,1,0,0,0,951,952,7,5,0,0,952,953,
+  	7,16,0,0,953,954,7,6,0,0,954,955,7,8,0,0,955,224,1,0,0,0,956,957,7,5,
+  	0,0,957,958,7,16,0,0,958,959,7,7,0,0,959,226,1,0,0,0,960,961,7,5,0,0,
+  	961,962,7,16,0,0,962,963,7,5,0,0,963,964,7,8,0,0,964,228,1,0,0,0,965,
+  	966,7,5,0,0,966,967,7,17,0,0,967,968,7,3,0,0,968,969,7,3,0,0,969,230,
+  	1,0,0,0,970,971,7,16,0,0,971,972,7,5,0,0,972,232,1,0,0,0,973,974,7,16,
+  	0,0,974,975,7,5,0,0,975,976,7,3,0,0,976,977,7,2,0,0,977,234,1,0,0,0,978,
+  	979,7,16,0,0,979,980,7,15,0,0,980,981,7,7,0,0,981,982,7,4,0,0,982,983,
+  	7,16,0,0,983,984,7,5,0,0,984,985,7,0,0,0,985,986,7,3,0,0,986,236,1,0,
+  	0,0,987,988,7,16,0,0,988,989,7,9,0,0,989,238,1,0,0,0,990,991,7,16,0,0,
+  	991,992,7,9,0,0,992,993,7,6,0,0,993,994,7,8,0,0,994,995,7,9,0,0,995,240,
+  	1,0,0,0,996,997,7,15,0,0,997,998,7,9,0,0,998,999,7,4,0,0,999,1000,7,18,
+  	0,0,1000,1001,7,0,0,0,1001,1002,7,9,0,0,1002,1003,7,2,0,0,1003,242,1,
+  	0,0,0,1004,1005,7,15,0,0,1005,1006,7,9,0,0,1006,1007,7,16,0,0,1007,1008,
+  	7,19,0,0,1008,1009,7,4,0,0,1009,1010,7,3,0,0,1010,1011,7,8,0,0,1011,244,
   	1,0,0,0,1012,1013,7,15,0,0,1013,1014,7,9,0,0,1014,1015,7,16,0,0,1015,
   	1016,7,21,0,0,1016,1017,7,8,0,0,1017,1018,7,1,0,0,1018,1019,7,7,0,0,1019,
   	246,1,0,0,0,1020,1021,7,9,0,0,1021,1022,7,8,0,0,1022,1023,7,0,0,0,1023,
@@ -904,10 +905,12 @@ void cypherlexerLexerInitialize() {
   	7,41,0,0,1530,402,1,0,0,0,1531,1532,7,42,0,0,1532,404,1,0,0,0,1533,1534,
   	8,43,0,0,1534,406,1,0,0,0,1535,1536,7,44,0,0,1536,408,1,0,0,0,1537,1538,
   	7,45,0,0,1538,410,1,0,0,0,1539,1540,7,46,0,0,1540,412,1,0,0,0,1541,1542,
-  	7,47,0,0,1542,414,1,0,0,0,1543,1544,9,0,0,0,1544,416,1,0,0,0,35,0,1311,
-  	1313,1320,1322,1326,1350,1357,1360,1363,1367,1371,1375,1384,1389,1395,
-  	1401,1403,1407,1412,1417,1424,1430,1435,1439,1445,1451,1456,1470,1478,
-  	1480,1491,1495,1499,1501,0
+  	7,47,0,0,1542,414,1,0,0,0,1543,1544,9,0,0,0,1544,416,1,0,0,0,1545,1547,
+  	1,0,0,0,1547,1548,7,1,0,0,1548,1549,7,0,0,0,1549,1550,7,1,0,0,1550,1551,
+  	7,12,0,0,1551,1552,7,8,0,0,1552,1546,1,0,0,0,35,0,1311,1313,1320,1322,
+  	1326,1350,1357,1360,1363,1367,1371,1375,1384,1389,1395,1401,1403,1407,
+  	1412,1417,1424,1430,1435,1439,1445,1451,1456,1470,1478,1480,1491,1495,
+  	1499,1501,0
   };
   staticData->serializedATN = antlr4::atn::SerializedATNView(serializedATNSegment, sizeof(serializedATNSegment) / sizeof(serializedATNSegment[0]));
 
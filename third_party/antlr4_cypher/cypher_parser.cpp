@@ -99,7 +99,7 @@ void cypherParserInitialize() {
       "oC_NumberLiteral", "oC_Parameter", "oC_PropertyExpression", "oC_PropertyKeyName", 
       "oC_IntegerLiteral", "oC_DoubleLiteral", "oC_SchemaName", "oC_SymbolicName", 
       "kU_NonReservedKeywords", "oC_LeftArrowHead", "oC_RightArrowHead", 
-      "oC_Dash"
+      "oC_Dash", "kU_Cache"
     },
     std::vector<std::string>{
       "", "';'", "'('", "')'", "','", "'.'", "'='", "'['", "']'", "'{'", 
@@ -142,11 +142,11 @@ void cypherParserInitialize() {
       "DecimalInteger", "HexLetter", "HexDigit", "Digit", "NonZeroDigit", 
       "NonZeroOctDigit", "ZeroDigit", "ExponentDecimalReal", "RegularDecimalReal", 
       "UnescapedSymbolicName", "IdentifierStart", "IdentifierPart", "EscapedSymbolicName", 
-      "SP", "WHITESPACE", "CypherComment", "Unknown"
+      "SP", "WHITESPACE", "CypherComment", "Unknown", "CACHE"
     }
   );
   static const int32_t serializedATNSegment[] = {
-  	4,1,188,2970,2,0,7,0,2,1,7,1,2,2,7,2,2,3,7,3,2,4,7,4,2,5,7,5,2,6,7,6,
+  	4,1,189,2977,2,0,7,0,2,1,7,1,2,2,7,2,2,3,7,3,2,4,7,4,2,5,7,5,2,6,7,6,
   	2,7,7,7,2,8,7,8,2,9,7,9,2,10,7,10,2,11,7,11,2,12,7,12,2,13,7,13,2,14,
   	7,14,2,15,7,15,2,16,7,16,2,17,7,17,2,18,7,18,2,19,7,19,2,20,7,20,2,21,
   	7,21,2,22,7,22,2,23,7,23,2,24,7,24,2,25,7,25,2,26,7,26,2,27,7,27,2,28,
@@ -412,292 +412,293 @@ void cypherParserInitialize() {
   	1,171,1,171,1,171,3,171,2936,8,171,1,172,1,172,3,172,2940,8,172,1,172,
   	1,172,1,173,1,173,1,174,1,174,1,175,1,175,1,176,1,176,1,176,3,176,2953,
   	8,176,1,177,1,177,1,177,1,177,1,177,3,177,2960,8,177,1,178,1,178,1,179,
-  	1,179,1,180,1,180,1,181,1,181,1,181,0,2,118,172,182,0,2,4,6,8,10,12,14,
-  	16,18,20,22,24,26,28,30,32,34,36,38,40,42,44,46,48,50,52,54,56,58,60,
-  	62,64,66,68,70,72,74,76,78,80,82,84,86,88,90,92,94,96,98,100,102,104,
-  	106,108,110,112,114,116,118,120,122,124,126,128,130,132,134,136,138,140,
-  	142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,
-  	178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,
-  	214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,
-  	250,252,254,256,258,260,262,264,266,268,270,272,274,276,278,280,282,284,
-  	286,288,290,292,294,296,298,300,302,304,306,308,310,312,314,316,318,320,
-  	322,324,326,328,330,332,334,336,338,340,342,344,346,348,350,352,354,356,
-  	358,360,362,0,14,4,0,90,90,105,105,130,130,136,136,2,0,52,53,74,75,2,
-  	0,6,6,12,16,1,0,18,19,2,0,20,20,168,168,2,0,21,22,163,163,1,0,166,167,
-  	2,0,86,86,141,141,2,0,67,67,82,82,1,0,179,180,31,0,47,47,49,49,51,51,
-  	54,57,60,60,62,63,65,67,69,70,73,73,76,76,78,78,83,85,87,88,90,90,94,
-  	95,97,97,99,99,101,104,106,109,111,112,123,128,130,131,133,133,135,135,
-  	138,138,140,140,142,142,145,148,152,152,156,162,164,164,2,0,13,13,26,
-  	29,2,0,15,15,30,33,2,0,34,44,168,168,3366,0,364,1,0,0,0,2,384,1,0,0,0,
-  	4,420,1,0,0,0,6,422,1,0,0,0,8,448,1,0,0,0,10,496,1,0,0,0,12,498,1,0,0,
-  	0,14,528,1,0,0,0,16,558,1,0,0,0,18,578,1,0,0,0,20,584,1,0,0,0,22,635,
-  	1,0,0,0,24,637,1,0,0,0,26,651,1,0,0,0,28,655,1,0,0,0,30,659,1,0,0,0,32,
-  	668,1,0,0,0,34,689,1,0,0,0,36,691,1,0,0,0,38,703,1,0,0,0,40,746,1,0,0,
-  	0,42,760,1,0,0,0,44,804,1,0,0,0,46,806,1,0,0,0,48,812,1,0,0,0,50,870,
-  	1,0,0,0,52,941,1,0,0,0,54,955,1,0,0,0,56,963,1,0,0,0,58,980,1,0,0,0,60,
-  	997,1,0,0,0,62,999,1,0,0,0,64,1006,1,0,0,0,66,1019,1,0,0,0,68,1030,1,
-  	0,0,0,70,1050,1,0,0,0,72,1061,1,0,0,0,74,1063,1,0,0,0,76,1076,1,0,0,0,
-  	78,1080,1,0,0,0,80,1084,1,0,0,0,82,1095,1,0,0,0,84,1109,1,0,0,0,86,1111,
-  	1,0,0,0,88,1125,1,0,0,0,90,1129,1,0,0,0,92,1138,1,0,0,0,94,1144,1,0,0,
-  	0,96,1152,1,0,0,0,98,1161,1,0,0,0,100,1170,1,0,0,0,102,1184,1,0,0,0,104,
-  	1188,1,0,0,0,106,1202,1,0,0,0,108,1213,1,0,0,0,110,1229,1,0,0,0,112,1243,
-  	1,0,0,0,114,1257,1,0,0,0,116,1279,1,0,0,0,118,1307,1,0,0,0,120,1316,1,
-  	0,0,0,122,1323,1,0,0,0,124,1331,1,0,0,0,126,1333,1,0,0,0,128,1338,1,0,
-  	0,0,130,1356,1,0,0,0,132,1362,1,0,0,0,134,1364,1,0,0,0,136,1376,1,0,0,
-  	0,138,1387,1,0,0,0,140,1391,1,0,0,0,142,1395,1,0,0,0,144,1418,1,0,0,0,
-  	146,1432,1,0,0,0,148,1436,1,0,0,0,150,1473,1,0,0,0,152,1479,1,0,0,0,154,
-  	1491,1,0,0,0,156,1510,1,0,0,0,158,1516,1,0,0,0,160,1518,1,0,0,0,162,1568,
-  	1,0,0,0,164,1572,1,0,0,0,166,1586,1,0,0,0,168,1605,1,0,0,0,170,1620,1,
-  	0,0,0,172,1636,1,0,0,0,174,1657,1,0,0,0,176,1667,1,0,0,0,178,1673,1,0,
-  	0,0,180,1685,1,0,0,0,182,1706,1,0,0,0,184,1740,1,0,0,0,186,1742,1,0,0,
-  	0,188,1754,1,0,0,0,190,1774,1,0,0,0,192,1782,1,0,0,0,194,1789,1,0,0,0,
-  	196,1833,1,0,0,0,198,1842,1,0,0,0,200,1844,1,0,0,0,202,1859,1,0,0,0,204,
-  	1863,1,0,0,0,206,1867,1,0,0,0,208,1874,1,0,0,0,210,1878,1,0,0,0,212,1903,
-  	1,0,0,0,214,1905,1,0,0,0,216,1921,1,0,0,0,218,1923,1,0,0,0,220,1947,1,
-  	0,0,0,222,1997,1,0,0,0,224,1999,1,0,0,0,226,2029,1,0,0,0,228,2070,1,0,
-  	0,0,230,2091,1,0,0,0,232,2115,1,0,0,0,234,2158,1,0,0,0,236,2174,1,0,0,
-  	0,238,2176,1,0,0,0,240,2225,1,0,0,0,242,2237,1,0,0,0,244,2239,1,0,0,0,
-  	246,2241,1,0,0,0,248,2246,1,0,0,0,250,2248,1,0,0,0,252,2250,1,0,0,0,254,
-  	2260,1,0,0,0,256,2270,1,0,0,0,258,2286,1,0,0,0,260,2339,1,0,0,0,262,2341,
-  	1,0,0,0,264,2343,1,0,0,0,266,2357,1,0,0,0,268,2371,1,0,0,0,270,2386,1,
-  	0,0,0,272,2388,1,0,0,0,274,2403,1,0,0,0,276,2405,1,0,0,0,278,2420,1,0,
-  	0,0,280,2422,1,0,0,0,282,2436,1,0,0,0,284,2465,1,0,0,0,286,2478,1,0,0,
-  	0,288,2486,1,0,0,0,290,2500,1,0,0,0,292,2508,1,0,0,0,294,2518,1,0,0,0,
-  	296,2537,1,0,0,0,298,2595,1,0,0,0,300,2597,1,0,0,0,302,2601,1,0,0,0,304,
-  	2613,1,0,0,0,306,2615,1,0,0,0,308,2617,1,0,0,0,310,2638,1,0,0,0,312,2645,
-  	1,0,0,0,314,2670,1,0,0,0,316,2681,1,0,0,0,318,2768,1,0,0,0,320,2770,1,
-  	0,0,0,322,2785,1,0,0,0,324,2787,1,0,0,0,326,2824,1,0,0,0,328,2826,1,0,
-  	0,0,330,2835,1,0,0,0,332,2865,1,0,0,0,334,2895,1,0,0,0,336,2912,1,0,0,
-  	0,338,2926,1,0,0,0,340,2930,1,0,0,0,342,2932,1,0,0,0,344,2937,1,0,0,0,
-  	346,2943,1,0,0,0,348,2945,1,0,0,0,350,2947,1,0,0,0,352,2949,1,0,0,0,354,
-  	2959,1,0,0,0,356,2961,1,0,0,0,358,2963,1,0,0,0,360,2965,1,0,0,0,362,2967,
-  	1,0,0,0,364,375,3,2,1,0,365,367,5,185,0,0,366,365,1,0,0,0,366,367,1,0,
-  	0,0,367,368,1,0,0,0,368,370,5,1,0,0,369,371,5,185,0,0,370,369,1,0,0,0,
-  	370,371,1,0,0,0,371,372,1,0,0,0,372,374,3,2,1,0,373,366,1,0,0,0,374,377,
-  	1,0,0,0,375,373,1,0,0,0,375,376,1,0,0,0,376,379,1,0,0,0,377,375,1,0,0,
-  	0,378,380,5,185,0,0,379,378,1,0,0,0,379,380,1,0,0,0,380,381,1,0,0,0,381,
-  	382,5,0,0,1,382,1,1,0,0,0,383,385,3,124,62,0,384,383,1,0,0,0,384,385,
-  	1,0,0,0,385,387,1,0,0,0,386,388,5,185,0,0,387,386,1,0,0,0,387,388,1,0,
-  	0,0,388,389,1,0,0,0,389,394,3,4,2,0,390,392,5,185,0,0,391,390,1,0,0,0,
-  	391,392,1,0,0,0,392,393,1,0,0,0,393,395,5,1,0,0,394,391,1,0,0,0,394,395,
-  	1,0,0,0,395,3,1,0,0,0,396,421,3,142,71,0,397,421,3,64,32,0,398,421,3,
-  	66,33,0,399,421,3,48,24,0,400,421,3,50,25,0,401,421,3,56,28,0,402,421,
-  	3,58,29,0,403,421,3,80,40,0,404,421,3,82,41,0,405,421,3,6,3,0,406,421,
-  	3,12,6,0,407,421,3,14,7,0,408,421,3,34,17,0,409,421,3,38,19,0,410,421,
-  	3,36,18,0,411,421,3,130,65,0,412,421,3,132,66,0,413,421,3,16,8,0,414,
-  	421,3,18,9,0,415,421,3,20,10,0,416,421,3,26,13,0,417,421,3,28,14,0,418,
-  	421,3,30,15,0,419,421,3,32,16,0,420,396,1,0,0,0,420,397,1,0,0,0,420,398,
-  	1,0,0,0,420,399,1,0,0,0,420,400,1,0,0,0,420,401,1,0,0,0,420,402,1,0,0,
-  	0,420,403,1,0,0,0,420,404,1,0,0,0,420,405,1,0,0,0,420,406,1,0,0,0,420,
-  	407,1,0,0,0,420,408,1,0,0,0,420,409,1,0,0,0,420,410,1,0,0,0,420,411,1,
-  	0,0,0,420,412,1,0,0,0,420,413,1,0,0,0,420,414,1,0,0,0,420,415,1,0,0,0,
-  	420,416,1,0,0,0,420,417,1,0,0,0,420,418,1,0,0,0,420,419,1,0,0,0,421,5,
-  	1,0,0,0,422,423,5,66,0,0,423,424,5,185,0,0,424,426,3,352,176,0,425,427,
-  	3,8,4,0,426,425,1,0,0,0,426,427,1,0,0,0,427,428,1,0,0,0,428,429,5,185,
-  	0,0,429,430,5,87,0,0,430,431,5,185,0,0,431,445,3,10,5,0,432,434,5,185,
-  	0,0,433,432,1,0,0,0,433,434,1,0,0,0,434,435,1,0,0,0,435,437,5,2,0,0,436,
-  	438,5,185,0,0,437,436,1,0,0,0,437,438,1,0,0,0,438,439,1,0,0,0,439,441,
-  	3,24,12,0,440,442,5,185,0,0,441,440,1,0,0,0,441,442,1,0,0,0,442,443,1,
-  	0,0,0,443,444,5,3,0,0,444,446,1,0,0,0,445,433,1,0,0,0,445,446,1,0,0,0,
-  	446,7,1,0,0,0,447,449,5,185,0,0,448,447,1,0,0,0,448,449,1,0,0,0,449,450,
-  	1,0,0,0,450,452,5,2,0,0,451,453,5,185,0,0,452,451,1,0,0,0,452,453,1,0,
-  	0,0,453,471,1,0,0,0,454,465,3,352,176,0,455,457,5,185,0,0,456,455,1,0,
-  	0,0,456,457,1,0,0,0,457,458,1,0,0,0,458,460,5,4,0,0,459,461,5,185,0,0,
-  	460,459,1,0,0,0,460,461,1,0,0,0,461,462,1,0,0,0,462,464,3,352,176,0,463,
-  	456,1,0,0,0,464,467,1,0,0,0,465,463,1,0,0,0,465,466,1,0,0,0,466,469,1,
-  	0,0,0,467,465,1,0,0,0,468,470,5,185,0,0,469,468,1,0,0,0,469,470,1,0,0,
-  	0,470,472,1,0,0,0,471,454,1,0,0,0,471,472,1,0,0,0,472,473,1,0,0,0,473,
-  	474,5,3,0,0,474,9,1,0,0,0,475,497,3,44,22,0,476,478,5,2,0,0,477,479,5,
-  	185,0,0,478,477,1,0,0,0,478,479,1,0,0,0,479,480,1,0,0,0,480,482,3,142,
-  	71,0,481,483,5,185,0,0,482,481,1,0,0,0,482,483,1,0,0,0,483,484,1,0,0,
-  	0,484,485,5,3,0,0,485,497,1,0,0,0,486,497,3,342,171,0,487,497,3,338,169,
-  	0,488,489,3,338,169,0,489,491,5,5,0,0,490,492,5,185,0,0,491,490,1,0,0,
-  	0,491,492,1,0,0,0,492,493,1,0,0,0,493,494,3,352,176,0,494,497,1,0,0,0,
-  	495,497,3,318,159,0,496,475,1,0,0,0,496,476,1,0,0,0,496,486,1,0,0,0,496,
-  	487,1,0,0,0,496,488,1,0,0,0,496,495,1,0,0,0,497,11,1,0,0,0,498,499,5,
-  	66,0,0,499,500,5,185,0,0,500,501,3,352,176,0,501,502,5,185,0,0,502,503,
-  	5,87,0,0,503,504,5,185,0,0,504,506,5,2,0,0,505,507,5,185,0,0,506,505,
-  	1,0,0,0,506,507,1,0,0,0,507,508,1,0,0,0,508,519,5,170,0,0,509,511,5,185,
-  	0,0,510,509,1,0,0,0,510,511,1,0,0,0,511,512,1,0,0,0,512,514,5,4,0,0,513,
-  	515,5,185,0,0,514,513,1,0,0,0,514,515,1,0,0,0,515,516,1,0,0,0,516,518,
-  	5,170,0,0,517,510,1,0,0,0,518,521,1,0,0,0,519,517,1,0,0,0,519,520,1,0,
-  	0,0,520,522,1,0,0,0,521,519,1,0,0,0,522,523,5,3,0,0,523,524,5,185,0,0,
-  	524,525,5,56,0,0,525,526,5,185,0,0,526,527,5,61,0,0,527,13,1,0,0,0,528,
-  	529,5,66,0,0,529,530,5,185,0,0,530,532,5,2,0,0,531,533,5,185,0,0,532,
-  	531,1,0,0,0,532,533,1,0,0,0,533,534,1,0,0,0,534,536,3,142,71,0,535,537,
-  	5,185,0,0,536,535,1,0,0,0,536,537,1,0,0,0,537,538,1,0,0,0,538,539,5,3,
-  	0,0,539,540,5,185,0,0,540,541,5,138,0,0,541,542,5,185,0,0,542,556,5,170,
-  	0,0,543,545,5,185,0,0,544,543,1,0,0,0,544,545,1,0,0,0,545,546,1,0,0,0,
-  	546,548,5,2,0,0,547,549,5,185,0,0,548,547,1,0,0,0,548,549,1,0,0,0,549,
-  	550,1,0,0,0,550,552,3,24,12,0,551,553,5,185,0,0,552,551,1,0,0,0,552,553,
-  	1,0,0,0,553,554,1,0,0,0,554,555,5,3,0,0,555,557,1,0,0,0,556,544,1,0,0,
-  	0,556,557,1,0,0,0,557,15,1,0,0,0,558,559,5,84,0,0,559,560,5,185,0,0,560,
-  	561,5,70,0,0,561,562,5,185,0,0,562,576,5,170,0,0,563,565,5,185,0,0,564,
-  	563,1,0,0,0,564,565,1,0,0,0,565,566,1,0,0,0,566,568,5,2,0,0,567,569,5,
-  	185,0,0,568,567,1,0,0,0,568,569,1,0,0,0,569,570,1,0,0,0,570,572,3,24,
-  	12,0,571,573,5,185,0,0,572,571,1,0,0,0,572,573,1,0,0,0,573,574,1,0,0,
-  	0,574,575,5,3,0,0,575,577,1,0,0,0,576,564,1,0,0,0,576,577,1,0,0,0,577,
-  	17,1,0,0,0,578,579,5,94,0,0,579,580,5,185,0,0,580,581,5,70,0,0,581,582,
-  	5,185,0,0,582,583,5,170,0,0,583,19,1,0,0,0,584,585,5,54,0,0,585,586,5,
-  	185,0,0,586,591,5,170,0,0,587,588,5,185,0,0,588,589,5,51,0,0,589,590,
-  	5,185,0,0,590,592,3,352,176,0,591,587,1,0,0,0,591,592,1,0,0,0,592,593,
-  	1,0,0,0,593,594,5,185,0,0,594,596,5,2,0,0,595,597,5,185,0,0,596,595,1,
-  	0,0,0,596,597,1,0,0,0,597,598,1,0,0,0,598,599,5,71,0,0,599,600,5,185,
-  	0,0,600,609,3,354,177,0,601,603,5,185,0,0,602,601,1,0,0,0,602,603,1,0,
-  	0,0,603,604,1,0,0,0,604,606,5,4,0,0,605,607,5,185,0,0,606,605,1,0,0,0,
-  	606,607,1,0,0,0,607,608,1,0,0,0,608,610,3,24,12,0,609,602,1,0,0,0,609,
-  	610,1,0,0,0,610,612,1,0,0,0,611,613,5,185,0,0,612,611,1,0,0,0,612,613,
-  	1,0,0,0,613,614,1,0,0,0,614,615,5,3,0,0,615,21,1,0,0,0,616,630,3,354,
-  	177,0,617,619,5,185,0,0,618,617,1,0,0,0,618,619,1,0,0,0,619,620,1,0,0,
-  	0,620,622,5,6,0,0,621,623,5,185,0,0,622,621,1,0,0,0,622,623,1,0,0,0,623,
-  	631,1,0,0,0,624,626,5,185,0,0,625,624,1,0,0,0,626,629,1,0,0,0,627,625,
-  	1,0,0,0,627,628,1,0,0,0,628,631,1,0,0,0,629,627,1,0,0,0,630,618,1,0,0,
-  	0,630,627,1,0,0,0,631,632,1,0,0,0,632,633,3,304,152,0,633,636,1,0,0,0,
-  	634,636,3,354,177,0,635,616,1,0,0,0,635,634,1,0,0,0,636,23,1,0,0,0,637,
-  	648,3,22,11,0,638,640,5,185,0,0,639,638,1,0,0,0,639,640,1,0,0,0,640,641,
-  	1,0,0,0,641,643,5,4,0,0,642,644,5,185,0,0,643,642,1,0,0,0,643,644,1,0,
-  	0,0,644,645,1,0,0,0,645,647,3,22,11,0,646,639,1,0,0,0,647,650,1,0,0,0,
-  	648,646,1,0,0,0,648,649,1,0,0,0,649,25,1,0,0,0,650,648,1,0,0,0,651,652,
-  	5,76,0,0,652,653,5,185,0,0,653,654,3,352,176,0,654,27,1,0,0,0,655,656,
-  	5,147,0,0,656,657,5,185,0,0,657,658,3,352,176,0,658,29,1,0,0,0,659,660,
-  	5,68,0,0,660,661,5,185,0,0,661,662,5,90,0,0,662,663,5,185,0,0,663,666,
-  	3,352,176,0,664,665,5,185,0,0,665,667,5,46,0,0,666,664,1,0,0,0,666,667,
-  	1,0,0,0,667,31,1,0,0,0,668,669,5,147,0,0,669,670,5,185,0,0,670,671,5,
-  	90,0,0,671,672,5,185,0,0,672,673,3,352,176,0,673,33,1,0,0,0,674,675,5,
-  	57,0,0,675,676,5,185,0,0,676,678,3,354,177,0,677,679,5,185,0,0,678,677,
-  	1,0,0,0,678,679,1,0,0,0,679,680,1,0,0,0,680,682,5,6,0,0,681,683,5,185,
-  	0,0,682,681,1,0,0,0,682,683,1,0,0,0,683,684,1,0,0,0,684,685,3,250,125,
-  	0,685,690,1,0,0,0,686,687,5,57,0,0,687,688,5,185,0,0,688,690,3,318,159,
-  	0,689,674,1,0,0,0,689,686,1,0,0,0,690,35,1,0,0,0,691,692,5,62,0,0,692,
-  	693,5,185,0,0,693,694,5,116,0,0,694,695,5,185,0,0,695,696,5,136,0,0,696,
-  	697,5,185,0,0,697,698,3,352,176,0,698,699,5,185,0,0,699,700,5,99,0,0,
-  	700,701,5,185,0,0,701,702,5,170,0,0,702,37,1,0,0,0,703,704,5,68,0,0,704,
-  	705,5,185,0,0,705,706,5,105,0,0,706,707,5,185,0,0,707,709,3,320,160,0,
-  	708,710,5,185,0,0,709,708,1,0,0,0,709,710,1,0,0,0,710,711,1,0,0,0,711,
-  	713,5,2,0,0,712,714,5,185,0,0,713,712,1,0,0,0,713,714,1,0,0,0,714,716,
-  	1,0,0,0,715,717,3,40,20,0,716,715,1,0,0,0,716,717,1,0,0,0,717,719,1,0,
-  	0,0,718,720,5,185,0,0,719,718,1,0,0,0,719,720,1,0,0,0,720,722,1,0,0,0,
-  	721,723,3,42,21,0,722,721,1,0,0,0,722,723,1,0,0,0,723,734,1,0,0,0,724,
-  	726,5,185,0,0,725,724,1,0,0,0,725,726,1,0,0,0,726,727,1,0,0,0,727,729,
-  	5,4,0,0,728,730,5,185,0,0,729,728,1,0,0,0,729,730,1,0,0,0,730,731,1,0,
-  	0,0,731,733,3,42,21,0,732,725,1,0,0,0,733,736,1,0,0,0,734,732,1,0,0,0,
-  	734,735,1,0,0,0,735,738,1,0,0,0,736,734,1,0,0,0,737,739,5,185,0,0,738,
-  	737,1,0,0,0,738,739,1,0,0,0,739,740,1,0,0,0,740,741,5,3,0,0,741,742,5,
-  	185,0,0,742,743,5,51,0,0,743,744,5,185,0,0,744,745,3,250,125,0,745,39,
-  	1,0,0,0,746,757,3,354,177,0,747,749,5,185,0,0,748,747,1,0,0,0,748,749,
-  	1,0,0,0,749,750,1,0,0,0,750,752,5,4,0,0,751,753,5,185,0,0,752,751,1,0,
-  	0,0,752,753,1,0,0,0,753,754,1,0,0,0,754,756,3,354,177,0,755,748,1,0,0,
-  	0,756,759,1,0,0,0,757,755,1,0,0,0,757,758,1,0,0,0,758,41,1,0,0,0,759,
-  	757,1,0,0,0,760,762,3,354,177,0,761,763,5,185,0,0,762,761,1,0,0,0,762,
-  	763,1,0,0,0,763,764,1,0,0,0,764,765,5,166,0,0,765,767,5,6,0,0,766,768,
-  	5,185,0,0,767,766,1,0,0,0,767,768,1,0,0,0,768,769,1,0,0,0,769,770,3,304,
-  	152,0,770,43,1,0,0,0,771,773,5,7,0,0,772,774,5,185,0,0,773,772,1,0,0,
-  	0,773,774,1,0,0,0,774,775,1,0,0,0,775,786,5,170,0,0,776,778,5,185,0,0,
-  	777,776,1,0,0,0,777,778,1,0,0,0,778,779,1,0,0,0,779,781,5,4,0,0,780,782,
-  	5,185,0,0,781,780,1,0,0,0,781,782,1,0,0,0,782,783,1,0,0,0,783,785,5,170,
-  	0,0,784,777,1,0,0,0,785,788,1,0,0,0,786,784,1,0,0,0,786,787,1,0,0,0,787,
-  	789,1,0,0,0,788,786,1,0,0,0,789,805,5,8,0,0,790,805,5,170,0,0,791,793,
-  	5,89,0,0,792,794,5,185,0,0,793,792,1,0,0,0,793,794,1,0,0,0,794,795,1,
-  	0,0,0,795,797,5,2,0,0,796,798,5,185,0,0,797,796,1,0,0,0,797,798,1,0,0,
-  	0,798,799,1,0,0,0,799,801,5,170,0,0,800,802,5,185,0,0,801,800,1,0,0,0,
-  	801,802,1,0,0,0,802,803,1,0,0,0,803,805,5,3,0,0,804,771,1,0,0,0,804,790,
-  	1,0,0,0,804,791,1,0,0,0,805,45,1,0,0,0,806,807,5,95,0,0,807,808,5,185,
-  	0,0,808,809,5,113,0,0,809,810,5,185,0,0,810,811,5,82,0,0,811,47,1,0,0,
-  	0,812,813,5,68,0,0,813,814,5,185,0,0,814,815,5,112,0,0,815,816,5,185,
-  	0,0,816,817,5,136,0,0,817,821,5,185,0,0,818,819,3,46,23,0,819,820,5,185,
-  	0,0,820,822,1,0,0,0,821,818,1,0,0,0,821,822,1,0,0,0,822,823,1,0,0,0,823,
-  	851,3,352,176,0,824,826,5,185,0,0,825,824,1,0,0,0,825,826,1,0,0,0,826,
-  	827,1,0,0,0,827,829,5,2,0,0,828,830,5,185,0,0,829,828,1,0,0,0,829,830,
-  	1,0,0,0,830,831,1,0,0,0,831,833,3,104,52,0,832,834,5,185,0,0,833,832,
-  	1,0,0,0,833,834,1,0,0,0,834,840,1,0,0,0,835,837,5,4,0,0,836,838,5,185,
-  	0,0,837,836,1,0,0,0,837,838,1,0,0,0,838,839,1,0,0,0,839,841,3,108,54,
-  	0,840,835,1,0,0,0,840,841,1,0,0,0,841,843,1,0,0,0,842,844,5,185,0,0,843,
-  	842,1,0,0,0,843,844,1,0,0,0,844,845,1,0,0,0,845,846,5,3,0,0,846,852,1,
-  	0,0,0,847,848,5,185,0,0,848,849,5,51,0,0,849,850,5,185,0,0,850,852,3,
-  	142,71,0,851,825,1,0,0,0,851,847,1,0,0,0,852,868,1,0,0,0,853,854,5,185,
-  	0,0,854,856,5,151,0,0,855,857,5,185,0,0,856,855,1,0,0,0,856,857,1,0,0,
-  	0,857,858,1,0,0,0,858,860,5,2,0,0,859,861,5,185,0,0,860,859,1,0,0,0,860,
-  	861,1,0,0,0,861,862,1,0,0,0,862,864,3,24,12,0,863,865,5,185,0,0,864,863,
-  	1,0,0,0,864,865,1,0,0,0,865,866,1,0,0,0,866,867,5,3,0,0,867,869,1,0,0,
-  	0,868,853,1,0,0,0,868,869,1,0,0,0,869,49,1,0,0,0,870,871,5,68,0,0,871,
-  	872,5,185,0,0,872,873,5,125,0,0,873,874,5,185,0,0,874,877,5,136,0,0,875,
-  	876,5,185,0,0,876,878,5,91,0,0,877,875,1,0,0,0,877,878,1,0,0,0,878,881,
-  	1,0,0,0,879,880,5,185,0,0,880,882,3,46,23,0,881,879,1,0,0,0,881,882,1,
-  	0,0,0,882,883,1,0,0,0,883,884,5,185,0,0,884,886,3,352,176,0,885,887,5,
-  	185,0,0,886,885,1,0,0,0,886,887,1,0,0,0,887,888,1,0,0,0,888,890,5,2,0,
-  	0,889,891,5,185,0,0,890,889,1,0,0,0,890,891,1,0,0,0,891,892,1,0,0,0,892,
-  	894,3,52,26,0,893,895,5,185,0,0,894,893,1,0,0,0,894,895,1,0,0,0,895,922,
-  	1,0,0,0,896,898,5,4,0,0,897,899,5,185,0,0,898,897,1,0,0,0,898,899,1,0,
-  	0,0,899,900,1,0,0,0,900,902,3,104,52,0,901,903,5,185,0,0,902,901,1,0,
-  	0,0,902,903,1,0,0,0,903,905,1,0,0,0,904,896,1,0,0,0,904,905,1,0,0,0,905,
-  	914,1,0,0,0,906,908,5,4,0,0,907,909,5,185,0,0,908,907,1,0,0,0,908,909,
-  	1,0,0,0,909,910,1,0,0,0,910,912,3,354,177,0,911,913,5,185,0,0,912,911,
-  	1,0,0,0,912,913,1,0,0,0,913,915,1,0,0,0,914,906,1,0,0,0,914,915,1,0,0,
-  	0,915,916,1,0,0,0,916,923,5,3,0,0,917,918,5,3,0,0,918,919,5,185,0,0,919,
-  	920,5,51,0,0,920,921,5,185,0,0,921,923,3,142,71,0,922,904,1,0,0,0,922,
-  	917,1,0,0,0,923,939,1,0,0,0,924,925,5,185,0,0,925,927,5,151,0,0,926,928,
-  	5,185,0,0,927,926,1,0,0,0,927,928,1,0,0,0,928,929,1,0,0,0,929,931,5,2,
-  	0,0,930,932,5,185,0,0,931,930,1,0,0,0,931,932,1,0,0,0,932,933,1,0,0,0,
-  	933,935,3,24,12,0,934,936,5,185,0,0,935,934,1,0,0,0,935,936,1,0,0,0,936,
-  	937,1,0,0,0,937,938,5,3,0,0,938,940,1,0,0,0,939,924,1,0,0,0,939,940,1,
-  	0,0,0,940,51,1,0,0,0,941,952,3,54,27,0,942,944,5,185,0,0,943,942,1,0,
-  	0,0,943,944,1,0,0,0,944,945,1,0,0,0,945,947,5,4,0,0,946,948,5,185,0,0,
-  	947,946,1,0,0,0,947,948,1,0,0,0,948,949,1,0,0,0,949,951,3,54,27,0,950,
-  	943,1,0,0,0,951,954,1,0,0,0,952,950,1,0,0,0,952,953,1,0,0,0,953,53,1,
-  	0,0,0,954,952,1,0,0,0,955,956,5,87,0,0,956,957,5,185,0,0,957,958,3,352,
-  	176,0,958,959,5,185,0,0,959,960,5,138,0,0,960,961,5,185,0,0,961,962,3,
-  	352,176,0,962,55,1,0,0,0,963,964,5,68,0,0,964,965,5,185,0,0,965,966,5,
-  	130,0,0,966,970,5,185,0,0,967,968,3,46,23,0,968,969,5,185,0,0,969,971,
-  	1,0,0,0,970,967,1,0,0,0,970,971,1,0,0,0,971,972,1,0,0,0,972,977,3,352,
-  	176,0,973,974,5,185,0,0,974,976,3,60,30,0,975,973,1,0,0,0,976,979,1,0,
-  	0,0,977,975,1,0,0,0,977,978,1,0,0,0,978,57,1,0,0,0,979,977,1,0,0,0,980,
-  	981,5,68,0,0,981,982,5,185,0,0,982,983,5,142,0,0,983,984,5,185,0,0,984,
-  	985,3,352,176,0,985,986,5,185,0,0,986,987,5,51,0,0,987,988,5,185,0,0,
-  	988,990,3,118,59,0,989,991,5,185,0,0,990,989,1,0,0,0,990,991,1,0,0,0,
-  	991,59,1,0,0,0,992,998,3,68,34,0,993,998,3,70,35,0,994,998,3,72,36,0,
-  	995,998,3,74,37,0,996,998,3,76,38,0,997,992,1,0,0,0,997,993,1,0,0,0,997,
-  	994,1,0,0,0,997,995,1,0,0,0,997,996,1,0,0,0,998,61,1,0,0,0,999,1000,5,
-  	185,0,0,1000,1001,5,151,0,0,1001,1002,5,185,0,0,1002,1003,5,158,0,0,1003,
-  	1004,5,185,0,0,1004,1005,5,170,0,0,1005,63,1,0,0,0,1006,1007,5,68,0,0,
-  	1007,1008,5,185,0,0,1008,1009,5,157,0,0,1009,1013,5,185,0,0,1010,1011,
-  	3,46,23,0,1011,1012,5,185,0,0,1012,1014,1,0,0,0,1013,1010,1,0,0,0,1013,
-  	1014,1,0,0,0,1014,1015,1,0,0,0,1015,1017,3,338,169,0,1016,1018,3,62,31,
-  	0,1017,1016,1,0,0,0,1017,1018,1,0,0,0,1018,65,1,0,0,0,1019,1020,5,68,
-  	0,0,1020,1021,5,185,0,0,1021,1022,5,159,0,0,1022,1026,5,185,0,0,1023,
-  	1024,3,46,23,0,1024,1025,5,185,0,0,1025,1027,1,0,0,0,1026,1023,1,0,0,
-  	0,1026,1027,1,0,0,0,1027,1028,1,0,0,0,1028,1029,3,338,169,0,1029,67,1,
-  	0,0,0,1030,1031,5,97,0,0,1031,1034,5,185,0,0,1032,1033,5,56,0,0,1033,
-  	1035,5,185,0,0,1034,1032,1,0,0,0,1034,1035,1,0,0,0,1035,1037,1,0,0,0,
-  	1036,1038,5,168,0,0,1037,1036,1,0,0,0,1037,1038,1,0,0,0,1038,1039,1,0,
-  	0,0,1039,1040,3,348,174,0,1040,69,1,0,0,0,1041,1042,5,111,0,0,1042,1043,
-  	5,185,0,0,1043,1051,5,109,0,0,1044,1045,5,109,0,0,1045,1047,5,185,0,0,
-  	1046,1048,5,168,0,0,1047,1046,1,0,0,0,1047,1048,1,0,0,0,1048,1049,1,0,
-  	0,0,1049,1051,3,348,174,0,1050,1041,1,0,0,0,1050,1044,1,0,0,0,1051,71,
-  	1,0,0,0,1052,1053,5,111,0,0,1053,1054,5,185,0,0,1054,1062,5,107,0,0,1055,
-  	1056,5,107,0,0,1056,1058,5,185,0,0,1057,1059,5,168,0,0,1058,1057,1,0,
-  	0,0,1058,1059,1,0,0,0,1059,1060,1,0,0,0,1060,1062,3,348,174,0,1061,1052,
-  	1,0,0,0,1061,1055,1,0,0,0,1062,73,1,0,0,0,1063,1064,5,133,0,0,1064,1067,
-  	5,185,0,0,1065,1066,5,151,0,0,1066,1068,5,185,0,0,1067,1065,1,0,0,0,1067,
-  	1068,1,0,0,0,1068,1070,1,0,0,0,1069,1071,5,168,0,0,1070,1069,1,0,0,0,
-  	1070,1071,1,0,0,0,1071,1072,1,0,0,0,1072,1073,3,348,174,0,1073,75,1,0,
-  	0,0,1074,1075,5,111,0,0,1075,1077,5,185,0,0,1076,1074,1,0,0,0,1076,1077,
-  	1,0,0,0,1077,1078,1,0,0,0,1078,1079,5,69,0,0,1079,77,1,0,0,0,1080,1081,
-  	5,95,0,0,1081,1082,5,185,0,0,1082,1083,5,82,0,0,1083,79,1,0,0,0,1084,
-  	1085,5,78,0,0,1085,1086,5,185,0,0,1086,1087,7,0,0,0,1087,1091,5,185,0,
-  	0,1088,1089,3,78,39,0,1089,1090,5,185,0,0,1090,1092,1,0,0,0,1091,1088,
-  	1,0,0,0,1091,1092,1,0,0,0,1092,1093,1,0,0,0,1093,1094,3,352,176,0,1094,
-  	81,1,0,0,0,1095,1096,5,49,0,0,1096,1097,5,185,0,0,1097,1098,5,136,0,0,
-  	1098,1099,5,185,0,0,1099,1100,3,352,176,0,1100,1101,5,185,0,0,1101,1102,
-  	3,84,42,0,1102,83,1,0,0,0,1103,1110,3,86,43,0,1104,1110,3,90,45,0,1105,
-  	1110,3,92,46,0,1106,1110,3,94,47,0,1107,1110,3,96,48,0,1108,1110,3,98,
-  	49,0,1109,1103,1,0,0,0,1109,1104,1,0,0,0,1109,1105,1,0,0,0,1109,1106,
-  	1,0,0,0,1109,1107,1,0,0,0,1109,1108,1,0,0,0,1110,85,1,0,0,0,1111,1112,
-  	5,47,0,0,1112,1116,5,185,0,0,1113,1114,3,46,23,0,1114,1115,5,185,0,0,
-  	1115,1117,1,0,0,0,1116,1113,1,0,0,0,1116,1117,1,0,0,0,1117,1118,1,0,0,
-  	0,1118,1119,3,346,173,0,1119,1120,5,185,0,0,1120,1123,3,118,59,0,1121,
-  	1122,5,185,0,0,1122,1124,3,88,44,0,1123,1121,1,0,0,0,1123,1124,1,0,0,
-  	0,1124,87,1,0,0,0,1125,1126,5,72,0,0,1126,1127,5,185,0,0,1127,1128,3,
-  	250,125,0,1128,89,1,0,0,0,1129,1130,5,78,0,0,1130,1134,5,185,0,0,1131,
+  	1,179,1,180,1,180,1,181,1,181,1,181,1,30,2,182,7,182,1,182,1,182,1,182,
+  	1,182,0,2,118,172,183,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,
+  	36,38,40,42,44,46,48,50,52,54,56,58,60,62,64,66,68,70,72,74,76,78,80,
+  	82,84,86,88,90,92,94,96,98,100,102,104,106,108,110,112,114,116,118,120,
+  	122,124,126,128,130,132,134,136,138,140,142,144,146,148,150,152,154,156,
+  	158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,
+  	194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,
+  	230,232,234,236,238,240,242,244,246,248,250,252,254,256,258,260,262,264,
+  	266,268,270,272,274,276,278,280,282,284,286,288,290,292,294,296,298,300,
+  	302,304,306,308,310,312,314,316,318,320,322,324,326,328,330,332,334,336,
+  	338,340,342,344,346,348,350,352,354,356,358,360,362,2971,0,14,4,0,90,
+  	90,105,105,130,130,136,136,2,0,52,53,74,75,2,0,6,6,12,16,1,0,18,19,2,
+  	0,20,20,168,168,2,0,21,22,163,163,1,0,166,167,2,0,86,86,141,141,2,0,67,
+  	67,82,82,1,0,179,180,32,0,47,47,49,49,51,51,54,57,60,60,62,63,65,67,69,
+  	70,73,73,76,76,78,78,83,85,87,88,90,90,94,95,97,97,99,99,101,104,106,
+  	109,111,112,123,128,130,131,133,133,135,135,138,138,140,140,142,142,145,
+  	148,152,152,156,162,164,164,189,189,2,0,13,13,26,29,2,0,15,15,30,33,2,
+  	0,34,44,168,168,3373,0,364,1,0,0,0,2,384,1,0,0,0,4,420,1,0,0,0,6,422,
+  	1,0,0,0,8,448,1,0,0,0,10,496,1,0,0,0,12,498,1,0,0,0,14,528,1,0,0,0,16,
+  	558,1,0,0,0,18,578,1,0,0,0,20,584,1,0,0,0,22,635,1,0,0,0,24,637,1,0,0,
+  	0,26,651,1,0,0,0,28,655,1,0,0,0,30,659,1,0,0,0,32,668,1,0,0,0,34,689,
+  	1,0,0,0,36,691,1,0,0,0,38,703,1,0,0,0,40,746,1,0,0,0,42,760,1,0,0,0,44,
+  	804,1,0,0,0,46,806,1,0,0,0,48,812,1,0,0,0,50,870,1,0,0,0,52,941,1,0,0,
+  	0,54,955,1,0,0,0,56,963,1,0,0,0,58,980,1,0,0,0,60,997,1,0,0,0,62,999,
+  	1,0,0,0,64,1006,1,0,0,0,66,1019,1,0,0,0,68,1030,1,0,0,0,70,1050,1,0,0,
+  	0,72,1061,1,0,0,0,74,1063,1,0,0,0,76,1076,1,0,0,0,78,1080,1,0,0,0,80,
+  	1084,1,0,0,0,82,1095,1,0,0,0,84,1109,1,0,0,0,86,1111,1,0,0,0,88,1125,
+  	1,0,0,0,90,1129,1,0,0,0,92,1138,1,0,0,0,94,1144,1,0,0,0,96,1152,1,0,0,
+  	0,98,1161,1,0,0,0,100,1170,1,0,0,0,102,1184,1,0,0,0,104,1188,1,0,0,0,
+  	106,1202,1,0,0,0,108,1213,1,0,0,0,110,1229,1,0,0,0,112,1243,1,0,0,0,114,
+  	1257,1,0,0,0,116,1279,1,0,0,0,118,1307,1,0,0,0,120,1316,1,0,0,0,122,1323,
+  	1,0,0,0,124,1331,1,0,0,0,126,1333,1,0,0,0,128,1338,1,0,0,0,130,1356,1,
+  	0,0,0,132,1362,1,0,0,0,134,1364,1,0,0,0,136,1376,1,0,0,0,138,1387,1,0,
+  	0,0,140,1391,1,0,0,0,142,1395,1,0,0,0,144,1418,1,0,0,0,146,1432,1,0,0,
+  	0,148,1436,1,0,0,0,150,1473,1,0,0,0,152,1479,1,0,0,0,154,1491,1,0,0,0,
+  	156,1510,1,0,0,0,158,1516,1,0,0,0,160,1518,1,0,0,0,162,1568,1,0,0,0,164,
+  	1572,1,0,0,0,166,1586,1,0,0,0,168,1605,1,0,0,0,170,1620,1,0,0,0,172,1636,
+  	1,0,0,0,174,1657,1,0,0,0,176,1667,1,0,0,0,178,1673,1,0,0,0,180,1685,1,
+  	0,0,0,182,1706,1,0,0,0,184,1740,1,0,0,0,186,1742,1,0,0,0,188,1754,1,0,
+  	0,0,190,1774,1,0,0,0,192,1782,1,0,0,0,194,1789,1,0,0,0,196,1833,1,0,0,
+  	0,198,1842,1,0,0,0,200,1844,1,0,0,0,202,1859,1,0,0,0,204,1863,1,0,0,0,
+  	206,1867,1,0,0,0,208,1874,1,0,0,0,210,1878,1,0,0,0,212,1903,1,0,0,0,214,
+  	1905,1,0,0,0,216,1921,1,0,0,0,218,1923,1,0,0,0,220,1947,1,0,0,0,222,1997,
+  	1,0,0,0,224,1999,1,0,0,0,226,2029,1,0,0,0,228,2070,1,0,0,0,230,2091,1,
+  	0,0,0,232,2115,1,0,0,0,234,2158,1,0,0,0,236,2174,1,0,0,0,238,2176,1,0,
+  	0,0,240,2225,1,0,0,0,242,2237,1,0,0,0,244,2239,1,0,0,0,246,2241,1,0,0,
+  	0,248,2246,1,0,0,0,250,2248,1,0,0,0,252,2250,1,0,0,0,254,2260,1,0,0,0,
+  	256,2270,1,0,0,0,258,2286,1,0,0,0,260,2339,1,0,0,0,262,2341,1,0,0,0,264,
+  	2343,1,0,0,0,266,2357,1,0,0,0,268,2371,1,0,0,0,270,2386,1,0,0,0,272,2388,
+  	1,0,0,0,274,2403,1,0,0,0,276,2405,1,0,0,0,278,2420,1,0,0,0,280,2422,1,
+  	0,0,0,282,2436,1,0,0,0,284,2465,1,0,0,0,286,2478,1,0,0,0,288,2486,1,0,
+  	0,0,290,2500,1,0,0,0,292,2508,1,0,0,0,294,2518,1,0,0,0,296,2537,1,0,0,
+  	0,298,2595,1,0,0,0,300,2597,1,0,0,0,302,2601,1,0,0,0,304,2613,1,0,0,0,
+  	306,2615,1,0,0,0,308,2617,1,0,0,0,310,2638,1,0,0,0,312,2645,1,0,0,0,314,
+  	2670,1,0,0,0,316,2681,1,0,0,0,318,2768,1,0,0,0,320,2770,1,0,0,0,322,2785,
+  	1,0,0,0,324,2787,1,0,0,0,326,2824,1,0,0,0,328,2826,1,0,0,0,330,2835,1,
+  	0,0,0,332,2865,1,0,0,0,334,2895,1,0,0,0,336,2912,1,0,0,0,338,2926,1,0,
+  	0,0,340,2930,1,0,0,0,342,2932,1,0,0,0,344,2937,1,0,0,0,346,2943,1,0,0,
+  	0,348,2945,1,0,0,0,350,2947,1,0,0,0,352,2949,1,0,0,0,354,2959,1,0,0,0,
+  	356,2961,1,0,0,0,358,2963,1,0,0,0,360,2965,1,0,0,0,362,2967,1,0,0,0,364,
+  	375,3,2,1,0,365,367,5,185,0,0,366,365,1,0,0,0,366,367,1,0,0,0,367,368,
+  	1,0,0,0,368,370,5,1,0,0,369,371,5,185,0,0,370,369,1,0,0,0,370,371,1,0,
+  	0,0,371,372,1,0,0,0,372,374,3,2,1,0,373,366,1,0,0,0,374,377,1,0,0,0,375,
+  	373,1,0,0,0,375,376,1,0,0,0,376,379,1,0,0,0,377,375,1,0,0,0,378,380,5,
+  	185,0,0,379,378,1,0,0,0,379,380,1,0,0,0,380,381,1,0,0,0,381,382,5,0,0,
+  	1,382,1,1,0,0,0,383,385,3,124,62,0,384,383,1,0,0,0,384,385,1,0,0,0,385,
+  	387,1,0,0,0,386,388,5,185,0,0,387,386,1,0,0,0,387,388,1,0,0,0,388,389,
+  	1,0,0,0,389,394,3,4,2,0,390,392,5,185,0,0,391,390,1,0,0,0,391,392,1,0,
+  	0,0,392,393,1,0,0,0,393,395,5,1,0,0,394,391,1,0,0,0,394,395,1,0,0,0,395,
+  	3,1,0,0,0,396,421,3,142,71,0,397,421,3,64,32,0,398,421,3,66,33,0,399,
+  	421,3,48,24,0,400,421,3,50,25,0,401,421,3,56,28,0,402,421,3,58,29,0,403,
+  	421,3,80,40,0,404,421,3,82,41,0,405,421,3,6,3,0,406,421,3,12,6,0,407,
+  	421,3,14,7,0,408,421,3,34,17,0,409,421,3,38,19,0,410,421,3,36,18,0,411,
+  	421,3,130,65,0,412,421,3,132,66,0,413,421,3,16,8,0,414,421,3,18,9,0,415,
+  	421,3,20,10,0,416,421,3,26,13,0,417,421,3,28,14,0,418,421,3,30,15,0,419,
+  	421,3,32,16,0,420,396,1,0,0,0,420,397,1,0,0,0,420,398,1,0,0,0,420,399,
+  	1,0,0,0,420,400,1,0,0,0,420,401,1,0,0,0,420,402,1,0,0,0,420,403,1,0,0,
+  	0,420,404,1,0,0,0,420,405,1,0,0,0,420,406,1,0,0,0,420,407,1,0,0,0,420,
+  	408,1,0,0,0,420,409,1,0,0,0,420,410,1,0,0,0,420,411,1,0,0,0,420,412,1,
+  	0,0,0,420,413,1,0,0,0,420,414,1,0,0,0,420,415,1,0,0,0,420,416,1,0,0,0,
+  	420,417,1,0,0,0,420,418,1,0,0,0,420,419,1,0,0,0,421,5,1,0,0,0,422,423,
+  	5,66,0,0,423,424,5,185,0,0,424,426,3,352,176,0,425,427,3,8,4,0,426,425,
+  	1,0,0,0,426,427,1,0,0,0,427,428,1,0,0,0,428,429,5,185,0,0,429,430,5,87,
+  	0,0,430,431,5,185,0,0,431,445,3,10,5,0,432,434,5,185,0,0,433,432,1,0,
+  	0,0,433,434,1,0,0,0,434,435,1,0,0,0,435,437,5,2,0,0,436,438,5,185,0,0,
+  	437,436,1,0,0,0,437,438,1,0,0,0,438,439,1,0,0,0,439,441,3,24,12,0,440,
+  	442,5,185,0,0,441,440,1,0,0,0,441,442,1,0,0,0,442,443,1,0,0,0,443,444,
+  	5,3,0,0,444,446,1,0,0,0,445,433,1,0,0,0,445,446,1,0,0,0,446,7,1,0,0,0,
+  	447,449,5,185,0,0,448,447,1,0,0,0,448,449,1,0,0,0,449,450,1,0,0,0,450,
+  	452,5,2,0,0,451,453,5,185,0,0,452,451,1,0,0,0,452,453,1,0,0,0,453,471,
+  	1,0,0,0,454,465,3,352,176,0,455,457,5,185,0,0,456,455,1,0,0,0,456,457,
+  	1,0,0,0,457,458,1,0,0,0,458,460,5,4,0,0,459,461,5,185,0,0,460,459,1,0,
+  	0,0,460,461,1,0,0,0,461,462,1,0,0,0,462,464,3,352,176,0,463,456,1,0,0,
+  	0,464,467,1,0,0,0,465,463,1,0,0,0,465,466,1,0,0,0,466,469,1,0,0,0,467,
+  	465,1,0,0,0,468,470,5,185,0,0,469,468,1,0,0,0,469,470,1,0,0,0,470,472,
+  	1,0,0,0,471,454,1,0,0,0,471,472,1,0,0,0,472,473,1,0,0,0,473,474,5,3,0,
+  	0,474,9,1,0,0,0,475,497,3,44,22,0,476,478,5,2,0,0,477,479,5,185,0,0,478,
+  	477,1,0,0,0,478,479,1,0,0,0,479,480,1,0,0,0,480,482,3,142,71,0,481,483,
+  	5,185,0,0,482,481,1,0,0,0,482,483,1,0,0,0,483,484,1,0,0,0,484,485,5,3,
+  	0,0,485,497,1,0,0,0,486,497,3,342,171,0,487,497,3,338,169,0,488,489,3,
+  	338,169,0,489,491,5,5,0,0,490,492,5,185,0,0,491,490,1,0,0,0,491,492,1,
+  	0,0,0,492,493,1,0,0,0,493,494,3,352,176,0,494,497,1,0,0,0,495,497,3,318,
+  	159,0,496,475,1,0,0,0,496,476,1,0,0,0,496,486,1,0,0,0,496,487,1,0,0,0,
+  	496,488,1,0,0,0,496,495,1,0,0,0,497,11,1,0,0,0,498,499,5,66,0,0,499,500,
+  	5,185,0,0,500,501,3,352,176,0,501,502,5,185,0,0,502,503,5,87,0,0,503,
+  	504,5,185,0,0,504,506,5,2,0,0,505,507,5,185,0,0,506,505,1,0,0,0,506,507,
+  	1,0,0,0,507,508,1,0,0,0,508,519,5,170,0,0,509,511,5,185,0,0,510,509,1,
+  	0,0,0,510,511,1,0,0,0,511,512,1,0,0,0,512,514,5,4,0,0,513,515,5,185,0,
+  	0,514,513,1,0,0,0,514,515,1,0,0,0,515,516,1,0,0,0,516,518,5,170,0,0,517,
+  	510,1,0,0,0,518,521,1,0,0,0,519,517,1,0,0,0,519,520,1,0,0,0,520,522,1,
+  	0,0,0,521,519,1,0,0,0,522,523,5,3,0,0,523,524,5,185,0,0,524,525,5,56,
+  	0,0,525,526,5,185,0,0,526,527,5,61,0,0,527,13,1,0,0,0,528,529,5,66,0,
+  	0,529,530,5,185,0,0,530,532,5,2,0,0,531,533,5,185,0,0,532,531,1,0,0,0,
+  	532,533,1,0,0,0,533,534,1,0,0,0,534,536,3,142,71,0,535,537,5,185,0,0,
+  	536,535,1,0,0,0,536,537,1,0,0,0,537,538,1,0,0,0,538,539,5,3,0,0,539,540,
+  	5,185,0,0,540,541,5,138,0,0,541,542,5,185,0,0,542,556,5,170,0,0,543,545,
+  	5,185,0,0,544,543,1,0,0,0,544,545,1,0,0,0,545,546,1,0,0,0,546,548,5,2,
+  	0,0,547,549,5,185,0,0,548,547,1,0,0,0,548,549,1,0,0,0,549,550,1,0,0,0,
+  	550,552,3,24,12,0,551,553,5,185,0,0,552,551,1,0,0,0,552,553,1,0,0,0,553,
+  	554,1,0,0,0,554,555,5,3,0,0,555,557,1,0,0,0,556,544,1,0,0,0,556,557,1,
+  	0,0,0,557,15,1,0,0,0,558,559,5,84,0,0,559,560,5,185,0,0,560,561,5,70,
+  	0,0,561,562,5,185,0,0,562,576,5,170,0,0,563,565,5,185,0,0,564,563,1,0,
+  	0,0,564,565,1,0,0,0,565,566,1,0,0,0,566,568,5,2,0,0,567,569,5,185,0,0,
+  	568,567,1,0,0,0,568,569,1,0,0,0,569,570,1,0,0,0,570,572,3,24,12,0,571,
+  	573,5,185,0,0,572,571,1,0,0,0,572,573,1,0,0,0,573,574,1,0,0,0,574,575,
+  	5,3,0,0,575,577,1,0,0,0,576,564,1,0,0,0,576,577,1,0,0,0,577,17,1,0,0,
+  	0,578,579,5,94,0,0,579,580,5,185,0,0,580,581,5,70,0,0,581,582,5,185,0,
+  	0,582,583,5,170,0,0,583,19,1,0,0,0,584,585,5,54,0,0,585,586,5,185,0,0,
+  	586,591,5,170,0,0,587,588,5,185,0,0,588,589,5,51,0,0,589,590,5,185,0,
+  	0,590,592,3,352,176,0,591,587,1,0,0,0,591,592,1,0,0,0,592,593,1,0,0,0,
+  	593,594,5,185,0,0,594,596,5,2,0,0,595,597,5,185,0,0,596,595,1,0,0,0,596,
+  	597,1,0,0,0,597,598,1,0,0,0,598,599,5,71,0,0,599,600,5,185,0,0,600,609,
+  	3,354,177,0,601,603,5,185,0,0,602,601,1,0,0,0,602,603,1,0,0,0,603,604,
+  	1,0,0,0,604,606,5,4,0,0,605,607,5,185,0,0,606,605,1,0,0,0,606,607,1,0,
+  	0,0,607,608,1,0,0,0,608,610,3,24,12,0,609,602,1,0,0,0,609,610,1,0,0,0,
+  	610,612,1,0,0,0,611,613,5,185,0,0,612,611,1,0,0,0,612,613,1,0,0,0,613,
+  	614,1,0,0,0,614,615,5,3,0,0,615,21,1,0,0,0,616,630,3,354,177,0,617,619,
+  	5,185,0,0,618,617,1,0,0,0,618,619,1,0,0,0,619,620,1,0,0,0,620,622,5,6,
+  	0,0,621,623,5,185,0,0,622,621,1,0,0,0,622,623,1,0,0,0,623,631,1,0,0,0,
+  	624,626,5,185,0,0,625,624,1,0,0,0,626,629,1,0,0,0,627,625,1,0,0,0,627,
+  	628,1,0,0,0,628,631,1,0,0,0,629,627,1,0,0,0,630,618,1,0,0,0,630,627,1,
+  	0,0,0,631,632,1,0,0,0,632,633,3,304,152,0,633,636,1,0,0,0,634,636,3,354,
+  	177,0,635,616,1,0,0,0,635,634,1,0,0,0,636,23,1,0,0,0,637,648,3,22,11,
+  	0,638,640,5,185,0,0,639,638,1,0,0,0,639,640,1,0,0,0,640,641,1,0,0,0,641,
+  	643,5,4,0,0,642,644,5,185,0,0,643,642,1,0,0,0,643,644,1,0,0,0,644,645,
+  	1,0,0,0,645,647,3,22,11,0,646,639,1,0,0,0,647,650,1,0,0,0,648,646,1,0,
+  	0,0,648,649,1,0,0,0,649,25,1,0,0,0,650,648,1,0,0,0,651,652,5,76,0,0,652,
+  	653,5,185,0,0,653,654,3,352,176,0,654,27,1,0,0,0,655,656,5,147,0,0,656,
+  	657,5,185,0,0,657,658,3,352,176,0,658,29,1,0,0,0,659,660,5,68,0,0,660,
+  	661,5,185,0,0,661,662,5,90,0,0,662,663,5,185,0,0,663,666,3,352,176,0,
+  	664,665,5,185,0,0,665,667,5,46,0,0,666,664,1,0,0,0,666,667,1,0,0,0,667,
+  	31,1,0,0,0,668,669,5,147,0,0,669,670,5,185,0,0,670,671,5,90,0,0,671,672,
+  	5,185,0,0,672,673,3,352,176,0,673,33,1,0,0,0,674,675,5,57,0,0,675,676,
+  	5,185,0,0,676,678,3,354,177,0,677,679,5,185,0,0,678,677,1,0,0,0,678,679,
+  	1,0,0,0,679,680,1,0,0,0,680,682,5,6,0,0,681,683,5,185,0,0,682,681,1,0,
+  	0,0,682,683,1,0,0,0,683,684,1,0,0,0,684,685,3,250,125,0,685,690,1,0,0,
+  	0,686,687,5,57,0,0,687,688,5,185,0,0,688,690,3,318,159,0,689,674,1,0,
+  	0,0,689,686,1,0,0,0,690,35,1,0,0,0,691,692,5,62,0,0,692,693,5,185,0,0,
+  	693,694,5,116,0,0,694,695,5,185,0,0,695,696,5,136,0,0,696,697,5,185,0,
+  	0,697,698,3,352,176,0,698,699,5,185,0,0,699,700,5,99,0,0,700,701,5,185,
+  	0,0,701,702,5,170,0,0,702,37,1,0,0,0,703,704,5,68,0,0,704,705,5,185,0,
+  	0,705,706,5,105,0,0,706,707,5,185,0,0,707,709,3,320,160,0,708,710,5,185,
+  	0,0,709,708,1,0,0,0,709,710,1,0,0,0,710,711,1,0,0,0,711,713,5,2,0,0,712,
+  	714,5,185,0,0,713,712,1,0,0,0,713,714,1,0,0,0,714,716,1,0,0,0,715,717,
+  	3,40,20,0,716,715,1,0,0,0,716,717,1,0,0,0,717,719,1,0,0,0,718,720,5,185,
+  	0,0,719,718,1,0,0,0,719,720,1,0,0,0,720,722,1,0,0,0,721,723,3,42,21,0,
+  	722,721,1,0,0,0,722,723,1,0,0,0,723,734,1,0,0,0,724,726,5,185,0,0,725,
+  	724,1,0,0,0,725,726,1,0,0,0,726,727,1,0,0,0,727,729,5,4,0,0,728,730,5,
+  	185,0,0,729,728,1,0,0,0,729,730,1,0,0,0,730,731,1,0,0,0,731,733,3,42,
+  	21,0,732,725,1,0,0,0,733,736,1,0,0,0,734,732,1,0,0,0,734,735,1,0,0,0,
+  	735,738,1,0,0,0,736,734,1,0,0,0,737,739,5,185,0,0,738,737,1,0,0,0,738,
+  	739,1,0,0,0,739,740,1,0,0,0,740,741,5,3,0,0,741,742,5,185,0,0,742,743,
+  	5,51,0,0,743,744,5,185,0,0,744,745,3,250,125,0,745,39,1,0,0,0,746,757,
+  	3,354,177,0,747,749,5,185,0,0,748,747,1,0,0,0,748,749,1,0,0,0,749,750,
+  	1,0,0,0,750,752,5,4,0,0,751,753,5,185,0,0,752,751,1,0,0,0,752,753,1,0,
+  	0,0,753,754,1,0,0,0,754,756,3,354,177,0,755,748,1,0,0,0,756,759,1,0,0,
+  	0,757,755,1,0,0,0,757,758,1,0,0,0,758,41,1,0,0,0,759,757,1,0,0,0,760,
+  	762,3,354,177,0,761,763,5,185,0,0,762,761,1,0,0,0,762,763,1,0,0,0,763,
+  	764,1,0,0,0,764,765,5,166,0,0,765,767,5,6,0,0,766,768,5,185,0,0,767,766,
+  	1,0,0,0,767,768,1,0,0,0,768,769,1,0,0,0,769,770,3,304,152,0,770,43,1,
+  	0,0,0,771,773,5,7,0,0,772,774,5,185,0,0,773,772,1,0,0,0,773,774,1,0,0,
+  	0,774,775,1,0,0,0,775,786,5,170,0,0,776,778,5,185,0,0,777,776,1,0,0,0,
+  	777,778,1,0,0,0,778,779,1,0,0,0,779,781,5,4,0,0,780,782,5,185,0,0,781,
+  	780,1,0,0,0,781,782,1,0,0,0,782,783,1,0,0,0,783,785,5,170,0,0,784,777,
+  	1,0,0,0,785,788,1,0,0,0,786,784,1,0,0,0,786,787,1,0,0,0,787,789,1,0,0,
+  	0,788,786,1,0,0,0,789,805,5,8,0,0,790,805,5,170,0,0,791,793,5,89,0,0,
+  	792,794,5,185,0,0,793,792,1,0,0,0,793,794,1,0,0,0,794,795,1,0,0,0,795,
+  	797,5,2,0,0,796,798,5,185,0,0,797,796,1,0,0,0,797,798,1,0,0,0,798,799,
+  	1,0,0,0,799,801,5,170,0,0,800,802,5,185,0,0,801,800,1,0,0,0,801,802,1,
+  	0,0,0,802,803,1,0,0,0,803,805,5,3,0,0,804,771,1,0,0,0,804,790,1,0,0,0,
+  	804,791,1,0,0,0,805,45,1,0,0,0,806,807,5,95,0,0,807,808,5,185,0,0,808,
+  	809,5,113,0,0,809,810,5,185,0,0,810,811,5,82,0,0,811,47,1,0,0,0,812,813,
+  	5,68,0,0,813,814,5,185,0,0,814,815,5,112,0,0,815,816,5,185,0,0,816,817,
+  	5,136,0,0,817,821,5,185,0,0,818,819,3,46,23,0,819,820,5,185,0,0,820,822,
+  	1,0,0,0,821,818,1,0,0,0,821,822,1,0,0,0,822,823,1,0,0,0,823,851,3,352,
+  	176,0,824,826,5,185,0,0,825,824,1,0,0,0,825,826,1,0,0,0,826,827,1,0,0,
+  	0,827,829,5,2,0,0,828,830,5,185,0,0,829,828,1,0,0,0,829,830,1,0,0,0,830,
+  	831,1,0,0,0,831,833,3,104,52,0,832,834,5,185,0,0,833,832,1,0,0,0,833,
+  	834,1,0,0,0,834,840,1,0,0,0,835,837,5,4,0,0,836,838,5,185,0,0,837,836,
+  	1,0,0,0,837,838,1,0,0,0,838,839,1,0,0,0,839,841,3,108,54,0,840,835,1,
+  	0,0,0,840,841,1,0,0,0,841,843,1,0,0,0,842,844,5,185,0,0,843,842,1,0,0,
+  	0,843,844,1,0,0,0,844,845,1,0,0,0,845,846,5,3,0,0,846,852,1,0,0,0,847,
+  	848,5,185,0,0,848,849,5,51,0,0,849,850,5,185,0,0,850,852,3,142,71,0,851,
+  	825,1,0,0,0,851,847,1,0,0,0,852,868,1,0,0,0,853,854,5,185,0,0,854,856,
+  	5,151,0,0,855,857,5,185,0,0,856,855,1,0,0,0,856,857,1,0,0,0,857,858,1,
+  	0,0,0,858,860,5,2,0,0,859,861,5,185,0,0,860,859,1,0,0,0,860,861,1,0,0,
+  	0,861,862,1,0,0,0,862,864,3,24,12,0,863,865,5,185,0,0,864,863,1,0,0,0,
+  	864,865,1,0,0,0,865,866,1,0,0,0,866,867,5,3,0,0,867,869,1,0,0,0,868,853,
+  	1,0,0,0,868,869,1,0,0,0,869,49,1,0,0,0,870,871,5,68,0,0,871,872,5,185,
+  	0,0,872,873,5,125,0,0,873,874,5,185,0,0,874,877,5,136,0,0,875,876,5,185,
+  	0,0,876,878,5,91,0,0,877,875,1,0,0,0,877,878,1,0,0,0,878,881,1,0,0,0,
+  	879,880,5,185,0,0,880,882,3,46,23,0,881,879,1,0,0,0,881,882,1,0,0,0,882,
+  	883,1,0,0,0,883,884,5,185,0,0,884,886,3,352,176,0,885,887,5,185,0,0,886,
+  	885,1,0,0,0,886,887,1,0,0,0,887,888,1,0,0,0,888,890,5,2,0,0,889,891,5,
+  	185,0,0,890,889,1,0,0,0,890,891,1,0,0,0,891,892,1,0,0,0,892,894,3,52,
+  	26,0,893,895,5,185,0,0,894,893,1,0,0,0,894,895,1,0,0,0,895,922,1,0,0,
+  	0,896,898,5,4,0,0,897,899,5,185,0,0,898,897,1,0,0,0,898,899,1,0,0,0,899,
+  	900,1,0,0,0,900,902,3,104,52,0,901,903,5,185,0,0,902,901,1,0,0,0,902,
+  	903,1,0,0,0,903,905,1,0,0,0,904,896,1,0,0,0,904,905,1,0,0,0,905,914,1,
+  	0,0,0,906,908,5,4,0,0,907,909,5,185,0,0,908,907,1,0,0,0,908,909,1,0,0,
+  	0,909,910,1,0,0,0,910,912,3,354,177,0,911,913,5,185,0,0,912,911,1,0,0,
+  	0,912,913,1,0,0,0,913,915,1,0,0,0,914,906,1,0,0,0,914,915,1,0,0,0,915,
+  	916,1,0,0,0,916,923,5,3,0,0,917,918,5,3,0,0,918,919,5,185,0,0,919,920,
+  	5,51,0,0,920,921,5,185,0,0,921,923,3,142,71,0,922,904,1,0,0,0,922,917,
+  	1,0,0,0,923,939,1,0,0,0,924,925,5,185,0,0,925,927,5,151,0,0,926,928,5,
+  	185,0,0,927,926,1,0,0,0,927,928,1,0,0,0,928,929,1,0,0,0,929,931,5,2,0,
+  	0,930,932,5,185,0,0,931,930,1,0,0,0,931,932,1,0,0,0,932,933,1,0,0,0,933,
+  	935,3,24,12,0,934,936,5,185,0,0,935,934,1,0,0,0,935,936,1,0,0,0,936,937,
+  	1,0,0,0,937,938,5,3,0,0,938,940,1,0,0,0,939,924,1,0,0,0,939,940,1,0,0,
+  	0,940,51,1,0,0,0,941,952,3,54,27,0,942,944,5,185,0,0,943,942,1,0,0,0,
+  	943,944,1,0,0,0,944,945,1,0,0,0,945,947,5,4,0,0,946,948,5,185,0,0,947,
+  	946,1,0,0,0,947,948,1,0,0,0,948,949,1,0,0,0,949,951,3,54,27,0,950,943,
+  	1,0,0,0,951,954,1,0,0,0,952,950,1,0,0,0,952,953,1,0,0,0,953,53,1,0,0,
+  	0,954,952,1,0,0,0,955,956,5,87,0,0,956,957,5,185,0,0,957,958,3,352,176,
+  	0,958,959,5,185,0,0,959,960,5,138,0,0,960,961,5,185,0,0,961,962,3,352,
+  	176,0,962,55,1,0,0,0,963,964,5,68,0,0,964,965,5,185,0,0,965,966,5,130,
+  	0,0,966,970,5,185,0,0,967,968,3,46,23,0,968,969,5,185,0,0,969,971,1,0,
+  	0,0,970,967,1,0,0,0,970,971,1,0,0,0,971,972,1,0,0,0,972,977,3,352,176,
+  	0,973,974,5,185,0,0,974,976,3,60,30,0,975,973,1,0,0,0,976,979,1,0,0,0,
+  	977,975,1,0,0,0,977,978,1,0,0,0,978,57,1,0,0,0,979,977,1,0,0,0,980,981,
+  	5,68,0,0,981,982,5,185,0,0,982,983,5,142,0,0,983,984,5,185,0,0,984,985,
+  	3,352,176,0,985,986,5,185,0,0,986,987,5,51,0,0,987,988,5,185,0,0,988,
+  	990,3,118,59,0,989,991,5,185,0,0,990,989,1,0,0,0,990,991,1,0,0,0,991,
+  	59,1,0,0,0,992,998,3,68,34,0,993,998,3,70,35,0,994,998,3,72,36,0,995,
+  	998,3,74,37,0,996,998,3,76,38,0,997,992,1,0,0,0,997,993,1,0,0,0,997,994,
+  	1,0,0,0,997,995,1,0,0,0,997,996,1,0,0,0,997,2970,1,0,0,0,998,61,1,0,0,
+  	0,999,1000,5,185,0,0,1000,1001,5,151,0,0,1001,1002,5,185,0,0,1002,1003,
+  	5,158,0,0,1003,1004,5,185,0,0,1004,1005,5,170,0,0,1005,63,1,0,0,0,1006,
+  	1007,5,68,0,0,1007,1008,5,185,0,0,1008,1009,5,157,0,0,1009,1013,5,185,
+  	0,0,1010,1011,3,46,23,0,1011,1012,5,185,0,0,1012,1014,1,0,0,0,1013,1010,
+  	1,0,0,0,1013,1014,1,0,0,0,1014,1015,1,0,0,0,1015,1017,3,338,169,0,1016,
+  	1018,3,62,31,0,1017,1016,1,0,0,0,1017,1018,1,0,0,0,1018,65,1,0,0,0,1019,
+  	1020,5,68,0,0,1020,1021,5,185,0,0,1021,1022,5,159,0,0,1022,1026,5,185,
+  	0,0,1023,1024,3,46,23,0,1024,1025,5,185,0,0,1025,1027,1,0,0,0,1026,1023,
+  	1,0,0,0,1026,1027,1,0,0,0,1027,1028,1,0,0,0,1028,1029,3,338,169,0,1029,
+  	67,1,0,0,0,1030,1031,5,97,0,0,1031,1034,5,185,0,0,1032,1033,5,56,0,0,
+  	1033,1035,5,185,0,0,1034,1032,1,0,0,0,1034,1035,1,0,0,0,1035,1037,1,0,
+  	0,0,1036,1038,5,168,0,0,1037,1036,1,0,0,0,1037,1038,1,0,0,0,1038,1039,
+  	1,0,0,0,1039,1040,3,348,174,0,1040,69,1,0,0,0,1041,1042,5,111,0,0,1042,
+  	1043,5,185,0,0,1043,1051,5,109,0,0,1044,1045,5,109,0,0,1045,1047,5,185,
+  	0,0,1046,1048,5,168,0,0,1047,1046,1,0,0,0,1047,1048,1,0,0,0,1048,1049,
+  	1,0,0,0,1049,1051,3,348,174,0,1050,1041,1,0,0,0,1050,1044,1,0,0,0,1051,
+  	71,1,0,0,0,1052,1053,5,111,0,0,1053,1054,5,185,0,0,1054,1062,5,107,0,
+  	0,1055,1056,5,107,0,0,1056,1058,5,185,0,0,1057,1059,5,168,0,0,1058,1057,
+  	1,0,0,0,1058,1059,1,0,0,0,1059,1060,1,0,0,0,1060,1062,3,348,174,0,1061,
+  	1052,1,0,0,0,1061,1055,1,0,0,0,1062,73,1,0,0,0,1063,1064,5,133,0,0,1064,
+  	1067,5,185,0,0,1065,1066,5,151,0,0,1066,1068,5,185,0,0,1067,1065,1,0,
+  	0,0,1067,1068,1,0,0,0,1068,1070,1,0,0,0,1069,1071,5,168,0,0,1070,1069,
+  	1,0,0,0,1070,1071,1,0,0,0,1071,1072,1,0,0,0,1072,1073,3,348,174,0,1073,
+  	75,1,0,0,0,1074,1075,5,111,0,0,1075,1077,5,185,0,0,1076,1074,1,0,0,0,
+  	1076,1077,1,0,0,0,1077,1078,1,0,0,0,1078,1079,5,69,0,0,1079,77,1,0,0,
+  	0,1080,1081,5,95,0,0,1081,1082,5,185,0,0,1082,1083,5,82,0,0,1083,79,1,
+  	0,0,0,1084,1085,5,78,0,0,1085,1086,5,185,0,0,1086,1087,7,0,0,0,1087,1091,
+  	5,185,0,0,1088,1089,3,78,39,0,1089,1090,5,185,0,0,1090,1092,1,0,0,0,1091,
+  	1088,1,0,0,0,1091,1092,1,0,0,0,1092,1093,1,0,0,0,1093,1094,3,352,176,
+  	0,1094,81,1,0,0,0,1095,1096,5,49,0,0,1096,1097,5,185,0,0,1097,1098,5,
+  	136,0,0,1098,1099,5,185,0,0,1099,1100,3,352,176,0,1100,1101,5,185,0,0,
+  	1101,1102,3,84,42,0,1102,83,1,0,0,0,1103,1110,3,86,43,0,1104,1110,3,90,
+  	45,0,1105,1110,3,92,46,0,1106,1110,3,94,47,0,1107,1110,3,96,48,0,1108,
+  	1110,3,98,49,0,1109,1103,1,0,0,0,1109,1104,1,0,0,0,1109,1105,1,0,0,0,
+  	1109,1106,1,0,0,0,1109,1107,1,0,0,0,1109,1108,1,0,0,0,1110,85,1,0,0,0,
+  	1111,1112,5,47,0,0,1112,1116,5,185,0,0,1113,1114,3,46,23,0,1114,1115,
+  	5,185,0,0,1115,1117,1,0,0,0,1116,1113,1,0,0,0,1116,1117,1,0,0,0,1117,
+  	1118,1,0,0,0,1118,1119,3,346,173,0,1119,1120,5,185,0,0,1120,1123,3,118,
+  	59,0,1121,1122,5,185,0,0,1122,1124,3,88,44,0,1123,1121,1,0,0,0,1123,1124,
+  	1,0,0,0,1124,87,1,0,0,0,1125,1126,5,72,0,0,1126,1127,5,185,0,0,1127,1128,
+  	3,250,125,0,1128,89,1,0,0,0,1129,1130,5,78,0,0,1130,1134,5,185,0,0,1131,
   	1132,3,78,39,0,1132,1133,5,185,0,0,1133,1135,1,0,0,0,1134,1131,1,0,0,
   	0,1134,1135,1,0,0,0,1135,1136,1,0,0,0,1136,1137,3,346,173,0,1137,91,1,
   	0,0,0,1138,1139,5,126,0,0,1139,1140,5,185,0,0,1140,1141,5,138,0,0,1141,
@@ -1300,41 +1301,43 @@ void cypherParserInitialize() {
   	0,0,2958,2960,3,356,178,0,2959,2954,1,0,0,0,2959,2955,1,0,0,0,2959,2957,
   	1,0,0,0,2959,2958,1,0,0,0,2960,355,1,0,0,0,2961,2962,7,10,0,0,2962,357,
   	1,0,0,0,2963,2964,7,11,0,0,2964,359,1,0,0,0,2965,2966,7,12,0,0,2966,361,
-  	1,0,0,0,2967,2968,7,13,0,0,2968,363,1,0,0,0,505,366,370,375,379,384,387,
-  	391,394,420,426,433,437,441,445,448,452,456,460,465,469,471,478,482,491,
-  	496,506,510,514,519,532,536,544,548,552,556,564,568,572,576,591,596,602,
-  	606,609,612,618,622,627,630,635,639,643,648,666,678,682,689,709,713,716,
-  	719,722,725,729,734,738,748,752,757,762,767,773,777,781,786,793,797,801,
-  	804,821,825,829,833,837,840,843,851,856,860,864,868,877,881,886,890,894,
-  	898,902,904,908,912,914,922,927,931,935,939,943,947,952,970,977,990,997,
-  	1013,1017,1026,1034,1037,1047,1050,1058,1061,1067,1070,1076,1091,1109,
-  	1116,1123,1134,1157,1166,1172,1176,1181,1190,1194,1199,1205,1211,1217,
-  	1221,1225,1231,1235,1239,1245,1249,1253,1259,1263,1267,1271,1275,1281,
-  	1285,1289,1293,1297,1307,1313,1320,1325,1331,1336,1356,1362,1368,1372,
-  	1376,1385,1399,1404,1409,1413,1418,1424,1429,1432,1436,1440,1444,1450,
-  	1454,1459,1464,1468,1471,1473,1477,1481,1487,1491,1496,1500,1510,1516,
-  	1524,1528,1532,1536,1543,1547,1551,1555,1558,1561,1568,1574,1578,1583,
-  	1590,1593,1596,1601,1605,1609,1614,1618,1627,1631,1636,1650,1652,1654,
-  	1659,1669,1675,1682,1687,1691,1694,1706,1710,1714,1718,1723,1728,1732,
-  	1736,1740,1744,1748,1754,1758,1762,1766,1771,1777,1780,1786,1789,1795,
-  	1799,1803,1807,1811,1816,1821,1825,1830,1833,1842,1851,1856,1869,1872,
-  	1880,1884,1889,1894,1898,1903,1909,1914,1921,1925,1929,1931,1935,1937,
-  	1941,1943,1949,1955,1959,1962,1965,1971,1974,1977,1981,1987,1990,1993,
-  	1997,2001,2005,2007,2011,2013,2017,2019,2023,2025,2031,2035,2039,2043,
-  	2047,2051,2055,2059,2063,2066,2072,2076,2080,2083,2088,2093,2097,2101,
-  	2104,2107,2112,2117,2120,2123,2126,2129,2132,2136,2140,2144,2148,2158,
-  	2161,2164,2168,2171,2174,2178,2182,2186,2190,2194,2198,2200,2203,2207,
-  	2211,2215,2219,2221,2227,2230,2233,2244,2257,2267,2277,2282,2286,2293,
-  	2297,2301,2305,2309,2317,2321,2325,2329,2335,2339,2345,2349,2354,2359,
-  	2363,2368,2373,2377,2383,2390,2394,2400,2407,2411,2417,2424,2428,2433,
-  	2441,2444,2449,2458,2462,2465,2478,2481,2486,2500,2504,2508,2513,2516,
-  	2520,2525,2537,2541,2545,2549,2555,2559,2563,2569,2573,2577,2583,2587,
-  	2591,2595,2613,2619,2623,2627,2631,2634,2640,2643,2647,2651,2655,2659,
-  	2663,2670,2673,2677,2683,2687,2693,2697,2701,2706,2710,2714,2718,2723,
-  	2726,2729,2735,2739,2743,2745,2749,2753,2757,2761,2764,2768,2774,2779,
-  	2781,2785,2789,2794,2798,2803,2807,2811,2815,2819,2824,2828,2833,2837,
-  	2841,2845,2849,2852,2855,2858,2861,2867,2871,2875,2880,2884,2888,2893,
-  	2895,2898,2902,2905,2908,2914,2918,2922,2930,2935,2939,2952,2959
+  	1,0,0,0,2967,2968,7,13,0,0,2968,363,1,0,0,0,2970,998,3,2971,182,0,2971,
+  	2973,1,0,0,0,2973,2974,5,189,0,0,2974,2975,5,185,0,0,2975,2976,3,348,
+  	174,0,2976,2972,1,0,0,0,505,366,370,375,379,384,387,391,394,420,426,433,
+  	437,441,445,448,452,456,460,465,469,471,478,482,491,496,506,510,514,519,
+  	532,536,544,548,552,556,564,568,572,576,591,596,602,606,609,612,618,622,
+  	627,630,635,639,643,648,666,678,682,689,709,713,716,719,722,725,729,734,
+  	738,748,752,757,762,767,773,777,781,786,793,797,801,804,821,825,829,833,
+  	837,840,843,851,856,860,864,868,877,881,886,890,894,898,902,904,908,912,
+  	914,922,927,931,935,939,943,947,952,970,977,990,997,1013,1017,1026,1034,
+  	1037,1047,1050,1058,1061,1067,1070,1076,1091,1109,1116,1123,1134,1157,
+  	1166,1172,1176,1181,1190,1194,1199,1205,1211,1217,1221,1225,1231,1235,
+  	1239,1245,1249,1253,1259,1263,1267,1271,1275,1281,1285,1289,1293,1297,
+  	1307,1313,1320,1325,1331,1336,1356,1362,1368,1372,1376,1385,1399,1404,
+  	1409,1413,1418,1424,1429,1432,1436,1440,1444,1450,1454,1459,1464,1468,
+  	1471,1473,1477,1481,1487,1491,1496,1500,1510,1516,1524,1528,1532,1536,
+  	1543,1547,1551,1555,1558,1561,1568,1574,1578,1583,1590,1593,1596,1601,
+  	1605,1609,1614,1618,1627,1631,1636,1650,1652,1654,1659,1669,1675,1682,
+  	1687,1691,1694,1706,1710,1714,1718,1723,1728,1732,1736,1740,1744,1748,
+  	1754,1758,1762,1766,1771,1777,1780,1786,1789,1795,1799,1803,1807,1811,
+  	1816,1821,1825,1830,1833,1842,1851,1856,1869,1872,1880,1884,1889,1894,
+  	1898,1903,1909,1914,1921,1925,1929,1931,1935,1937,1941,1943,1949,1955,
+  	1959,1962,1965,1971,1974,1977,1981,1987,1990,1993,1997,2001,2005,2007,
+  	2011,2013,2017,2019,2023,2025,2031,2035,2039,2043,2047,2051,2055,2059,
+  	2063,2066,2072,2076,2080,2083,2088,2093,2097,2101,2104,2107,2112,2117,
+  	2120,2123,2126,2129,2132,2136,2140,2144,2148,2158,2161,2164,2168,2171,
+  	2174,2178,2182,2186,2190,2194,2198,2200,2203,2207,2211,2215,2219,2221,
+  	2227,2230,2233,2244,2257,2267,2277,2282,2286,2293,2297,2301,2305,2309,
+  	2317,2321,2325,2329,2335,2339,2345,2349,2354,2359,2363,2368,2373,2377,
+  	2383,2390,2394,2400,2407,2411,2417,2424,2428,2433,2441,2444,2449,2458,
+  	2462,2465,2478,2481,2486,2500,2504,2508,2513,2516,2520,2525,2537,2541,
+  	2545,2549,2555,2559,2563,2569,2573,2577,2583,2587,2591,2595,2613,2619,
+  	2623,2627,2631,2634,2640,2643,2647,2651,2655,2659,2663,2670,2673,2677,
+  	2683,2687,2693,2697,2701,2706,2710,2714,2718,2723,2726,2729,2735,2739,
+  	2743,2745,2749,2753,2757,2761,2764,2768,2774,2779,2781,2785,2789,2794,
+  	2798,2803,2807,2811,2815,2819,2824,2828,2833,2837,2841,2845,2849,2852,
+  	2855,2858,2861,2867,2871,2875,2880,2884,2888,2893,2895,2898,2902,2905,
+  	2908,2914,2918,2922,2930,2935,2939,2952,2959
   };
   staticData->serializedATN = antlr4::atn::SerializedATNView(serializedATNSegment, sizeof(serializedATNSegment) / sizeof(serializedATNSegment[0]));
 
@@ -2093,7 +2096,7 @@ CypherParser::KU_ColumnNamesContext* CypherParser::kU_ColumnNames() {
     if ((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & -3185593048922849280) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 65)) & -287985230644762313) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 130)) & 20275020123575595) != 0)) {
+      ((1ULL << (_la - 130)) & 20275020123575595) != 0) || _la == CypherParser::CACHE) {
       setState(454);
       oC_SchemaName();
       setState(465);
@@ -3698,7 +3701,7 @@ CypherParser::KU_CreateMacroContext* CypherParser::kU_CreateMacro() {
     if ((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & -3185593048922849280) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 65)) & -287985230644762313) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 130)) & 20275020123575595) != 0)) {
+      ((1ULL << (_la - 130)) & 20275020123575595) != 0) || _la == CypherParser::CACHE) {
       setState(721);
       kU_DefaultArg();
     }
@@ -5079,6 +5082,10 @@ CypherParser::KU_CycleContext* CypherParser::KU_SequenceOptionsContext::kU_Cycle
   return getRuleContext<CypherParser::KU_CycleContext>(0);
 }
 
+CypherParser::KU_CacheContext* CypherParser::KU_SequenceOptionsContext::kU_Cache() {
+  return getRuleContext<CypherParser::KU_CacheContext>(0);
+}
+
 
 size_t CypherParser::KU_SequenceOptionsContext::getRuleIndex() const {
   return CypherParser::RuleKU_SequenceOptions;
@@ -5135,6 +5142,13 @@ CypherParser::KU_SequenceOptionsContext* CypherParser::kU_SequenceOptions() {
       break;
     }
 
+    case 6: {
+      enterOuterAlt(_localctx, 6);
+      setState(2970);
+      kU_Cache();
+      break;
+    }
+
     default:
       break;
     }
@@ -5819,6 +5833,60 @@ CypherParser::KU_CycleContext* CypherParser::kU_Cycle() {
   return _localctx;
 }
 
+//----------------- KU_CacheContext ------------------------------------------------------------------
+
+CypherParser::KU_CacheContext::KU_CacheContext(ParserRuleContext *parent, size_t invokingState)
+  : ParserRuleContext(parent, invokingState) {
+}
+
+tree::TerminalNode* CypherParser::KU_CacheContext::CACHE() {
+  return getToken(CypherParser::CACHE, 0);
+}
+
+tree::TerminalNode* CypherParser::KU_CacheContext::SP() {
+  return getToken(CypherParser::SP, 0);
+}
+
+CypherParser::OC_IntegerLiteralContext* CypherParser::KU_CacheContext::oC_IntegerLiteral() {
+  return getRuleContext<CypherParser::OC_IntegerLiteralContext>(0);
+}
+
+
+size_t CypherParser::KU_CacheContext::getRuleIndex() const {
+  return CypherParser::RuleKU_Cache;
+}
+
+
+CypherParser::KU_CacheContext* CypherParser::kU_Cache() {
+  KU_CacheContext *_localctx = _tracker.createInstance<KU_CacheContext>(_ctx, getState());
+  enterRule(_localctx, 2971, CypherParser::RuleKU_Cache);
+
+#if __cplusplus > 201703L
+  auto onExit = finally([=, this] {
+#else
+  auto onExit = finally([=] {
+#endif
+    exitRule();
+  });
+  try {
+    enterOuterAlt(_localctx, 1);
+    setState(2973);
+    match(CypherParser::CACHE);
+    setState(2974);
+    match(CypherParser::SP);
+    setState(2975);
+    oC_IntegerLiteral();
+   
+  }
+  catch (RecognitionException &e) {
+    _errHandler->reportError(this, e);
+    _localctx->exception = std::current_exception();
+    _errHandler->recover(this, _localctx->exception);
+  }
+
+  return _localctx;
+}
+
 //----------------- KU_IfExistsContext ------------------------------------------------------------------
 
 CypherParser::KU_IfExistsContext::KU_IfExistsContext(ParserRuleContext *parent, size_t invokingState)
@@ -8222,6 +8290,7 @@ CypherParser::KU_LoadExtensionContext* CypherParser::kU_LoadExtension() {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -10143,6 +10212,7 @@ CypherParser::KU_JoinNodeContext* CypherParser::kU_JoinNode(int precedence) {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -11411,6 +11481,7 @@ CypherParser::OC_ProjectionItemsContext* CypherParser::oC_ProjectionItems() {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -12098,6 +12169,7 @@ CypherParser::OC_PatternPartContext* CypherParser::oC_PatternPart() {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -12408,7 +12480,7 @@ CypherParser::OC_NodePatternContext* CypherParser::oC_NodePattern() {
     if ((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & -3185593048922849280) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 65)) & -287985230644762313) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 130)) & 20275020123575595) != 0)) {
+      ((1ULL << (_la - 130)) & 20275020123575595) != 0) || _la == CypherParser::CACHE) {
       setState(1927);
       oC_Variable();
       setState(1929);
@@ -12797,7 +12869,7 @@ CypherParser::OC_RelationshipDetailContext* CypherParser::oC_RelationshipDetail(
     if ((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & -3185593048922849280) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 65)) & -287985230644762313) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 130)) & 20275020123575595) != 0)) {
+      ((1ULL << (_la - 130)) & 20275020123575595) != 0) || _la == CypherParser::CACHE) {
       setState(2003);
       oC_Variable();
       setState(2005);
@@ -12945,7 +13017,7 @@ CypherParser::KU_PropertiesContext* CypherParser::kU_Properties() {
     if ((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & -3185593048922849280) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 65)) & -287985230644762313) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 130)) & 20275020123575595) != 0)) {
+      ((1ULL << (_la - 130)) & 20275020123575595) != 0) || _la == CypherParser::CACHE) {
       setState(2033);
       oC_PropertyKeyName();
       setState(2035);
@@ -13936,7 +14008,7 @@ CypherParser::KU_RecursiveProjectionItemsContext* CypherParser::kU_RecursiveProj
     if ((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & -2320550076713270652) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 65)) & -286014905805559497) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 130)) & 21969651043376427) != 0)) {
+      ((1ULL << (_la - 130)) & 21969651043376427) != 0) || _la == CypherParser::CACHE) {
       setState(2229);
       oC_ProjectionItems();
     }
@@ -15646,7 +15718,7 @@ CypherParser::OC_ListOperatorExpressionContext* CypherParser::oC_ListOperatorExp
       if ((((_la & ~ 0x3fULL) == 0) &&
         ((1ULL << _la) & -2320550076713270652) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
         ((1ULL << (_la - 65)) & -286014905805559497) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-        ((1ULL << (_la - 130)) & 21969642453441835) != 0)) {
+        ((1ULL << (_la - 130)) & 21969642453441835) != 0) || _la == CypherParser::CACHE) {
         setState(2457);
         oC_Expression();
       }
@@ -15668,7 +15740,7 @@ CypherParser::OC_ListOperatorExpressionContext* CypherParser::oC_ListOperatorExp
       if ((((_la & ~ 0x3fULL) == 0) &&
         ((1ULL << _la) & -2320550076713270652) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
         ((1ULL << (_la - 65)) & -286014905805559497) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-        ((1ULL << (_la - 130)) & 21969642453441835) != 0)) {
+        ((1ULL << (_la - 130)) & 21969642453441835) != 0) || _la == CypherParser::CACHE) {
         setState(2461);
         oC_Expression();
       }
@@ -16845,7 +16917,7 @@ CypherParser::OC_ListLiteralContext* CypherParser::oC_ListLiteral() {
     if ((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & -2320550076713270652) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 65)) & -286014905805559497) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 130)) & 21969642453441835) != 0)) {
+      ((1ULL << (_la - 130)) & 21969642453441835) != 0) || _la == CypherParser::CACHE) {
       setState(2621);
       oC_Expression();
       setState(2623);
@@ -16944,7 +17016,7 @@ CypherParser::KU_ListEntryContext* CypherParser::kU_ListEntry() {
     if ((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & -2320550076713270652) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 65)) & -286014905805559497) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 130)) & 21969642453441835) != 0)) {
+      ((1ULL << (_la - 130)) & 21969642453441835) != 0) || _la == CypherParser::CACHE) {
       setState(2642);
       oC_Expression();
     }
@@ -17129,6 +17201,7 @@ CypherParser::KU_StructFieldContext* CypherParser::kU_StructField() {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -17535,7 +17608,7 @@ CypherParser::OC_FunctionInvocationContext* CypherParser::oC_FunctionInvocation(
       if ((((_la & ~ 0x3fULL) == 0) &&
         ((1ULL << _la) & -2320550076713270652) != 0) || ((((_la - 65) & ~ 0x3fULL) == 0) &&
         ((1ULL << (_la - 65)) & -286014905805559497) != 0) || ((((_la - 130) & ~ 0x3fULL) == 0) &&
-        ((1ULL << (_la - 130)) & 21969642453441835) != 0)) {
+        ((1ULL << (_la - 130)) & 21969642453441835) != 0) || _la == CypherParser::CACHE) {
         setState(2747);
         kU_FunctionParameter();
         setState(2749);
@@ -17901,6 +17974,7 @@ CypherParser::KU_LambdaVarsContext* CypherParser::kU_LambdaVars() {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -18342,6 +18416,7 @@ CypherParser::OC_PropertyLookupContext* CypherParser::oC_PropertyLookup() {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -18866,6 +18941,7 @@ CypherParser::OC_ParameterContext* CypherParser::oC_Parameter() {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -19285,6 +19361,7 @@ CypherParser::OC_SymbolicNameContext* CypherParser::oC_SymbolicName() {
       case CypherParser::COPY:
       case CypherParser::COUNT:
       case CypherParser::CYCLE:
+      case CypherParser::CACHE:
       case CypherParser::DATABASE:
       case CypherParser::DELETE:
       case CypherParser::DETACH:
@@ -19641,7 +19718,7 @@ CypherParser::KU_NonReservedKeywordsContext* CypherParser::kU_NonReservedKeyword
     _la = _input->LA(1);
     if (!(((((_la - 47) & ~ 0x3fULL) == 0) &&
       ((1ULL << (_la - 47)) & 8923191552623093653) != 0) || ((((_la - 111) & ~ 0x3fULL) == 0) &&
-      ((1ULL << (_la - 111)) & 13478074072690691) != 0))) {
+      ((1ULL << (_la - 111)) & 13478074072690691) != 0) || _la == CypherParser::CACHE)) {
     _errHandler->recoverInline(this);
     }
     else {
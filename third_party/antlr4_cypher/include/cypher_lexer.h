@@ -45,7 +45,7 @@ public:
     Digit = 175, NonZeroDigit = 176, NonZeroOctDigit = 177, ZeroDigit = 178, 
     ExponentDecimalReal = 179, RegularDecimalReal = 180, UnescapedSymbolicName = 181, 
     IdentifierStart = 182, IdentifierPart = 183, EscapedSymbolicName = 184, 
-    SP = 185, WHITESPACE = 186, CypherComment = 187, Unknown = 188
+    SP = 185, WHITESPACE = 186, CypherComment = 187, Unknown = 188, CACHE = 189
   };
 
   explicit CypherLexer(antlr4::CharStream *input);
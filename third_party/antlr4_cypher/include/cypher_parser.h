@@ -45,7 +45,7 @@ public:
     Digit = 175, NonZeroDigit = 176, NonZeroOctDigit = 177, ZeroDigit = 178, 
     ExponentDecimalReal = 179, RegularDecimalReal = 180, UnescapedSymbolicName = 181, 
     IdentifierStart = 182, IdentifierPart = 183, EscapedSymbolicName = 184, 
-    SP = 185, WHITESPACE = 186, CypherComment = 187, Unknown = 188
+    SP = 185, WHITESPACE = 186, CypherComment = 187, Unknown = 188, CACHE = 189
   };
 
   enum {
@@ -110,7 +110,7 @@ public:
     RuleOC_PropertyExpression = 172, RuleOC_PropertyKeyName = 173, RuleOC_IntegerLiteral = 174, 
     RuleOC_DoubleLiteral = 175, RuleOC_SchemaName = 176, RuleOC_SymbolicName = 177, 
     RuleKU_NonReservedKeywords = 178, RuleOC_LeftArrowHead = 179, RuleOC_RightArrowHead = 180, 
-    RuleOC_Dash = 181
+    RuleOC_Dash = 181, RuleKU_Cache = 182
   };
 
   explicit CypherParser(antlr4::TokenStream *input);
@@ -169,6 +169,7 @@ public:
   class KU_MaxValueContext;
   class KU_StartWithContext;
   class KU_CycleContext;
+  class KU_CacheContext;
   class KU_IfExistsContext;
   class KU_DropContext;
   class KU_AlterTableContext;
@@ -832,6 +833,7 @@ public:
     KU_MaxValueContext *kU_MaxValue();
     KU_StartWithContext *kU_StartWith();
     KU_CycleContext *kU_Cycle();
+    KU_CacheContext *kU_Cache();
 
    
   };
@@ -961,6 +963,19 @@ public:
 
   KU_CycleContext* kU_Cycle();
 
+  class  KU_CacheContext : public antlr4::ParserRuleContext {
+  public:
+    KU_CacheContext(antlr4::ParserRuleContext *parent, size_t invokingState);
+    virtual size_t getRuleIndex() const override;
+    antlr4::tree::TerminalNode *CACHE();
+    antlr4::tree::TerminalNode *SP();
+    OC_IntegerLiteralContext *oC_IntegerLiteral();
+
+   
+  };
+
+  KU_CacheContext* kU_Cache();
+
   class  KU_IfExistsContext : public antlr4::ParserRuleContext {
   public:
     KU_IfExistsContext(antlr4::ParserRuleContext *parent, size_t invokingState);